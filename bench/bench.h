@@ -0,0 +1,255 @@
+/**
+ * @file bench.h
+ * @brief Shared helpers for the toolkit benchmark executables.
+ *
+ * @details
+ * Every benchmark executable sweeps a set of element sizes and element
+ * counts, times one operation in a loop, and reports one row per
+ * (benchmark, element size, N) combination with:
+ * - `ns_per_op`: wall-clock nanoseconds per operation (monotonic clock),
+ * - `bytes_allocated`: the total number of bytes requested from the
+ *   container's allocator while running the benchmark once,
+ * - `peak_bytes`: the largest number of bytes live at the same time.
+ *
+ * Rows are written as CSV (default) or as a JSON array (`--json`), so the
+ * output of two releases can be diffed or loaded into a spreadsheet.
+ *
+ * Command-line options shared by all executables:
+ * - `--json`             Emit JSON instead of CSV.
+ * - `--max-n N`          Largest element count (default 100000000).
+ * - `--max-bytes BYTES`  Skip combinations whose estimated footprint exceeds
+ *                        BYTES (default 1 GiB).
+ */
+#ifndef TOOLKIT_BENCH_BENCH_H
+#define TOOLKIT_BENCH_BENCH_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <tk/core/allocator.h>
+#include <tk/core/types.h>
+
+/**
+ * @brief Element sizes (in bytes) every benchmark is run with.
+ */
+static const size_t tk_bench_element_sizes[] = {4, 16, 64, 256};
+
+/**
+ * @brief Number of entries in `tk_bench_element_sizes`.
+ */
+#define TK_BENCH_ELEMENT_SIZE_COUNT                                            \
+  (sizeof(tk_bench_element_sizes) / sizeof(tk_bench_element_sizes[0]))
+
+/**
+ * @brief Largest element size, used to size scratch element buffers.
+ */
+#define TK_BENCH_MAX_ELEMENT_SIZE 256
+
+/**
+ * @brief Smallest element count of the N sweep (N grows by 10x per step).
+ */
+#define TK_BENCH_MIN_N 1000
+
+/**
+ * @brief Minimum number of operations timed per row; small N are repeated
+ * until at least this many operations have been measured.
+ */
+#define TK_BENCH_MIN_OPS 10000000
+
+/**
+ * @brief Run-time configuration parsed from the command line.
+ */
+typedef struct {
+  tk_bool json;     // Emit JSON instead of CSV
+  size_t max_n;     // Largest element count of the sweep
+  size_t max_bytes; // Footprint limit for a single combination
+  size_t rows;      // Rows written so far (for JSON separators)
+} tk_bench_config_t;
+
+/**
+ * @brief Allocation statistics gathered by the counting allocator.
+ */
+typedef struct {
+  size_t bytes_allocated; // Total bytes requested (reallocs count new size)
+  size_t bytes_live;      // Bytes currently allocated
+  size_t peak_bytes;      // Largest value 'bytes_live' reached
+} tk_bench_counter_t;
+
+// --- Timing ---
+
+/**
+ * @brief Returns a monotonic timestamp in nanoseconds.
+ */
+static inline double tk_bench_now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+/**
+ * @brief Returns how many times a benchmark of 'n' operations is repeated
+ * so that at least TK_BENCH_MIN_OPS operations are timed.
+ */
+static inline size_t tk_bench_repetitions(size_t n) {
+  return n >= TK_BENCH_MIN_OPS ? 1 : TK_BENCH_MIN_OPS / n;
+}
+
+/**
+ * @brief Sink that keeps the compiler from discarding benchmark results.
+ */
+static volatile size_t tk_bench_sink;
+
+/**
+ * @brief A small, fast pseudo-random generator (xorshift64).
+ * @param state The generator state; must not be 0.
+ * @return The next pseudo-random value.
+ */
+static inline size_t tk_bench_random(unsigned long long *state) {
+  unsigned long long x = *state;
+  x ^= x << 13;
+  x ^= x >> 7;
+  x ^= x << 17;
+  *state = x;
+  return (size_t)x;
+}
+
+// --- Counting Allocator ---
+
+static inline void tk_bench_track(tk_bench_counter_t *counter,
+                                  size_t old_size, size_t new_size) {
+  counter->bytes_allocated += new_size;
+  counter->bytes_live += new_size - old_size;
+  if (counter->bytes_live > counter->peak_bytes)
+    counter->peak_bytes = counter->bytes_live;
+}
+
+static inline void *tk_bench_counting_alloc(void *ctx, size_t size) {
+  void *ptr = malloc(size);
+  if (ptr)
+    tk_bench_track((tk_bench_counter_t *)ctx, 0, size);
+  return ptr;
+}
+
+static inline void *tk_bench_counting_realloc(void *ctx, void *ptr,
+                                              size_t old_size,
+                                              size_t new_size) {
+  void *block = realloc(ptr, new_size);
+  if (block)
+    tk_bench_track((tk_bench_counter_t *)ctx, old_size, new_size);
+  return block;
+}
+
+static inline void tk_bench_counting_free(void *ctx, void *ptr, size_t size) {
+  tk_bench_counter_t *counter = (tk_bench_counter_t *)ctx;
+  counter->bytes_live -= size;
+  free(ptr);
+}
+
+/**
+ * @brief Returns a malloc-backed allocator that records into 'counter'.
+ */
+static inline tk_allocator_t
+tk_bench_counting_allocator(tk_bench_counter_t *counter) {
+  tk_allocator_t allocator = {.alloc = tk_bench_counting_alloc,
+                              .realloc = tk_bench_counting_realloc,
+                              .free = tk_bench_counting_free,
+                              .ctx = counter};
+  memset(counter, 0, sizeof(*counter));
+  return allocator;
+}
+
+// --- Configuration & Reporting ---
+
+/**
+ * @brief Parses the shared command-line options.
+ * @return 0 on success, or 1 after printing usage for an unknown option.
+ */
+static inline int tk_bench_parse_args(int argc, char **argv,
+                                      tk_bench_config_t *config) {
+  config->json = false;
+  config->max_n = 100000000;
+  config->max_bytes = (size_t)1 << 30;
+  config->rows = 0;
+
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--json") == 0) {
+      config->json = true;
+    } else if (strcmp(argv[i], "--max-n") == 0 && i + 1 < argc) {
+      config->max_n = (size_t)strtoull(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "--max-bytes") == 0 && i + 1 < argc) {
+      config->max_bytes = (size_t)strtoull(argv[++i], NULL, 10);
+    } else {
+      fprintf(stderr, "usage: %s [--json] [--max-n N] [--max-bytes BYTES]\n",
+              argv[0]);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/**
+ * @brief Returns whether a combination fits the configured limits.
+ * @param config The configuration.
+ * @param n The element count.
+ * @param bytes_per_element Estimated footprint of one element, including
+ * container overhead (e.g. list node links).
+ */
+static inline tk_bool tk_bench_fits(const tk_bench_config_t *config, size_t n,
+                                    size_t bytes_per_element) {
+  return n <= config->max_n && n <= config->max_bytes / bytes_per_element;
+}
+
+/**
+ * @brief Writes the CSV header or opens the JSON array.
+ */
+static inline void tk_bench_begin(tk_bench_config_t *config) {
+  if (config->json)
+    printf("[\n");
+  else
+    printf("suite,benchmark,element_size,n,ns_per_op,bytes_allocated,"
+           "peak_bytes\n");
+}
+
+/**
+ * @brief Writes one result row.
+ * @param config The configuration.
+ * @param suite The executable's suite name (e.g. "vec").
+ * @param name The benchmark name (e.g. "push_back").
+ * @param element_size The element size in bytes.
+ * @param n The element count.
+ * @param ns_per_op The measured nanoseconds per operation.
+ * @param counter Allocation statistics for one run, or NULL if the timed
+ * operation does not allocate.
+ */
+static inline void tk_bench_report(tk_bench_config_t *config,
+                                   const char *suite, const char *name,
+                                   size_t element_size, size_t n,
+                                   double ns_per_op,
+                                   const tk_bench_counter_t *counter) {
+  size_t allocated = counter ? counter->bytes_allocated : 0;
+  size_t peak = counter ? counter->peak_bytes : 0;
+
+  if (config->json) {
+    printf("%s  {\"suite\": \"%s\", \"benchmark\": \"%s\", "
+           "\"element_size\": %zu, \"n\": %zu, \"ns_per_op\": %.3f, "
+           "\"bytes_allocated\": %zu, \"peak_bytes\": %zu}",
+           config->rows ? ",\n" : "", suite, name, element_size, n, ns_per_op,
+           allocated, peak);
+  } else {
+    printf("%s,%s,%zu,%zu,%.3f,%zu,%zu\n", suite, name, element_size, n,
+           ns_per_op, allocated, peak);
+  }
+  config->rows++;
+  fflush(stdout);
+}
+
+/**
+ * @brief Closes the JSON array (no-op for CSV).
+ */
+static inline void tk_bench_end(tk_bench_config_t *config) {
+  if (config->json)
+    printf("\n]\n");
+}
+
+#endif // TOOLKIT_BENCH_BENCH_H
@@ -0,0 +1,86 @@
+/**
+ * @file bench_algo.c
+ * @brief Benchmarks for the generic algorithms over `tk_vec_t` and
+ * `tk_list_t` ranges.
+ *
+ * The predicate never matches, so every run scans the whole range.
+ */
+
+#include "bench.h"
+#include <tk/algo/algo.h>
+#include <tk/ds/list.h>
+#include <tk/ds/vec.h>
+
+static const char *const SUITE = "algo";
+
+/**
+ * @brief Estimated per-node overhead of a list (links plus malloc
+ * bookkeeping).
+ */
+#define NODE_OVERHEAD 48
+
+/**
+ * @brief Predicate that never matches (elements hold their index).
+ */
+static tk_bool never_matches(const void *element) {
+  unsigned value;
+  memcpy(&value, element, sizeof(value));
+  return value == (unsigned)-1;
+}
+
+static void bench_find_if(tk_bench_config_t *config, const char *name,
+                          tk_iterator_t begin, tk_iterator_t end,
+                          size_t element_size, size_t n) {
+  size_t reps = tk_bench_repetitions(n);
+  size_t found = 0;
+
+  double start = tk_bench_now_ns();
+  for (size_t r = 0; r < reps; ++r) {
+    tk_iterator_t result = tk_algo_find_if(begin, end, never_matches);
+    found += !tk_iter_equal(&result, &end);
+  }
+  double elapsed = tk_bench_now_ns() - start;
+  tk_bench_sink = found;
+
+  tk_bench_report(config, SUITE, name, element_size, n,
+                  elapsed / ((double)reps * (double)n), NULL);
+}
+
+int main(int argc, char **argv) {
+  tk_bench_config_t config;
+  if (tk_bench_parse_args(argc, argv, &config) != 0)
+    return 1;
+
+  unsigned char element[TK_BENCH_MAX_ELEMENT_SIZE] = {0};
+
+  tk_bench_begin(&config);
+  for (size_t s = 0; s < TK_BENCH_ELEMENT_SIZE_COUNT; ++s) {
+    size_t element_size = tk_bench_element_sizes[s];
+    for (size_t n = TK_BENCH_MIN_N;
+         tk_bench_fits(&config, n, element_size + NODE_OVERHEAD); n *= 10) {
+      tk_vec_t *vec = tk_vec_create(element_size);
+      tk_list_t *list = tk_list_create(element_size);
+      if (!vec || !list || tk_vec_reserve(vec, n) != TK_SUCCESS) {
+        tk_vec_destroy(vec);
+        tk_list_destroy(list);
+        break;
+      }
+      for (size_t i = 0; i < n; ++i) {
+        unsigned value = (unsigned)i;
+        memcpy(element, &value, sizeof(value));
+        tk_vec_push_back(vec, element);
+        tk_list_push_back(list, element);
+      }
+
+      bench_find_if(&config, "find_if_vec", tk_vec_begin(vec), tk_vec_end(vec),
+                    element_size, n);
+      bench_find_if(&config, "find_if_list", tk_list_begin(list),
+                    tk_list_end(list), element_size, n);
+
+      tk_vec_destroy(vec);
+      tk_list_destroy(list);
+    }
+  }
+  tk_bench_end(&config);
+  return 0;
+}
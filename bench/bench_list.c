@@ -0,0 +1,133 @@
+/**
+ * @file bench_list.c
+ * @brief Benchmarks for `tk_list_t`: push_back/push_front, erase_at and
+ * iterator traversal.
+ */
+
+#include "bench.h"
+#include <tk/core/iterator.h>
+#include <tk/ds/list.h>
+
+static const char *const SUITE = "list";
+
+/**
+ * @brief Estimated per-node overhead (links plus malloc bookkeeping).
+ */
+#define NODE_OVERHEAD 48
+
+/**
+ * @brief Builds a list of 'n' elements with push_back or push_front.
+ * @return The list, or NULL if allocation failed.
+ */
+static tk_list_t *build_list(size_t element_size, size_t n, tk_bool front,
+                             const tk_allocator_t *allocator) {
+  unsigned char element[TK_BENCH_MAX_ELEMENT_SIZE] = {0};
+  tk_list_t *list = tk_list_create_with_allocator(element_size, allocator);
+  if (!list)
+    return NULL;
+  for (size_t i = 0; i < n; ++i) {
+    unsigned value = (unsigned)i;
+    memcpy(element, &value, sizeof(value));
+    tk_error_t err = front ? tk_list_push_front(list, element)
+                           : tk_list_push_back(list, element);
+    if (err != TK_SUCCESS) {
+      tk_list_destroy(list);
+      return NULL;
+    }
+  }
+  return list;
+}
+
+static void bench_push(tk_bench_config_t *config, size_t element_size,
+                       size_t n, tk_bool front) {
+  tk_bench_counter_t counter;
+  tk_allocator_t allocator = tk_bench_counting_allocator(&counter);
+  size_t reps = tk_bench_repetitions(n);
+  tk_bench_counter_t first_run = {0};
+  double elapsed = 0;
+
+  for (size_t r = 0; r < reps; ++r) {
+    tk_bench_counting_allocator(&counter);
+    double start = tk_bench_now_ns();
+    tk_list_t *list = build_list(element_size, n, front, &allocator);
+    elapsed += tk_bench_now_ns() - start;
+    if (!list)
+      return;
+    if (r == 0)
+      first_run = counter;
+    tk_list_destroy(list);
+  }
+
+  tk_bench_report(config, SUITE, front ? "push_front" : "push_back",
+                  element_size, n, elapsed / ((double)reps * (double)n),
+                  &first_run);
+}
+
+static void bench_erase_at(tk_bench_config_t *config, size_t element_size,
+                           size_t n) {
+  size_t reps = tk_bench_repetitions(n);
+  double elapsed = 0;
+
+  for (size_t r = 0; r < reps; ++r) {
+    tk_list_t *list =
+        build_list(element_size, n, false, tk_allocator_default());
+    if (!list)
+      return;
+
+    // Erase every element from the front, one iterator at a time.
+    double start = tk_bench_now_ns();
+    tk_iterator_t it = tk_list_begin(list);
+    for (size_t i = 0; i < n; ++i)
+      it = tk_list_erase_at(list, it);
+    elapsed += tk_bench_now_ns() - start;
+
+    tk_list_destroy(list);
+  }
+
+  tk_bench_report(config, SUITE, "erase_at", element_size, n,
+                  elapsed / ((double)reps * (double)n), NULL);
+}
+
+static void bench_iterate(tk_bench_config_t *config, size_t element_size,
+                          size_t n) {
+  tk_list_t *list = build_list(element_size, n, false, tk_allocator_default());
+  if (!list)
+    return;
+
+  size_t reps = tk_bench_repetitions(n);
+  size_t sum = 0;
+
+  double start = tk_bench_now_ns();
+  for (size_t r = 0; r < reps; ++r) {
+    tk_iterator_t it = tk_list_begin(list);
+    tk_iterator_t end = tk_list_end(list);
+    for (; !tk_iter_equal(&it, &end); tk_iter_next(&it))
+      sum += *(const unsigned char *)tk_iter_get(&it);
+  }
+  double elapsed = tk_bench_now_ns() - start;
+  tk_bench_sink = sum;
+  tk_list_destroy(list);
+
+  tk_bench_report(config, SUITE, "iterate", element_size, n,
+                  elapsed / ((double)reps * (double)n), NULL);
+}
+
+int main(int argc, char **argv) {
+  tk_bench_config_t config;
+  if (tk_bench_parse_args(argc, argv, &config) != 0)
+    return 1;
+
+  tk_bench_begin(&config);
+  for (size_t s = 0; s < TK_BENCH_ELEMENT_SIZE_COUNT; ++s) {
+    size_t element_size = tk_bench_element_sizes[s];
+    for (size_t n = TK_BENCH_MIN_N;
+         tk_bench_fits(&config, n, element_size + NODE_OVERHEAD); n *= 10) {
+      bench_push(&config, element_size, n, false);
+      bench_push(&config, element_size, n, true);
+      bench_erase_at(&config, element_size, n);
+      bench_iterate(&config, element_size, n);
+    }
+  }
+  tk_bench_end(&config);
+  return 0;
+}
@@ -0,0 +1,138 @@
+/**
+ * @file bench_vec.c
+ * @brief Benchmarks for `tk_vec_t`: push_back, indexed access and iterator
+ * traversal.
+ */
+
+#include "bench.h"
+#include <tk/core/iterator.h>
+#include <tk/ds/vec.h>
+
+static const char *const SUITE = "vec";
+
+/**
+ * @brief Builds a vector of 'n' elements with push_back.
+ * @return The vector, or NULL if allocation failed.
+ */
+static tk_vec_t *build_vec(size_t element_size, size_t n,
+                           const tk_allocator_t *allocator) {
+  unsigned char element[TK_BENCH_MAX_ELEMENT_SIZE] = {0};
+  tk_vec_t *vec = tk_vec_create_with_allocator(element_size, allocator);
+  if (!vec)
+    return NULL;
+  for (size_t i = 0; i < n; ++i) {
+    unsigned value = (unsigned)i;
+    memcpy(element, &value, sizeof(value));
+    if (tk_vec_push_back(vec, element) != TK_SUCCESS) {
+      tk_vec_destroy(vec);
+      return NULL;
+    }
+  }
+  return vec;
+}
+
+static void bench_push_back(tk_bench_config_t *config, size_t element_size,
+                            size_t n) {
+  tk_bench_counter_t counter;
+  tk_allocator_t allocator = tk_bench_counting_allocator(&counter);
+  size_t reps = tk_bench_repetitions(n);
+  tk_bench_counter_t first_run = {0};
+  double elapsed = 0;
+
+  for (size_t r = 0; r < reps; ++r) {
+    tk_bench_counting_allocator(&counter);
+    double start = tk_bench_now_ns();
+    tk_vec_t *vec = build_vec(element_size, n, &allocator);
+    elapsed += tk_bench_now_ns() - start;
+    if (!vec)
+      return;
+    if (r == 0)
+      first_run = counter;
+    tk_vec_destroy(vec);
+  }
+
+  tk_bench_report(config, SUITE, "push_back", element_size, n,
+                  elapsed / ((double)reps * (double)n), &first_run);
+}
+
+static void bench_at_sequential(tk_bench_config_t *config, tk_vec_t *vec,
+                                size_t element_size, size_t n) {
+  size_t reps = tk_bench_repetitions(n);
+  size_t sum = 0;
+
+  double start = tk_bench_now_ns();
+  for (size_t r = 0; r < reps; ++r) {
+    for (size_t i = 0; i < n; ++i)
+      sum += *(const unsigned char *)tk_vec_at(vec, i);
+  }
+  double elapsed = tk_bench_now_ns() - start;
+  tk_bench_sink = sum;
+
+  tk_bench_report(config, SUITE, "at_sequential", element_size, n,
+                  elapsed / ((double)reps * (double)n), NULL);
+}
+
+static void bench_at_random(tk_bench_config_t *config, tk_vec_t *vec,
+                            size_t element_size, size_t n) {
+  size_t reps = tk_bench_repetitions(n);
+  unsigned long long rng = 0x9E3779B97F4A7C15ull;
+  size_t sum = 0;
+
+  double start = tk_bench_now_ns();
+  for (size_t r = 0; r < reps; ++r) {
+    for (size_t i = 0; i < n; ++i) {
+      size_t index = tk_bench_random(&rng) % n;
+      sum += *(const unsigned char *)tk_vec_at(vec, index);
+    }
+  }
+  double elapsed = tk_bench_now_ns() - start;
+  tk_bench_sink = sum;
+
+  tk_bench_report(config, SUITE, "at_random", element_size, n,
+                  elapsed / ((double)reps * (double)n), NULL);
+}
+
+static void bench_iterate(tk_bench_config_t *config, tk_vec_t *vec,
+                          size_t element_size, size_t n) {
+  size_t reps = tk_bench_repetitions(n);
+  size_t sum = 0;
+
+  double start = tk_bench_now_ns();
+  for (size_t r = 0; r < reps; ++r) {
+    tk_iterator_t it = tk_vec_begin(vec);
+    tk_iterator_t end = tk_vec_end(vec);
+    for (; !tk_iter_equal(&it, &end); tk_iter_next(&it))
+      sum += *(const unsigned char *)tk_iter_get(&it);
+  }
+  double elapsed = tk_bench_now_ns() - start;
+  tk_bench_sink = sum;
+
+  tk_bench_report(config, SUITE, "iterate", element_size, n,
+                  elapsed / ((double)reps * (double)n), NULL);
+}
+
+int main(int argc, char **argv) {
+  tk_bench_config_t config;
+  if (tk_bench_parse_args(argc, argv, &config) != 0)
+    return 1;
+
+  tk_bench_begin(&config);
+  for (size_t s = 0; s < TK_BENCH_ELEMENT_SIZE_COUNT; ++s) {
+    size_t element_size = tk_bench_element_sizes[s];
+    // Growth can briefly hold the old and the new buffer.
+    for (size_t n = TK_BENCH_MIN_N;
+         tk_bench_fits(&config, n, 3 * element_size); n *= 10) {
+      bench_push_back(&config, element_size, n);
+
+      tk_vec_t *vec = build_vec(element_size, n, tk_allocator_default());
+      if (!vec)
+        break;
+      bench_at_sequential(&config, vec, element_size, n);
+      bench_at_random(&config, vec, element_size, n);
+      bench_iterate(&config, vec, element_size, n);
+      tk_vec_destroy(vec);
+    }
+  }
+  tk_bench_end(&config);
+  return 0;
+}
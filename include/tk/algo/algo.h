@@ -14,6 +14,10 @@
 #define TOOLKIT_ALGO_ALGO_H
 
 // Include all algorithm modules
+#include <tk/algo/parallel.h>
+#include <tk/algo/search.h>
 #include <tk/algo/sequence.h>
+#include <tk/algo/sort.h>
+#include <tk/algo/unique.h>
 
 #endif // TOOLKIT_ALGO_ALGO_H
@@ -0,0 +1,95 @@
+/**
+ * @file parallel.h
+ * @brief Multi-threaded variants of the generic sequence algorithms.
+ *
+ * @details
+ * The `tk_algo_par_*` functions accept only `TK_ITER_RANDOM_ACCESS`
+ * iterators. The range is cut into blocks that worker threads claim in
+ * increasing order, and the per-block results are merged once every worker
+ * is done. Small ranges are processed on the calling thread. Ranges that do
+ * not expose contiguous storage are split with the O(1) `seek`/`distance`
+ * of their iterators (except for `tk_algo_par_transform`, which runs them on
+ * the calling thread).
+ *
+ * The callbacks run concurrently on several threads and must therefore be
+ * safe to call in parallel on distinct elements. The order in which
+ * elements are visited is unspecified, except that `tk_algo_par_find_if`
+ * still returns the *first* matching element.
+ *
+ * The work runs on the shared `tk_pool_default()` thread pool, with the
+ * calling thread taking part. `num_threads` is the maximum number of
+ * threads to use, the calling thread included; pass 0 to use one thread per
+ * online CPU. The pool size caps the actual parallelism.
+ */
+#ifndef TOOLKIT_ALGO_PARALLEL_H
+#define TOOLKIT_ALGO_PARALLEL_H
+
+#include <tk/core/iterator.h>
+#include <tk/core/types.h>
+
+/**
+ * @brief Returns the number of online CPUs (at least 1).
+ */
+size_t tk_algo_par_hardware_threads(void);
+
+/**
+ * @brief Calls `fn` on every element of [begin, end), in parallel.
+ * @param begin The beginning of the range.
+ * @param end The end of the range.
+ * @param fn The function to apply; it may modify the element.
+ * @param num_threads The maximum number of threads, or 0 for one per CPU.
+ */
+void tk_algo_par_for_each(tk_iterator_t begin, tk_iterator_t end,
+                          void (*fn)(void *element), size_t num_threads);
+
+/**
+ * @brief Finds the first element of [begin, end) that satisfies `predicate`,
+ * in parallel.
+ *
+ * Once a match is found, workers stop claiming blocks that lie after it, so
+ * a match early in the range ends the search early.
+ *
+ * @param begin The beginning of the range.
+ * @param end The end of the range.
+ * @param predicate Returns `true` for a matching element.
+ * @param num_threads The maximum number of threads, or 0 for one per CPU.
+ * @return An iterator to the first matching element, or `end`.
+ */
+tk_iterator_t tk_algo_par_find_if(tk_iterator_t begin, tk_iterator_t end,
+                                  tk_bool (*predicate)(const void *element),
+                                  size_t num_threads);
+
+/**
+ * @brief Counts the elements of [begin, end) that satisfy `predicate`, in
+ * parallel.
+ * @param begin The beginning of the range.
+ * @param end The end of the range.
+ * @param predicate Returns `true` for an element to count.
+ * @param num_threads The maximum number of threads, or 0 for one per CPU.
+ * @return The number of matching elements.
+ */
+size_t tk_algo_par_count_if(tk_iterator_t begin, tk_iterator_t end,
+                            tk_bool (*predicate)(const void *element),
+                            size_t num_threads);
+
+/**
+ * @brief Applies `op` to every element of [begin, end) and writes the
+ * results to the range starting at `out`, in parallel.
+ *
+ * `out` must be a random-access iterator with room for
+ * `distance(begin, end)` elements. The input and output ranges may be the
+ * same range (in-place transform) but must not otherwise overlap.
+ *
+ * @param begin The beginning of the input range.
+ * @param end The end of the input range.
+ * @param out The beginning of the output range.
+ * @param op Reads one input element and writes one output element.
+ * @param num_threads The maximum number of threads, or 0 for one per CPU.
+ * @return An iterator past the last element written.
+ */
+tk_iterator_t tk_algo_par_transform(tk_iterator_t begin, tk_iterator_t end,
+                                    tk_iterator_t out,
+                                    void (*op)(const void *in, void *out),
+                                    size_t num_threads);
+
+#endif // TOOLKIT_ALGO_PARALLEL_H
@@ -0,0 +1,82 @@
+/**
+ * @file search.h
+ * @brief Vectorized value searches over ranges of primitive elements.
+ *
+ * @details
+ * `tk_algo_find_if` calls a predicate through a function pointer for every
+ * element. When the question is simply "where is this integer" or "what is
+ * the smallest float", these functions answer it without any callback: the
+ * element type is passed as a `tk_scalar_t`, and a range over contiguous,
+ * densely packed storage (such as `tk_vec_begin` / `tk_vec_end`) is scanned
+ * with SIMD kernels, 16 to 32 bytes per instruction.
+ *
+ * The instruction set is chosen at run time: AVX2 where the CPU supports it
+ * (GCC/Clang on x86), otherwise SSE2 on x86-64 and NEON on ARM. Elements of
+ * other ranges are gathered in blocks through `tk_iter_next_block` and run
+ * through the same kernels. Defining `TK_SEARCH_PORTABLE` when building the
+ * library disables every SIMD kernel.
+ *
+ * Every element of the range must be an object of the given type. Floats
+ * compare with `==`, so `-0.0` matches `0.0` and NaN matches nothing; the
+ * result of `tk_algo_min_max` is unspecified if the range contains NaN.
+ */
+#ifndef TOOLKIT_ALGO_SEARCH_H
+#define TOOLKIT_ALGO_SEARCH_H
+
+#include <tk/core/error.h>
+#include <tk/core/iterator.h>
+#include <tk/core/types.h>
+
+/**
+ * @brief Primitive element types understood by the search kernels.
+ */
+typedef enum {
+  TK_SCALAR_I8,  // int8_t
+  TK_SCALAR_U8,  // uint8_t
+  TK_SCALAR_I16, // int16_t
+  TK_SCALAR_U16, // uint16_t
+  TK_SCALAR_I32, // int32_t
+  TK_SCALAR_U32, // uint32_t
+  TK_SCALAR_I64, // int64_t
+  TK_SCALAR_U64, // uint64_t
+  TK_SCALAR_F32, // float
+  TK_SCALAR_F64  // double
+} tk_scalar_t;
+
+/**
+ * @brief Finds the first element of [begin, end) equal to `*value`.
+ * @param begin The beginning of the range.
+ * @param end The end of the range.
+ * @param type The type of the elements (and of `*value`).
+ * @param value A pointer to the value to look for.
+ * @return An iterator to the first match, or `end` if there is none.
+ */
+tk_iterator_t tk_algo_find_value(tk_iterator_t begin, tk_iterator_t end,
+                                 tk_scalar_t type, const void *value);
+
+/**
+ * @brief Counts the elements of [begin, end) equal to `*value`.
+ * @param begin The beginning of the range.
+ * @param end The end of the range.
+ * @param type The type of the elements (and of `*value`).
+ * @param value A pointer to the value to count.
+ * @return The number of matching elements.
+ */
+size_t tk_algo_count_value(tk_iterator_t begin, tk_iterator_t end,
+                           tk_scalar_t type, const void *value);
+
+/**
+ * @brief Finds the smallest and the largest element of [begin, end) in a
+ * single pass.
+ * @param begin The beginning of the range.
+ * @param end The end of the range.
+ * @param type The type of the elements.
+ * @param min Receives the smallest element (one `type`), or NULL.
+ * @param max Receives the largest element (one `type`), or NULL.
+ * @return TK_SUCCESS, or TK_E_EMPTY if the range is empty (`*min` and
+ * `*max` are then left untouched).
+ */
+tk_error_t tk_algo_min_max(tk_iterator_t begin, tk_iterator_t end,
+                           tk_scalar_t type, void *min, void *max);
+
+#endif // TOOLKIT_ALGO_SEARCH_H
@@ -6,10 +6,12 @@
  * This file provides generic algorithms that operate on iterator ranges
  * (begin, end) to perform sequence operations, such as searching and counting.
  *
- * All functions in this file are implemented as `static inline` to
- * achieve zero-cost abstraction, allowing the compiler to fully inline
- * the algorithm logic and optimize away the iterator vtable calls
- * where possible.
+ * All functions in this file are implemented as `static inline` so the
+ * algorithm logic can be inlined at the call site. Iterators that expose
+ * contiguous storage (see `tk_iter_contiguous`) are detected once per call
+ * and scanned with a plain pointer loop instead of per-element vtable calls.
+ * Other iterators that provide `next_block` are consumed in batches of
+ * TK_ALGO_BLOCK elements, one indirect call per batch.
  *
  * These algorithms are "generic" because they operate entirely on the
  * `tk_iterator_t` interface and have no knowledge of the underlying
@@ -22,6 +24,13 @@
 #include <tk/core/macros.h>
 #include <tk/core/types.h>
 
+/**
+ * @brief Number of element pointers fetched per `tk_iter_next_block` call.
+ */
+#ifndef TK_ALGO_BLOCK
+#define TK_ALGO_BLOCK 64
+#endif
+
 /**
  * @brief Finds the first element in the range [begin, end) that satisfies
  * the given predicate.
@@ -54,6 +63,40 @@ tk_algo_find_if(tk_iterator_t begin, tk_iterator_t end,
             "tk_algo_find_if: 'begin' and 'end' iterators are from "
             "different container types.");
 
+  // Fast path: contiguous storage is scanned with a plain pointer loop, so
+  // the only indirect calls left are the predicate and two setup calls.
+  size_t stride;
+  const char *first = (const char *)tk_iter_contiguous(&begin, &stride);
+  if (first) {
+    const char *last = (const char *)tk_iter_contiguous(&end, &stride);
+    for (const char *p = first; p != last; p += stride) {
+      if (predicate(p)) {
+        begin.vtable->seek(&begin, (ptrdiff_t)((p - first) / stride));
+        return begin;
+      }
+    }
+    return end;
+  }
+
+  // Batched path: the container walks its own storage for a whole block of
+  // pointers. On a match, a copy of the block's start is stepped to it.
+  if (begin.vtable->next_block) {
+    void *ptrs[TK_ALGO_BLOCK];
+    for (;;) {
+      tk_iterator_t block_start;
+      tk_iter_clone(&block_start, &begin);
+      size_t n = tk_iter_next_block(&begin, &end, ptrs, TK_ALGO_BLOCK);
+      if (n == 0)
+        return end;
+      for (size_t i = 0; i < n; ++i) {
+        if (predicate(ptrs[i])) {
+          tk_iter_advance_n(&block_start, (ptrdiff_t)i);
+          return block_start;
+        }
+      }
+    }
+  }
+
   // Loop while the current iterator 'begin' is not equal to 'end'
   while (!tk_iter_equal(&begin, &end)) {
     // Get the current element from the iterator
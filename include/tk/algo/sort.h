@@ -0,0 +1,96 @@
+/**
+ * @file sort.h
+ * @brief Sorting algorithms for random-access ranges.
+ *
+ * @details
+ * All functions require `TK_ITER_RANDOM_ACCESS` iterators over contiguous
+ * storage (such as `tk_vec_begin` / `tk_vec_end`) and sort the range in
+ * place.
+ *
+ * - `tk_algo_sort` is an introsort: quicksort with a median-of-three pivot,
+ *   heapsort once the recursion gets too deep (O(n log n) worst case), and
+ *   insertion sort for small partitions. Not stable.
+ * - `tk_algo_stable_sort` is a bottom-up merge sort with an n-element
+ *   scratch buffer. Stable.
+ * - `tk_algo_radix_sort` is an LSD radix sort over one integer key per
+ *   element. Stable, no comparator calls, O(n) per key byte.
+ * - `tk_algo_par_stable_sort` merge-sorts chunks of the range in parallel on
+ *   the shared thread pool, then merges them pairwise in parallel rounds.
+ *
+ * The comparison-based sorts use dedicated code paths for 4-, 8- and
+ * 16-byte elements, so swaps and moves compile down to plain loads and
+ * stores.
+ */
+#ifndef TOOLKIT_ALGO_SORT_H
+#define TOOLKIT_ALGO_SORT_H
+
+#include <tk/core/error.h>
+#include <tk/core/iterator.h>
+#include <tk/core/types.h>
+
+/**
+ * @brief Integer key types understood by `tk_algo_radix_sort`.
+ */
+typedef enum {
+  TK_RADIX_U32, // uint32_t
+  TK_RADIX_I32, // int32_t
+  TK_RADIX_U64, // uint64_t
+  TK_RADIX_I64  // int64_t
+} tk_radix_key_t;
+
+/**
+ * @brief Sorts [begin, end) in ascending order with introsort. Not stable.
+ * @param begin The beginning of the range.
+ * @param end The end of the range.
+ * @param cmp The comparison function.
+ * @return TK_SUCCESS, or TK_E_INVALID_ARG if the iterators do not expose
+ * contiguous random-access storage.
+ */
+tk_error_t tk_algo_sort(tk_iterator_t begin, tk_iterator_t end,
+                        tk_compare_fn_t cmp);
+
+/**
+ * @brief Sorts [begin, end) in ascending order, keeping equivalent elements
+ * in their original order.
+ * @param begin The beginning of the range.
+ * @param end The end of the range.
+ * @param cmp The comparison function.
+ * @return TK_SUCCESS, TK_E_INVALID_ARG for unsupported iterators, or
+ * TK_E_NOMEM if the scratch buffer could not be allocated (the range is
+ * left unchanged).
+ */
+tk_error_t tk_algo_stable_sort(tk_iterator_t begin, tk_iterator_t end,
+                               tk_compare_fn_t cmp);
+
+/**
+ * @brief Sorts [begin, end) by an integer key stored in each element, with
+ * a stable least-significant-digit radix sort.
+ *
+ * The key is read (with `memcpy`, so it need not be aligned) from
+ * `key_offset` bytes into every element; for a vector of plain integers,
+ * pass 0.
+ *
+ * @param begin The beginning of the range.
+ * @param end The end of the range.
+ * @param key_offset The byte offset of the key within an element.
+ * @param key_type The type of the key.
+ * @return TK_SUCCESS, TK_E_INVALID_ARG for unsupported iterators or a key
+ * that does not fit in the element, or TK_E_NOMEM if the scratch buffer
+ * could not be allocated (the range is left unchanged).
+ */
+tk_error_t tk_algo_radix_sort(tk_iterator_t begin, tk_iterator_t end,
+                              size_t key_offset, tk_radix_key_t key_type);
+
+/**
+ * @brief Stable parallel merge sort of [begin, end) on the shared thread
+ * pool (see <tk/algo/parallel.h> for the threading model).
+ * @param begin The beginning of the range.
+ * @param end The end of the range.
+ * @param cmp The comparison function; called concurrently.
+ * @param num_threads The maximum number of threads, or 0 for one per CPU.
+ * @return The same codes as `tk_algo_stable_sort`.
+ */
+tk_error_t tk_algo_par_stable_sort(tk_iterator_t begin, tk_iterator_t end,
+                                   tk_compare_fn_t cmp, size_t num_threads);
+
+#endif // TOOLKIT_ALGO_SORT_H
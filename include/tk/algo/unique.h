@@ -0,0 +1,70 @@
+/**
+ * @file unique.h
+ * @brief Duplicate removal for contiguous ranges.
+ *
+ * @details
+ * Both algorithms compact the elements they keep to the front of the range,
+ * in their original order, and report how many that is. The storage itself
+ * is not resized; truncate the container afterwards:
+ *
+ * @code
+ * size_t kept;
+ * tk_algo_dedup_hashed(tk_vec_begin(vec), tk_vec_end(vec), NULL, NULL,
+ *                      &kept);
+ * tk_vec_resize(vec, kept, NULL);
+ * @endcode
+ *
+ * `tk_algo_unique` drops runs of adjacent equal elements, in one pass with
+ * no allocation: after a sort it removes every duplicate. When the order
+ * must be kept, `tk_algo_dedup_hashed` removes every repeat of an element
+ * seen earlier, in one pass, instead of a sort. It never copies elements
+ * out of the range: its scratch is an open-addressed table of indices of
+ * the elements kept so far, hashed and compared in place. The table is
+ * sized for the whole range up front (as `tk_algo_stable_sort` sizes its
+ * buffer), so the pass never rehashes and cannot fail halfway; it costs
+ * 16 to 32 bytes per element whatever the element size.
+ *
+ * Like the sorts, both need iterators with contiguous storage (`tk_vec_t`,
+ * `tk_mmvec_t`) and return TK_E_INVALID_ARG for any other.
+ */
+#ifndef TOOLKIT_ALGO_UNIQUE_H
+#define TOOLKIT_ALGO_UNIQUE_H
+
+#include <tk/algo/sort.h>
+#include <tk/core/error.h>
+#include <tk/core/iterator.h>
+#include <tk/ds/hashmap.h>
+
+/**
+ * @brief Removes consecutive duplicates from [begin, end), keeping the first
+ * element of each run of equal elements.
+ * @param begin The beginning of the range.
+ * @param end The end of the range.
+ * @param cmp Elements are equal when it returns 0, or NULL to compare the
+ * elements' bytes.
+ * @param kept Receives the number of elements left at the front of the
+ * range.
+ * @return TK_SUCCESS, or TK_E_INVALID_ARG if the iterators do not expose
+ * contiguous storage.
+ */
+tk_error_t tk_algo_unique(tk_iterator_t begin, tk_iterator_t end,
+                          tk_compare_fn_t cmp, size_t *kept);
+
+/**
+ * @brief Removes every element of [begin, end) equal to an earlier one,
+ * whether adjacent or not, keeping the order of first occurrences.
+ * @param begin The beginning of the range.
+ * @param end The end of the range.
+ * @param hash The element hash, or NULL for `tk_hash_bytes`.
+ * @param equal The element equality, or NULL for `tk_key_equal_bytes`.
+ * @param kept Receives the number of elements left at the front of the
+ * range.
+ * @return TK_SUCCESS, TK_E_INVALID_ARG for unsupported iterators, or
+ * TK_E_NOMEM if the index table could not be allocated (the range is
+ * left unchanged).
+ */
+tk_error_t tk_algo_dedup_hashed(tk_iterator_t begin, tk_iterator_t end,
+                                tk_hash_fn_t hash, tk_key_equal_fn_t equal,
+                                size_t *kept);
+
+#endif // TOOLKIT_ALGO_UNIQUE_H
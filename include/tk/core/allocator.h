@@ -0,0 +1,146 @@
+/**
+ * @file allocator.h
+ * @brief Defines the pluggable allocator interface used by all toolkit
+ * containers.
+ *
+ * @details
+ * A `tk_allocator_t` is a small vtable of allocation functions plus an opaque
+ * context pointer. Containers created through a `*_create_with_allocator`
+ * constructor copy the allocator by value and route every allocation they
+ * make (including the container handle itself) through it. This allows
+ * per-request arenas, per-thread pools or instrumented allocators to be
+ * handed to containers without rebuilding the library.
+ *
+ * Every deallocation is told the size of the block being released, so
+ * allocators that do not keep per-block headers (arenas, slabs) can be
+ * implemented cheaply.
+ */
+#ifndef TOOLKIT_CORE_ALLOCATOR_H
+#define TOOLKIT_CORE_ALLOCATOR_H
+
+#include <string.h> // For memcpy in the realloc fallback
+#include <tk/core/macros.h>
+#include <tk/core/types.h>
+
+/**
+ * @brief The allocator interface (vtable + context).
+ *
+ * `alloc` and `free` are mandatory. `realloc` is optional; when it is NULL,
+ * `tk_allocator_realloc` falls back to alloc + memcpy + free.
+ */
+typedef struct {
+  /**
+   * @brief Allocates a block of at least `size` bytes.
+   * The block must be suitably aligned for any fundamental type.
+   * @param ctx The allocator's context pointer.
+   * @param size The number of bytes to allocate (never 0).
+   * @return A pointer to the block, or NULL on failure.
+   */
+  void *(*alloc)(void *ctx, size_t size);
+
+  /**
+   * @brief (Optional) Resizes a block previously returned by this allocator.
+   * The contents up to min(old_size, new_size) must be preserved.
+   * @param ctx The allocator's context pointer.
+   * @param ptr The block to resize (never NULL).
+   * @param old_size The size the block was last allocated with.
+   * @param new_size The requested new size (never 0).
+   * @return A pointer to the resized block, or NULL on failure (in which case
+   * `ptr` must remain valid and unchanged).
+   */
+  void *(*realloc)(void *ctx, void *ptr, size_t old_size, size_t new_size);
+
+  /**
+   * @brief Releases a block previously returned by this allocator.
+   * @param ctx The allocator's context pointer.
+   * @param ptr The block to free (never NULL).
+   * @param size The size the block was last allocated with.
+   */
+  void (*free)(void *ctx, void *ptr, size_t size);
+
+  /**
+   * @brief Opaque user context passed to every function above.
+   */
+  void *ctx;
+} tk_allocator_t;
+
+/**
+ * @brief Returns the default allocator, backed by malloc/realloc/free.
+ *
+ * This is the allocator used by every container created without an explicit
+ * allocator. The returned object is static and must not be modified.
+ *
+ * @return A pointer to the default allocator (never NULL).
+ */
+const tk_allocator_t *tk_allocator_default(void);
+
+// --- Allocation Helpers ---
+
+/**
+ * @brief Validates the completeness of an allocator in debug builds.
+ * @param allocator A pointer to the allocator to validate.
+ */
+static inline void tk_allocator_validate(const tk_allocator_t *allocator) {
+  (void)allocator; // Suppress unused warning in release builds
+  TK_ASSERT(allocator != NULL);
+  TK_ASSERT(allocator->alloc != NULL);
+  TK_ASSERT(allocator->free != NULL);
+}
+
+/**
+ * @brief Allocates `size` bytes through `allocator`.
+ * @param allocator The allocator to use.
+ * @param size The number of bytes to allocate.
+ * @return A pointer to the block, or NULL on failure or if `size` is 0.
+ */
+static inline void *tk_allocator_alloc(const tk_allocator_t *allocator,
+                                       size_t size) {
+  if (size == 0)
+    return NULL;
+  return allocator->alloc(allocator->ctx, size);
+}
+
+/**
+ * @brief Resizes a block through `allocator`.
+ *
+ * A NULL `ptr` behaves like `tk_allocator_alloc`. If the allocator has no
+ * `realloc` function, a new block is allocated, the old contents are copied
+ * and the old block is freed.
+ *
+ * @param allocator The allocator the block came from.
+ * @param ptr The block to resize, or NULL.
+ * @param old_size The current size of the block (0 if `ptr` is NULL).
+ * @param new_size The requested new size (must be greater than 0).
+ * @return A pointer to the resized block, or NULL on failure (in which case
+ * `ptr` is left untouched).
+ */
+static inline void *tk_allocator_realloc(const tk_allocator_t *allocator,
+                                         void *ptr, size_t old_size,
+                                         size_t new_size) {
+  TK_ASSERT(new_size > 0);
+  if (!ptr)
+    return tk_allocator_alloc(allocator, new_size);
+  if (allocator->realloc)
+    return allocator->realloc(allocator->ctx, ptr, old_size, new_size);
+
+  void *block = allocator->alloc(allocator->ctx, new_size);
+  if (!block)
+    return NULL;
+  memcpy(block, ptr, old_size < new_size ? old_size : new_size);
+  allocator->free(allocator->ctx, ptr, old_size);
+  return block;
+}
+
+/**
+ * @brief Frees a block through `allocator`. Does nothing if `ptr` is NULL.
+ * @param allocator The allocator the block came from.
+ * @param ptr The block to free, or NULL.
+ * @param size The size the block was last allocated with.
+ */
+static inline void tk_allocator_free(const tk_allocator_t *allocator,
+                                     void *ptr, size_t size) {
+  if (ptr)
+    allocator->free(allocator->ctx, ptr, size);
+}
+
+#endif // TOOLKIT_CORE_ALLOCATOR_H
@@ -0,0 +1,122 @@
+/**
+ * @file arena.h
+ * @brief Public interface for the toolkit's linear (bump) arena allocator.
+ *
+ * @details
+ * A `tk_arena_t` hands out memory by bumping an offset through large chunks
+ * obtained from a backing `tk_allocator_t`. Individual frees are (almost)
+ * free: a block is only reclaimed if it is the most recent allocation.
+ * Instead, memory is released in bulk, either back to a previously taken
+ * mark (`tk_arena_rewind`) or all at once (`tk_arena_reset`). Both are O(1)
+ * and keep the chunks for reuse.
+ *
+ * `tk_arena_allocator` adapts an arena to the `tk_allocator_t` interface so
+ * containers can be created inside it. A whole request's worth of vectors
+ * and lists can then be discarded with one reset instead of one destroy per
+ * container:
+ *
+ * @code
+ * tk_allocator_t scratch = tk_arena_allocator(arena);
+ * tk_arena_mark_t mark = tk_arena_mark(arena);
+ * tk_vec_t *ids = tk_vec_create_with_allocator(sizeof(int), &scratch);
+ * // ... use ids, never call tk_vec_destroy ...
+ * tk_arena_rewind(arena, mark); // 'ids' is gone
+ * @endcode
+ */
+#ifndef TOOLKIT_CORE_ARENA_H
+#define TOOLKIT_CORE_ARENA_H
+
+#include <tk/core/allocator.h>
+#include <tk/core/types.h>
+
+// Forward declaration of the opaque structure
+typedef struct tk_arena_t tk_arena_t;
+
+/**
+ * @brief A saved arena position, produced by `tk_arena_mark`.
+ * Treat the fields as private.
+ */
+typedef struct {
+  void *chunk;   // Chunk that was current when the mark was taken
+  size_t offset; // Bump offset within that chunk
+} tk_arena_mark_t;
+
+// --- Lifecycle Functions ---
+
+/**
+ * @brief Creates a new, empty arena. No chunk is allocated until first use.
+ * @param chunk_size The usable size in bytes of each chunk. Requests larger
+ * than this get a dedicated chunk. Pass 0 for a default of 64 KiB.
+ * @param allocator The backing allocator chunks (and the arena handle) come
+ * from. Must not be NULL.
+ * @return A pointer to the new arena, or NULL if memory allocation fails.
+ */
+tk_arena_t *tk_arena_create(size_t chunk_size,
+                            const tk_allocator_t *allocator);
+
+/**
+ * @brief Destroys an arena and returns all of its chunks to the backing
+ * allocator. Every block allocated from the arena becomes invalid.
+ * @param arena A pointer to the arena. If NULL, the function does nothing.
+ */
+void tk_arena_destroy(tk_arena_t *arena);
+
+// --- Allocation Functions ---
+
+/**
+ * @brief Allocates `size` bytes from the arena, aligned to 16 bytes.
+ * @param arena A pointer to the arena.
+ * @param size The number of bytes to allocate. Must be greater than 0.
+ * @return A pointer to the block, or NULL if a new chunk could not be
+ * allocated.
+ */
+void *tk_arena_alloc(tk_arena_t *arena, size_t size);
+
+/**
+ * @brief Returns the current arena position, to be restored later with
+ * `tk_arena_rewind`.
+ * @param arena A constant pointer to the arena.
+ * @return The saved position.
+ */
+tk_arena_mark_t tk_arena_mark(const tk_arena_t *arena);
+
+/**
+ * @brief Releases every allocation made since `mark` was taken. O(1).
+ * Marks taken after `mark` become invalid.
+ * @param arena A pointer to the arena.
+ * @param mark A position previously returned by `tk_arena_mark` on this
+ * arena.
+ */
+void tk_arena_rewind(tk_arena_t *arena, tk_arena_mark_t mark);
+
+/**
+ * @brief Releases every allocation at once, keeping the chunks for reuse.
+ * O(1). All marks become invalid.
+ * @param arena A pointer to the arena.
+ */
+void tk_arena_reset(tk_arena_t *arena);
+
+/**
+ * @brief Returns the number of bytes currently handed out, including
+ * alignment padding and the unused tails of chunks that were skipped.
+ * @param arena A constant pointer to the arena.
+ * @return The number of bytes in use.
+ */
+size_t tk_arena_bytes_used(const tk_arena_t *arena);
+
+/**
+ * @brief Adapts an arena to the `tk_allocator_t` interface.
+ *
+ * `free` only reclaims the most recent allocation and `realloc` grows the
+ * most recent allocation in place when the chunk has room; everything else
+ * is reclaimed by `tk_arena_rewind` / `tk_arena_reset`. Containers using
+ * this allocator must not be destroyed after the memory they live in has
+ * been rewound or reset.
+ *
+ * @param arena A pointer to the arena; it must outlive every container
+ * using the returned allocator.
+ * @return An allocator whose context is `arena`.
+ */
+tk_allocator_t tk_arena_allocator(tk_arena_t *arena);
+
+#endif // TOOLKIT_CORE_ARENA_H
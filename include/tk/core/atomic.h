@@ -0,0 +1,78 @@
+/**
+ * @file atomic.h
+ * @brief Minimal atomic operations for the toolkit's concurrent code.
+ *
+ * @details
+ * The toolkit targets C99, which has no `<stdatomic.h>`. These macros map to
+ * the GCC/Clang `__atomic` builtins, which operate on plain integer and
+ * pointer objects and take an explicit memory order.
+ *
+ * Memory orders: `TK_ATOMIC_RELAXED`, `TK_ATOMIC_ACQUIRE`,
+ * `TK_ATOMIC_RELEASE`, `TK_ATOMIC_ACQ_REL`, `TK_ATOMIC_SEQ_CST`.
+ */
+#ifndef TOOLKIT_CORE_ATOMIC_H
+#define TOOLKIT_CORE_ATOMIC_H
+
+#if !defined(__GNUC__) && !defined(__clang__)
+#error "tk/core/atomic.h requires the GCC/Clang __atomic builtins"
+#endif
+
+#define TK_ATOMIC_RELAXED __ATOMIC_RELAXED
+#define TK_ATOMIC_ACQUIRE __ATOMIC_ACQUIRE
+#define TK_ATOMIC_RELEASE __ATOMIC_RELEASE
+#define TK_ATOMIC_ACQ_REL __ATOMIC_ACQ_REL
+#define TK_ATOMIC_SEQ_CST __ATOMIC_SEQ_CST
+
+/**
+ * @brief Atomically loads `*ptr`.
+ */
+#define TK_ATOMIC_LOAD(ptr, order) __atomic_load_n((ptr), (order))
+
+/**
+ * @brief Atomically stores `value` into `*ptr`.
+ */
+#define TK_ATOMIC_STORE(ptr, value, order)                                     \
+  __atomic_store_n((ptr), (value), (order))
+
+/**
+ * @brief Atomically adds `value` to `*ptr` and returns the previous value.
+ */
+#define TK_ATOMIC_FETCH_ADD(ptr, value, order)                                 \
+  __atomic_fetch_add((ptr), (value), (order))
+
+/**
+ * @brief Atomically subtracts `value` from `*ptr` and returns the previous
+ * value.
+ */
+#define TK_ATOMIC_FETCH_SUB(ptr, value, order)                                 \
+  __atomic_fetch_sub((ptr), (value), (order))
+
+/**
+ * @brief Atomically replaces `*ptr` with `value` and returns the previous
+ * value.
+ */
+#define TK_ATOMIC_EXCHANGE(ptr, value, order)                                  \
+  __atomic_exchange_n((ptr), (value), (order))
+
+/**
+ * @brief Strong compare-and-swap: if `*ptr == *expected`, stores `desired`
+ * and returns `true`; otherwise loads `*ptr` into `*expected` and returns
+ * `false`.
+ */
+#define TK_ATOMIC_CAS(ptr, expected, desired, success, failure)                \
+  __atomic_compare_exchange_n((ptr), (expected), (desired), 0, (success),      \
+                              (failure))
+
+/**
+ * @brief Weak compare-and-swap; may fail spuriously, for use in loops.
+ */
+#define TK_ATOMIC_CAS_WEAK(ptr, expected, desired, success, failure)           \
+  __atomic_compare_exchange_n((ptr), (expected), (desired), 1, (success),      \
+                              (failure))
+
+/**
+ * @brief A full memory fence with the given order.
+ */
+#define TK_ATOMIC_FENCE(order) __atomic_thread_fence(order)
+
+#endif // TOOLKIT_CORE_ATOMIC_H
@@ -58,6 +58,19 @@ typedef enum {
    */
   TK_E_NOT_FOUND,
 
+  /**
+   * @brief An insertion was attempted into a bounded container that has no
+   * room left. (e.g., pushing onto a full ring buffer).
+   */
+  TK_E_FULL,
+
+  // --- System Errors ---
+  /**
+   * @brief An operating system I/O call failed (e.g., extending or syncing
+   * a file). `errno` holds the details.
+   */
+  TK_E_IO,
+
 } tk_error_t;
 
 /**
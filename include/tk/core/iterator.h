@@ -20,6 +20,7 @@
 #ifndef TOOLKIT_CORE_ITERATOR_H
 #define TOOLKIT_CORE_ITERATOR_H
 
+#include <stddef.h> // For ptrdiff_t
 #include <tk/core/macros.h>
 #include <tk/core/types.h>
 
@@ -104,6 +105,62 @@ typedef struct {
    */
   void (*retreat)(tk_iterator_t *self); // <-- Add this line
 
+  /**
+   * @brief (Optional) Exposes the storage of a contiguous iterator.
+   * Only set by iterators whose elements live in one array at a fixed
+   * stride (e.g., tk_vec_t), which lets algorithms replace the per-element
+   * vtable calls with a plain pointer loop. NULL otherwise.
+   * @param self A constant pointer to the iterator.
+   * @param stride Receives the distance in bytes between two elements.
+   * @return The address of the element 'self' points to (one past the last
+   * element for an end iterator).
+   */
+  void *(*contiguous)(const tk_iterator_t *self, size_t *stride);
+
+  /**
+   * @brief (Optional) Moves the iterator 'self' by 'n' elements in O(1).
+   * MUST be implemented if category is TK_ITER_RANDOM_ACCESS. Can be NULL
+   * otherwise.
+   * @param self A pointer to the iterator to be moved.
+   * @param n The number of elements to move (negative moves backward).
+   */
+  void (*seek)(tk_iterator_t *self, ptrdiff_t n);
+
+  /**
+   * @brief (Optional) Returns the number of elements from 'from' to 'to' in
+   * O(1). MUST be implemented if category is TK_ITER_RANDOM_ACCESS. Can be
+   * NULL otherwise.
+   * @param from A constant pointer to the first iterator.
+   * @param to A constant pointer to the second iterator, of the same range.
+   * @return The signed distance (negative if 'to' precedes 'from').
+   */
+  ptrdiff_t (*distance)(const tk_iterator_t *from, const tk_iterator_t *to);
+
+  /**
+   * @brief (Optional) Returns the element 'n' positions away from 'self' in
+   * O(1), without moving the iterator. MUST be implemented if category is
+   * TK_ITER_RANDOM_ACCESS. Can be NULL otherwise.
+   * @param self A constant pointer to the iterator.
+   * @param n The offset of the element (negative looks backward).
+   * @return A `void*` pointer to the element.
+   */
+  void *(*at_offset)(const tk_iterator_t *self, ptrdiff_t n);
+
+  /**
+   * @brief (Optional) Hands out the next elements in a single call.
+   * Stores pointers to up to 'max' elements, from 'self' up to (but not
+   * including) 'end', in 'ptrs' and advances 'self' past them, so an
+   * algorithm pays one indirect call per block instead of two per element.
+   * Can be NULL.
+   * @param self A pointer to the iterator to advance.
+   * @param end A constant pointer to the end of the range.
+   * @param ptrs Receives the element pointers.
+   * @param max The capacity of 'ptrs'.
+   * @return The number of pointers stored (0 once 'self' equals 'end').
+   */
+  size_t (*next_block)(tk_iterator_t *self, const tk_iterator_t *end,
+                       void **ptrs, size_t max);
+
 } tk_iterator_vtable_t;
 
 /**
@@ -112,7 +169,12 @@ typedef struct {
  *
  * This ensures all function pointers and metadata fields are set,
  * preventing incomplete or inconsistent vtable definitions as the
- * interface evolves.
+ * interface evolves. It covers forward and bidirectional iterators;
+ * random-access ones use `TK_DEFINE_RANDOM_ACCESS_ITERATOR_VTABLE` or
+ * `TK_DEFINE_CONTIGUOUS_ITERATOR_VTABLE`, which also wire up the O(1)
+ * jump functions. The optional 'next_block' slot is left NULL, so
+ * `tk_iter_next_block` steps one element at a time; iterators that provide
+ * a batch function use `TK_DEFINE_BLOCK_ITERATOR_VTABLE` instead.
  *
  * @param PREFIX The unique prefix for the iterator's static functions
  * (e.g., `tk_vec_iter`).
@@ -130,6 +192,123 @@ typedef struct {
    .clone = PREFIX##_clone,                                                    \
    .retreat = ((CATEGORY) >= TK_ITER_BIDIRECTIONAL) ? PREFIX##_retreat : NULL}
 
+/**
+ * @brief Defines the vtable of a forward or bidirectional iterator that
+ * hands out elements in blocks.
+ *
+ * Like `TK_DEFINE_ITERATOR_VTABLE`, but additionally wires up the
+ * optional `PREFIX##_next_block` batch function.
+ *
+ * @param PREFIX The unique prefix for the iterator's static functions.
+ * @param CATEGORY The `tk_iter_category_t` for this iterator.
+ * @param TYPENAME A string literal for this iterator's type.
+ */
+#define TK_DEFINE_BLOCK_ITERATOR_VTABLE(PREFIX, CATEGORY, TYPENAME)            \
+  {.category = (CATEGORY),                                                     \
+   .type_name = (TYPENAME),                                                    \
+   .advance = PREFIX##_advance,                                                \
+   .get = PREFIX##_get,                                                        \
+   .equal = PREFIX##_equal,                                                    \
+   .clone = PREFIX##_clone,                                                    \
+   .retreat = ((CATEGORY) >= TK_ITER_BIDIRECTIONAL) ? PREFIX##_retreat : NULL, \
+   .next_block = PREFIX##_next_block}
+
+/**
+ * @brief Defines the vtable of a random-access iterator.
+ *
+ * Like `TK_DEFINE_ITERATOR_VTABLE`, but additionally wires up the
+ * `PREFIX##_seek`, `PREFIX##_distance` and `PREFIX##_at_offset` functions
+ * that every random-access iterator must provide. The optional
+ * 'next_block' slot is left NULL;
+ * `TK_DEFINE_BLOCK_RANDOM_ACCESS_ITERATOR_VTABLE` also wires it up.
+ *
+ * @param PREFIX The unique prefix for the iterator's static functions.
+ * @param TYPENAME A string literal for this iterator's type.
+ */
+#define TK_DEFINE_RANDOM_ACCESS_ITERATOR_VTABLE(PREFIX, TYPENAME)              \
+  {.category = TK_ITER_RANDOM_ACCESS,                                          \
+   .type_name = (TYPENAME),                                                    \
+   .advance = PREFIX##_advance,                                                \
+   .get = PREFIX##_get,                                                        \
+   .equal = PREFIX##_equal,                                                    \
+   .clone = PREFIX##_clone,                                                    \
+   .retreat = PREFIX##_retreat,                                                \
+   .seek = PREFIX##_seek,                                                      \
+   .distance = PREFIX##_distance,                                              \
+   .at_offset = PREFIX##_at_offset}
+
+/**
+ * @brief Defines the vtable of a random-access iterator that hands out
+ * elements in blocks.
+ *
+ * Like `TK_DEFINE_RANDOM_ACCESS_ITERATOR_VTABLE`, but additionally wires up
+ * the optional `PREFIX##_next_block` batch function.
+ *
+ * @param PREFIX The unique prefix for the iterator's static functions.
+ * @param TYPENAME A string literal for this iterator's type.
+ */
+#define TK_DEFINE_BLOCK_RANDOM_ACCESS_ITERATOR_VTABLE(PREFIX, TYPENAME)        \
+  {.category = TK_ITER_RANDOM_ACCESS,                                          \
+   .type_name = (TYPENAME),                                                    \
+   .advance = PREFIX##_advance,                                                \
+   .get = PREFIX##_get,                                                        \
+   .equal = PREFIX##_equal,                                                    \
+   .clone = PREFIX##_clone,                                                    \
+   .retreat = PREFIX##_retreat,                                                \
+   .seek = PREFIX##_seek,                                                      \
+   .distance = PREFIX##_distance,                                              \
+   .at_offset = PREFIX##_at_offset,                                            \
+   .next_block = PREFIX##_next_block}
+
+/**
+ * @brief Defines the vtable of a random-access iterator over contiguous
+ * storage.
+ *
+ * Like `TK_DEFINE_RANDOM_ACCESS_ITERATOR_VTABLE`, but additionally wires up
+ * the optional `PREFIX##_contiguous` function, enabling the fast paths of
+ * the generic algorithms. The optional 'next_block' slot is left NULL;
+ * `TK_DEFINE_BLOCK_CONTIGUOUS_ITERATOR_VTABLE` also wires it up.
+ *
+ * @param PREFIX The unique prefix for the iterator's static functions.
+ * @param TYPENAME A string literal for this iterator's type.
+ */
+#define TK_DEFINE_CONTIGUOUS_ITERATOR_VTABLE(PREFIX, TYPENAME)                 \
+  {.category = TK_ITER_RANDOM_ACCESS,                                          \
+   .type_name = (TYPENAME),                                                    \
+   .advance = PREFIX##_advance,                                                \
+   .get = PREFIX##_get,                                                        \
+   .equal = PREFIX##_equal,                                                    \
+   .clone = PREFIX##_clone,                                                    \
+   .retreat = PREFIX##_retreat,                                                \
+   .contiguous = PREFIX##_contiguous,                                          \
+   .seek = PREFIX##_seek,                                                      \
+   .distance = PREFIX##_distance,                                              \
+   .at_offset = PREFIX##_at_offset}
+
+/**
+ * @brief Defines the vtable of a contiguous random-access iterator that
+ * also hands out elements in blocks.
+ *
+ * Like `TK_DEFINE_CONTIGUOUS_ITERATOR_VTABLE`, but additionally wires up
+ * the optional `PREFIX##_next_block` batch function.
+ *
+ * @param PREFIX The unique prefix for the iterator's static functions.
+ * @param TYPENAME A string literal for this iterator's type.
+ */
+#define TK_DEFINE_BLOCK_CONTIGUOUS_ITERATOR_VTABLE(PREFIX, TYPENAME)           \
+  {.category = TK_ITER_RANDOM_ACCESS,                                          \
+   .type_name = (TYPENAME),                                                    \
+   .advance = PREFIX##_advance,                                                \
+   .get = PREFIX##_get,                                                        \
+   .equal = PREFIX##_equal,                                                    \
+   .clone = PREFIX##_clone,                                                    \
+   .retreat = PREFIX##_retreat,                                                \
+   .contiguous = PREFIX##_contiguous,                                          \
+   .seek = PREFIX##_seek,                                                      \
+   .distance = PREFIX##_distance,                                              \
+   .at_offset = PREFIX##_at_offset,                                            \
+   .next_block = PREFIX##_next_block}
+
 /**
  * @brief The unified, polymorphic iterator type.
  *
@@ -179,6 +358,11 @@ tk_iterator_vtable_validate(const tk_iterator_vtable_t *vtable) {
   TK_ASSERT(vtable->type_name != NULL);
   TK_ASSERT((vtable->category < TK_ITER_BIDIRECTIONAL) ||
             (vtable->retreat != NULL));
+  TK_ASSERT((vtable->category < TK_ITER_RANDOM_ACCESS) ||
+            (vtable->seek != NULL && vtable->distance != NULL &&
+             vtable->at_offset != NULL));
+  TK_ASSERT((vtable->contiguous == NULL) ||
+            (vtable->category == TK_ITER_RANDOM_ACCESS));
 }
 
 /**
@@ -239,4 +423,103 @@ static inline void tk_iter_prev(tk_iterator_t *iter) {
   iter->vtable->retreat(iter);
 }
 
+/**
+ * @brief Returns the storage address of a contiguous iterator.
+ * (Calls the vtable's optional 'contiguous' function).
+ * @param iter A constant pointer to the iterator.
+ * @param stride Receives the distance in bytes between two elements.
+ * @return The address of the current element, or NULL if the iterator does
+ * not expose contiguous storage (in which case 'stride' is untouched).
+ */
+static inline void *tk_iter_contiguous(const tk_iterator_t *iter,
+                                       size_t *stride) {
+  return iter->vtable->contiguous ? iter->vtable->contiguous(iter, stride)
+                                  : NULL;
+}
+
+/**
+ * @brief Fetches pointers to up to `max` elements of [iter, end) and
+ * advances `iter` past them.
+ * (Calls the vtable's optional 'next_block' function, or steps one element
+ * at a time if there is none).
+ * @param iter A pointer to the iterator to advance.
+ * @param end A constant pointer to the end of the range.
+ * @param ptrs Receives the element pointers.
+ * @param max The capacity of `ptrs`.
+ * @return The number of pointers stored (0 once `iter` equals `end`).
+ */
+static inline size_t tk_iter_next_block(tk_iterator_t *iter,
+                                        const tk_iterator_t *end, void **ptrs,
+                                        size_t max) {
+  if (iter->vtable->next_block)
+    return iter->vtable->next_block(iter, end, ptrs, max);
+
+  size_t n = 0;
+  for (; n < max && !tk_iter_equal(iter, end); tk_iter_next(iter))
+    ptrs[n++] = tk_iter_get(iter);
+  return n;
+}
+
+/**
+ * @brief Moves the iterator by `n` elements.
+ * O(1) for random-access iterators (the vtable's 'seek'); otherwise steps
+ * one element at a time, which requires a bidirectional iterator for a
+ * negative `n`.
+ * @param iter A pointer to the iterator to move.
+ * @param n The number of elements to move (negative moves backward).
+ */
+static inline void tk_iter_advance_n(tk_iterator_t *iter, ptrdiff_t n) {
+  if (iter->vtable->seek) {
+    iter->vtable->seek(iter, n);
+    return;
+  }
+  for (; n > 0; --n)
+    tk_iter_next(iter);
+  for (; n < 0; ++n)
+    tk_iter_prev(iter);
+}
+
+/**
+ * @brief Returns the number of elements in [first, last).
+ * O(1) for random-access iterators (the vtable's 'distance'); otherwise
+ * steps a copy of `first` until it reaches `last`, which must then be
+ * reachable from `first`.
+ * @param first A constant pointer to the first iterator.
+ * @param last A constant pointer to the end of the range.
+ * @return The distance (negative only for random-access iterators whose
+ * `last` precedes `first`).
+ */
+static inline ptrdiff_t tk_iter_distance(const tk_iterator_t *first,
+                                         const tk_iterator_t *last) {
+  TK_ASSERT(first->vtable == last->vtable &&
+            "tk_iter_distance: iterators of different types.");
+  if (first->vtable->distance)
+    return first->vtable->distance(first, last);
+
+  tk_iterator_t it;
+  tk_iter_clone(&it, first);
+  ptrdiff_t n = 0;
+  for (; !tk_iter_equal(&it, last); tk_iter_next(&it))
+    ++n;
+  return n;
+}
+
+/**
+ * @brief Returns the element `n` positions away from the iterator, without
+ * moving it. O(1) for random-access iterators (the vtable's 'at_offset');
+ * otherwise a copy of the iterator is stepped there.
+ * @param iter A constant pointer to the iterator.
+ * @param n The offset of the element (negative looks backward).
+ * @return A `void*` pointer to the element.
+ */
+static inline void *tk_iter_at(const tk_iterator_t *iter, ptrdiff_t n) {
+  if (iter->vtable->at_offset)
+    return iter->vtable->at_offset(iter, n);
+
+  tk_iterator_t it;
+  tk_iter_clone(&it, iter);
+  tk_iter_advance_n(&it, n);
+  return tk_iter_get(&it);
+}
+
 #endif // TOOLKIT_CORE_ITERATOR_H
@@ -34,10 +34,11 @@
  * @return A pointer of type 'type *' to the containing struct.
  */
 #if defined(__GNUC__) || defined(__clang__)
-// GCC/Clang version with compile-time type checking
+// GCC/Clang version with compile-time type checking. Spelled with the
+// reserved __typeof__ / __extension__ forms so it also builds with -std=c99.
 #define container_of(ptr, type, member)                                        \
-  ({                                                                           \
-    const typeof(((type *)0)->member) *__mptr = (ptr);                         \
+  __extension__({                                                              \
+    const __typeof__(((type *)0)->member) *__mptr = (ptr);                     \
     (type *)((char *)__mptr - offsetof(type, member));                         \
   })
 #else
@@ -46,4 +47,58 @@
   ((type *)((char *)(ptr) - offsetof(type, member)))
 #endif
 
+/**
+ * @brief Declares a variable with thread storage duration.
+ *
+ * C99 has no standard spelling for thread-local storage, so this maps to the
+ * compiler extension (`__thread` on GCC/Clang, `__declspec(thread)` on MSVC)
+ * and to `_Thread_local` on other C11 compilers.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define TK_THREAD_LOCAL __thread
+#elif defined(_MSC_VER)
+#define TK_THREAD_LOCAL __declspec(thread)
+#else
+#define TK_THREAD_LOCAL _Thread_local
+#endif
+
+/**
+ * @brief Counts the trailing zero bits of a non-zero 64-bit value.
+ *
+ * Maps to the compiler builtin on GCC/Clang (a single instruction on most
+ * targets) and to a portable loop elsewhere. The result is undefined for 0.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define TK_CTZ64(x) ((unsigned)__builtin_ctzll((unsigned long long)(x)))
+#else
+static inline unsigned tk_ctz64_portable(uint64_t x) {
+  unsigned n = 0;
+  while (!(x & 1)) {
+    x >>= 1;
+    n++;
+  }
+  return n;
+}
+#define TK_CTZ64(x) tk_ctz64_portable((uint64_t)(x))
+#endif
+
+/**
+ * @brief Counts the set bits of a 64-bit value.
+ *
+ * Maps to the compiler builtin on GCC/Clang and to a branch-free bit count
+ * elsewhere.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define TK_POPCOUNT64(x)                                                       \
+  ((unsigned)__builtin_popcountll((unsigned long long)(x)))
+#else
+static inline unsigned tk_popcount64_portable(uint64_t x) {
+  x = x - ((x >> 1) & 0x5555555555555555ull);
+  x = (x & 0x3333333333333333ull) + ((x >> 2) & 0x3333333333333333ull);
+  x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0full;
+  return (unsigned)((x * 0x0101010101010101ull) >> 56);
+}
+#define TK_POPCOUNT64(x) tk_popcount64_portable((uint64_t)(x))
+#endif
+
 #endif // TOOLKIT_CORE_MACROS_H
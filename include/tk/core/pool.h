@@ -0,0 +1,174 @@
+/**
+ * @file pool.h
+ * @brief Public interface for the toolkit's work-stealing thread pool.
+ *
+ * @details
+ * A `tk_pool_t` owns a fixed set of worker threads. Each worker has its own
+ * Chase-Lev deque: tasks spawned from inside a task are pushed to and popped
+ * from the bottom of the current worker's deque (LIFO, cache-warm), while
+ * idle workers steal from the top of other workers' deques (FIFO, oldest and
+ * therefore usually largest work first). Tasks submitted from outside the
+ * pool go through a shared injection queue. Workers with nothing to do sleep
+ * on a condition variable.
+ *
+ * Completion is tracked with a `tk_wait_group_t`, a counter of outstanding
+ * tasks. `tk_pool_wait` runs pool tasks on the waiting thread until the
+ * group drains, so waiting from inside a task (nested parallelism) cannot
+ * deadlock the pool; when there is nothing to run, it sleeps until new work
+ * or the group's last task wakes it, instead of spinning.
+ *
+ * @code
+ * tk_wait_group_t wg;
+ * tk_wait_group_init(&wg);
+ * tk_pool_submit(pool, compress_file, path_a, &wg);
+ * tk_pool_submit(pool, compress_file, path_b, &wg);
+ * tk_pool_wait(pool, &wg);
+ * @endcode
+ */
+#ifndef TOOLKIT_CORE_POOL_H
+#define TOOLKIT_CORE_POOL_H
+
+#include <tk/core/allocator.h>
+#include <tk/core/error.h>
+#include <tk/core/types.h>
+
+// Forward declaration of the opaque structure
+typedef struct tk_pool_t tk_pool_t;
+
+/**
+ * @brief A task submitted with `tk_pool_submit`.
+ * @param ctx The context pointer passed at submission.
+ */
+typedef void (*tk_task_fn_t)(void *ctx);
+
+/**
+ * @brief The body of a `tk_pool_parallel_for` loop.
+ * @param first The first index of the sub-range to process.
+ * @param last One past the last index of the sub-range.
+ * @param ctx The context pointer passed to `tk_pool_parallel_for`.
+ */
+typedef void (*tk_range_fn_t)(size_t first, size_t last, void *ctx);
+
+/**
+ * @brief Counts outstanding tasks. Lives wherever the caller puts it
+ * (usually the stack); treat the field as private.
+ */
+typedef struct {
+  size_t pending; // (atomic) Tasks added but not yet done
+} tk_wait_group_t;
+
+// --- Lifecycle Functions ---
+
+/**
+ * @brief Creates a pool and starts its worker threads.
+ * @param num_threads The number of workers, or 0 for one per online CPU.
+ * @return A pointer to the new pool, or NULL if memory allocation or thread
+ * creation fails.
+ */
+tk_pool_t *tk_pool_create(size_t num_threads);
+
+/**
+ * @brief Creates a pool that obtains all of its memory (handle, deques and
+ * per-task records) from a custom allocator.
+ * @param num_threads The number of workers, or 0 for one per online CPU.
+ * @param allocator The allocator to use. Must not be NULL and must be safe
+ * to call from several threads at once.
+ * @return A pointer to the new pool, or NULL on failure.
+ */
+tk_pool_t *tk_pool_create_with_allocator(size_t num_threads,
+                                         const tk_allocator_t *allocator);
+
+/**
+ * @brief Runs every task still queued, stops the workers and frees the pool.
+ * Must not be called from one of the pool's own tasks.
+ * @param pool A pointer to the pool. If NULL, the function does nothing.
+ */
+void tk_pool_destroy(tk_pool_t *pool);
+
+/**
+ * @brief Returns the process-wide shared pool, creating it (one worker per
+ * online CPU) on first use. It lives until the process exits.
+ * @return The shared pool, or NULL if it could not be created.
+ */
+tk_pool_t *tk_pool_default(void);
+
+/**
+ * @brief Returns the number of worker threads of a pool.
+ * @param pool A constant pointer to the pool.
+ * @return The worker count.
+ */
+size_t tk_pool_num_threads(const tk_pool_t *pool);
+
+// --- Wait Groups ---
+
+/**
+ * @brief Initializes a wait group with no outstanding tasks.
+ * @param wg A pointer to the wait group.
+ */
+void tk_wait_group_init(tk_wait_group_t *wg);
+
+/**
+ * @brief Adds `n` outstanding tasks to a wait group. `tk_pool_submit` does
+ * this itself; call it directly only for work tracked by hand.
+ * @param wg A pointer to the wait group.
+ * @param n The number of tasks to add.
+ */
+void tk_wait_group_add(tk_wait_group_t *wg, size_t n);
+
+/**
+ * @brief Marks one task of a wait group as done.
+ *
+ * Pool tasks call this for their group themselves, and wake any thread
+ * blocked in `tk_pool_wait`. A group completed by hand through this function
+ * is only noticed by a sleeping waiter at its next periodic re-check, a few
+ * milliseconds later.
+ *
+ * @param wg A pointer to the wait group.
+ */
+void tk_wait_group_done(tk_wait_group_t *wg);
+
+/**
+ * @brief Waits until a wait group has no outstanding tasks, running pool
+ * tasks on the calling thread in the meantime.
+ * @param pool The pool the tasks were submitted to.
+ * @param wg A pointer to the wait group.
+ */
+void tk_pool_wait(tk_pool_t *pool, tk_wait_group_t *wg);
+
+// --- Task Functions ---
+
+/**
+ * @brief Queues `fn(ctx)` for execution on the pool.
+ *
+ * From inside a pool task the new task goes to the current worker's deque;
+ * from any other thread it goes to the shared injection queue.
+ *
+ * @param pool A pointer to the pool.
+ * @param fn The task function.
+ * @param ctx The context passed to `fn`.
+ * @param wg A wait group to add the task to, or NULL.
+ * @return TK_SUCCESS, or TK_E_NOMEM if the task record could not be
+ * allocated (the task is not queued and `wg` is unchanged).
+ */
+tk_error_t tk_pool_submit(tk_pool_t *pool, tk_task_fn_t fn, void *ctx,
+                          tk_wait_group_t *wg);
+
+/**
+ * @brief Runs `fn` over [begin, end) in parallel and waits for it.
+ *
+ * The range is split in halves recursively, each split spawning a stealable
+ * task, until sub-ranges hold at most `grain` indices; `fn` is then called
+ * once per sub-range. If a task cannot be allocated, the remaining range is
+ * processed by the current thread.
+ *
+ * @param pool A pointer to the pool.
+ * @param begin The first index.
+ * @param end One past the last index.
+ * @param grain The largest sub-range handed to `fn` (0 is treated as 1).
+ * @param fn The loop body.
+ * @param ctx The context passed to `fn`.
+ */
+void tk_pool_parallel_for(tk_pool_t *pool, size_t begin, size_t end,
+                          size_t grain, tk_range_fn_t fn, void *ctx);
+
+#endif // TOOLKIT_CORE_POOL_H
@@ -0,0 +1,80 @@
+/**
+ * @file slab.h
+ * @brief Public interface for the toolkit's fixed-size block (slab) pool.
+ *
+ * @details
+ * A `tk_slab_t` hands out blocks of a single, fixed size. Blocks are carved
+ * sequentially out of large chunks obtained from a `tk_allocator_t`, and
+ * freed blocks are recycled through an intrusive free list threaded through
+ * the blocks themselves, so steady-state alloc/free never touches the
+ * underlying allocator. Memory is only returned to the allocator, a whole
+ * chunk at a time, when the slab is destroyed.
+ *
+ * Containers use a slab to keep their nodes densely packed (e.g. a pooled
+ * `tk_list_t`).
+ */
+#ifndef TOOLKIT_CORE_SLAB_H
+#define TOOLKIT_CORE_SLAB_H
+
+#include <tk/core/allocator.h>
+#include <tk/core/types.h>
+
+// Forward declaration of the opaque structure
+typedef struct tk_slab_t tk_slab_t;
+
+/**
+ * @brief Creates a new slab pool.
+ *
+ * The block size is rounded up to a multiple of 16 bytes (and to at least
+ * the size of a pointer), so every block is suitably aligned for any
+ * fundamental type.
+ *
+ * @param block_size The size in bytes of each block. Must be greater than 0.
+ * @param blocks_per_chunk The number of blocks carved from each chunk. Pass 0
+ * to let the slab pick a chunk of roughly 4 KiB.
+ * @param allocator The allocator chunks (and the slab handle) come from. Must
+ * not be NULL.
+ * @return A pointer to the new slab, or NULL if memory allocation fails.
+ */
+tk_slab_t *tk_slab_create(size_t block_size, size_t blocks_per_chunk,
+                          const tk_allocator_t *allocator);
+
+/**
+ * @brief Destroys a slab and releases all of its chunks.
+ * Every block handed out by the slab becomes invalid.
+ * @param slab A pointer to the slab to destroy. If NULL, the function does
+ * nothing.
+ */
+void tk_slab_destroy(tk_slab_t *slab);
+
+/**
+ * @brief Allocates one block. O(1); allocates a new chunk only when the free
+ * list and the current chunk are both exhausted.
+ * @param slab A pointer to the slab.
+ * @return A pointer to an uninitialized block, or NULL if a new chunk could
+ * not be allocated.
+ */
+void *tk_slab_alloc(tk_slab_t *slab);
+
+/**
+ * @brief Returns a block to the slab for reuse. O(1).
+ * @param slab A pointer to the slab the block was allocated from.
+ * @param block The block to free. If NULL, the function does nothing.
+ */
+void tk_slab_free(tk_slab_t *slab, void *block);
+
+/**
+ * @brief Marks every block as free at once, keeping all chunks for reuse.
+ * O(1). Every block handed out by the slab becomes invalid.
+ * @param slab A pointer to the slab.
+ */
+void tk_slab_reset(tk_slab_t *slab);
+
+/**
+ * @brief Returns the (rounded) size of the blocks handed out by the slab.
+ * @param slab A constant pointer to the slab.
+ * @return The block size in bytes.
+ */
+size_t tk_slab_block_size(const tk_slab_t *slab);
+
+#endif // TOOLKIT_CORE_SLAB_H
@@ -0,0 +1,183 @@
+/**
+ * @file stats.h
+ * @brief Opt-in memory statistics and allocation instrumentation for the
+ * toolkit's containers.
+ *
+ * @details
+ * When the library is built with `TK_ENABLE_STATS` (the CMake option
+ * `TOOLKIT_ENABLE_STATS`), every container counts, per container type, the
+ * allocations and frees it makes, the bytes it currently owns, the peak of
+ * that figure, how many of its reallocations had to move the block, and how
+ * many elements it copied. `tk_stats_snapshot` returns the totals.
+ *
+ * Counters are thread-local, so recording is a handful of uncontended
+ * stores with no atomic read-modify-write, even for containers shared by
+ * several threads (such as `tk_ring_t`). A snapshot merges the live
+ * per-thread blocks with the totals of threads that have exited.
+ *
+ * Without `TK_ENABLE_STATS` the recording hooks compile to nothing, the
+ * allocation wrappers below are plain calls into the container's allocator
+ * and `tk_stats_snapshot` reports zeros.
+ *
+ * The counters describe what the containers ask for: a pooled list's nodes
+ * count as allocations even though they come from its slab, and adopting or
+ * detaching a buffer (`tk_vec_from_buffer`, `tk_vec_take_buffer`) counts as
+ * an allocation or a free. `tk_mmvec_t` storage is a file mapping and is not
+ * counted; neither are the header-only typed containers.
+ */
+#ifndef TOOLKIT_CORE_STATS_H
+#define TOOLKIT_CORE_STATS_H
+
+#include <tk/core/allocator.h>
+#include <tk/core/types.h>
+
+/**
+ * @brief The container types statistics are kept for.
+ */
+typedef enum {
+  TK_STATS_VEC,     // tk_vec_t
+  TK_STATS_LIST,    // tk_list_t
+  TK_STATS_DEQUE,   // tk_deque_t
+  TK_STATS_HASHMAP, // tk_hashmap_t
+  TK_STATS_RING,    // tk_ring_t
+  TK_STATS_KIND_COUNT
+} tk_stats_kind_t;
+
+/**
+ * @brief The counters for one container type.
+ */
+typedef struct {
+  uint64_t allocs;         // Blocks obtained (handles included)
+  uint64_t frees;          // Blocks given back
+  uint64_t reallocs;       // Resizes of an existing block
+  uint64_t realloc_moves;  // Resizes that returned a different address
+  uint64_t element_copies; // Elements copied in, out or shifted in place
+  int64_t bytes_live;      // Bytes currently owned
+  int64_t peak_bytes;      // High-water mark of bytes_live
+} tk_stats_counters_t;
+
+/**
+ * @brief A snapshot of every container type's counters, indexed by
+ * `tk_stats_kind_t`.
+ */
+typedef struct {
+  tk_stats_counters_t kinds[TK_STATS_KIND_COUNT];
+} tk_stats_t;
+
+// --- Reading Statistics ---
+
+/**
+ * @brief Checks whether the library was built with statistics.
+ * @return `true` if the containers record statistics, `false` otherwise.
+ */
+tk_bool tk_stats_enabled(void);
+
+/**
+ * @brief Merges the counters of every thread into `out`.
+ *
+ * Each thread's counters are exact; a snapshot taken while other threads
+ * are still allocating sees each of them at some recent point. The peak is
+ * the sum of the per-thread peaks: exact for a single thread, an upper bound
+ * on the true process-wide peak otherwise. Per-thread `bytes_live` can be
+ * negative (a block freed by another thread than the one that allocated it),
+ * but the merged figure is not.
+ *
+ * @param out Receives the counters; all zeros if statistics are disabled.
+ */
+void tk_stats_snapshot(tk_stats_t *out);
+
+/**
+ * @brief Returns a printable name for a container type, such as "vec".
+ * @param kind The container type.
+ * @return A static string, or "unknown" for an invalid value.
+ */
+const char *tk_stats_kind_name(tk_stats_kind_t kind);
+
+// --- Recording Hooks ---
+// Used by the containers. The recording functions are only declared in
+// builds with statistics; call them through the macros. TK_STATS_FREE_N
+// records `count` frees of `bytes` in total.
+
+#if defined(TK_ENABLE_STATS)
+
+void tk_stats_record_alloc(tk_stats_kind_t kind, size_t bytes);
+void tk_stats_record_free(tk_stats_kind_t kind, size_t count, size_t bytes);
+void tk_stats_record_realloc(tk_stats_kind_t kind, size_t old_bytes,
+                             size_t new_bytes, tk_bool moved);
+void tk_stats_record_copies(tk_stats_kind_t kind, size_t count);
+
+#define TK_STATS_ALLOC(kind, bytes) tk_stats_record_alloc((kind), (bytes))
+#define TK_STATS_FREE(kind, bytes) tk_stats_record_free((kind), 1, (bytes))
+#define TK_STATS_FREE_N(kind, count, bytes)                                    \
+  tk_stats_record_free((kind), (count), (bytes))
+#define TK_STATS_REALLOC(kind, old_bytes, new_bytes, moved)                    \
+  tk_stats_record_realloc((kind), (old_bytes), (new_bytes), (moved))
+#define TK_STATS_COPY(kind, count) tk_stats_record_copies((kind), (count))
+
+#else
+
+#define TK_STATS_ALLOC(kind, bytes) ((void)0)
+#define TK_STATS_FREE(kind, bytes) ((void)0)
+#define TK_STATS_FREE_N(kind, count, bytes) ((void)0)
+#define TK_STATS_REALLOC(kind, old_bytes, new_bytes, moved) ((void)0)
+#define TK_STATS_COPY(kind, count) ((void)0)
+
+#endif
+
+// --- Counting Allocation Wrappers ---
+// Drop-in replacements for the tk_allocator_* helpers that also record the
+// call under `kind`. Only successful calls are counted.
+
+/**
+ * @brief `tk_allocator_alloc`, counted under `kind`.
+ */
+static inline void *tk_stats_alloc(tk_stats_kind_t kind,
+                                   const tk_allocator_t *allocator,
+                                   size_t size) {
+  void *block = tk_allocator_alloc(allocator, size);
+#if defined(TK_ENABLE_STATS)
+  if (block)
+    TK_STATS_ALLOC(kind, size);
+#else
+  (void)kind;
+#endif
+  return block;
+}
+
+/**
+ * @brief `tk_allocator_realloc`, counted under `kind`. Resizing NULL counts
+ * as an allocation.
+ */
+static inline void *tk_stats_realloc(tk_stats_kind_t kind,
+                                     const tk_allocator_t *allocator,
+                                     void *ptr, size_t old_size,
+                                     size_t new_size) {
+  void *block = tk_allocator_realloc(allocator, ptr, old_size, new_size);
+#if defined(TK_ENABLE_STATS)
+  if (block && !ptr)
+    TK_STATS_ALLOC(kind, new_size);
+  else if (block)
+    TK_STATS_REALLOC(kind, old_size, new_size, block != ptr);
+#else
+  (void)kind;
+#endif
+  return block;
+}
+
+/**
+ * @brief `tk_allocator_free`, counted under `kind`. Freeing NULL is not
+ * counted.
+ */
+static inline void tk_stats_free(tk_stats_kind_t kind,
+                                 const tk_allocator_t *allocator, void *ptr,
+                                 size_t size) {
+#if defined(TK_ENABLE_STATS)
+  if (ptr)
+    TK_STATS_FREE(kind, size);
+#else
+  (void)kind;
+#endif
+  tk_allocator_free(allocator, ptr, size);
+}
+
+#endif // TOOLKIT_CORE_STATS_H
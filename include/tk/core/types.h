@@ -21,4 +21,27 @@
  */
 typedef bool tk_bool;
 
+/**
+ * @brief A three-way comparison (like `qsort`'s).
+ *
+ * Shared by the sorting algorithms and the ordered containers, so it is
+ * defined once here rather than in each of their headers.
+ *
+ * @return A negative value if `a < b`, 0 if they are equivalent, a positive
+ * value if `a > b`.
+ */
+typedef int (*tk_compare_fn_t)(const void *a, const void *b);
+
+/**
+ * @brief Defines a function pointer type for an element destroyer.
+ *
+ * This function receives a pointer TO the element stored in a container
+ * (e.g., if the container stores `char*`, this function receives a `char**`).
+ * It is responsible for freeing any resources owned by that element. Every
+ * container takes the same type, so it is defined once here.
+ *
+ * @param element_ptr A pointer to the element within the container's storage.
+ */
+typedef void (*tk_element_destroyer_t)(void *element_ptr);
+
 #endif // TOOLKIT_CORE_TYPES_H
@@ -0,0 +1,156 @@
+/**
+ * @file deque.h
+ * @brief Public interface for the toolkit's generic segmented deque.
+ *
+ * @details
+ * `tk_deque_t` is a double-ended queue that stores its elements in
+ * fixed-size contiguous blocks, indexed by a small array of block pointers
+ * (the block map). Compared with `tk_list_t` it has:
+ * - O(1) `push_back` / `push_front` / `pop_back` / `pop_front`, with one
+ *   allocation per block instead of one per element;
+ * - no per-element overhead, and traversal that walks whole blocks of
+ *   consecutive memory;
+ * - O(1) indexed access and random-access iterators.
+ *
+ * Elements are copied in by value, like `tk_vec_t`. Growing or shrinking
+ * the deque at either end never moves the other elements, so a pointer to
+ * an element stays valid until that element is popped (or the deque is
+ * cleared). Iterators refer to positions by index and are invalidated by
+ * any push or pop.
+ */
+#ifndef TOOLKIT_DS_DEQUE_H
+#define TOOLKIT_DS_DEQUE_H
+
+#include <tk/core/allocator.h>
+#include <tk/core/error.h>
+#include <tk/core/iterator.h>
+#include <tk/core/types.h>
+
+// Forward declaration of the opaque structure
+typedef struct tk_deque_t tk_deque_t;
+
+// tk_element_destroyer_t comes from <tk/core/types.h>
+
+// --- Lifecycle Functions ---
+
+/**
+ * @brief Creates a new, empty deque. No block is allocated until the first
+ * push.
+ * @param element_size The size in bytes of each element. Must be greater
+ * than 0.
+ * @return A pointer to the new deque, or NULL if memory allocation fails.
+ */
+tk_deque_t *tk_deque_create(size_t element_size);
+
+/**
+ * @brief Creates a new, empty deque that obtains all of its memory (handle,
+ * block map and blocks) from a custom allocator. See
+ * `tk_vec_create_with_allocator`.
+ * @param element_size The size in bytes of each element. Must be greater
+ * than 0.
+ * @param allocator The allocator to use. Must not be NULL.
+ * @return A pointer to the new deque, or NULL if memory allocation fails.
+ */
+tk_deque_t *tk_deque_create_with_allocator(size_t element_size,
+                                           const tk_allocator_t *allocator);
+
+/**
+ * @brief Destroys a deque and frees all associated memory.
+ * @param deque A pointer to the deque. If NULL, the function does nothing.
+ */
+void tk_deque_destroy(tk_deque_t *deque);
+
+/**
+ * @brief Destroys a deque, calling `destroyer` on every element first.
+ * @param deque A pointer to the deque. If NULL, the function does nothing.
+ * @param destroyer Called with a pointer to each element, front to back.
+ */
+void tk_deque_destroy_full(tk_deque_t *deque, tk_element_destroyer_t destroyer);
+
+// --- Capacity Functions ---
+
+/**
+ * @brief Returns the number of elements in the deque.
+ * @param deque A constant pointer to the deque.
+ * @return The number of elements.
+ */
+size_t tk_deque_size(const tk_deque_t *deque);
+
+/**
+ * @brief Checks if the deque is empty.
+ * @param deque A constant pointer to the deque.
+ * @return `true` if the deque has no elements, `false` otherwise.
+ */
+tk_bool tk_deque_is_empty(const tk_deque_t *deque);
+
+// --- Element Access ---
+
+/**
+ * @brief Returns a pointer to the element at `index` (0 is the front).
+ * @param deque A constant pointer to the deque.
+ * @param index The index of the element.
+ * @return A pointer to the element, or NULL if `index` is out of bounds.
+ */
+void *tk_deque_at(const tk_deque_t *deque, size_t index);
+
+/**
+ * @brief Returns a pointer to the first element, or NULL if empty.
+ */
+void *tk_deque_front(const tk_deque_t *deque);
+
+/**
+ * @brief Returns a pointer to the last element, or NULL if empty.
+ */
+void *tk_deque_back(const tk_deque_t *deque);
+
+// --- Modifiers ---
+
+/**
+ * @brief Copies an element to the back of the deque.
+ * @param deque A pointer to the deque.
+ * @param element A pointer to the element to copy.
+ * @return TK_SUCCESS, or TK_E_NOMEM (the deque is unchanged).
+ */
+tk_error_t tk_deque_push_back(tk_deque_t *deque, const void *element);
+
+/**
+ * @brief Copies an element to the front of the deque.
+ * @param deque A pointer to the deque.
+ * @param element A pointer to the element to copy.
+ * @return TK_SUCCESS, or TK_E_NOMEM (the deque is unchanged).
+ */
+tk_error_t tk_deque_push_front(tk_deque_t *deque, const void *element);
+
+/**
+ * @brief Removes the last element. Does nothing if the deque is empty.
+ */
+void tk_deque_pop_back(tk_deque_t *deque);
+
+/**
+ * @brief Removes the first element. Does nothing if the deque is empty.
+ */
+void tk_deque_pop_front(tk_deque_t *deque);
+
+/**
+ * @brief Removes all elements and frees their blocks. The block map is
+ * kept.
+ */
+void tk_deque_clear(tk_deque_t *deque);
+
+// --- Iterator Functions ---
+
+/**
+ * @brief Returns a random-access iterator to the first element.
+ * @param deque A pointer to the deque.
+ * @return An iterator to the first element.
+ */
+tk_iterator_t tk_deque_begin(tk_deque_t *deque);
+
+/**
+ * @brief Returns a random-access iterator past the last element.
+ * @param deque A pointer to the deque.
+ * @return The end iterator.
+ */
+tk_iterator_t tk_deque_end(tk_deque_t *deque);
+
+#endif // TOOLKIT_DS_DEQUE_H
@@ -0,0 +1,229 @@
+/**
+ * @file hashmap.h
+ * @brief Public interface for the toolkit's generic open-addressing hash map.
+ *
+ * @details
+ * `tk_hashmap_t` maps fixed-size keys to fixed-size values, both copied into
+ * the table by value (the `element_size` convention of `tk_vec_t`, with a
+ * separate size for keys and values). It is a Swiss-table style design:
+ * - slots are grouped 16 at a time, each slot having one control byte that
+ *   is either EMPTY, DELETED, or 7 bits of the key's hash;
+ * - a lookup compares the 7 hash bits against a whole group of control
+ *   bytes at once (SSE2 or NEON when available, a portable loop otherwise)
+ *   and only touches the slots that match;
+ * - keys and values live inline in one flat array, so there is no pointer
+ *   chasing per probe.
+ *
+ * Hashing and key comparison are pluggable. Passing NULL for either uses a
+ * byte-wise default, which is correct for keys without padding or pointers.
+ *
+ * Iteration order is unspecified. Any insertion may rehash the table, which
+ * invalidates pointers to values and all iterators; erasure only invalidates
+ * the erased entry.
+ */
+#ifndef TOOLKIT_DS_HASHMAP_H
+#define TOOLKIT_DS_HASHMAP_H
+
+#include <tk/core/allocator.h>
+#include <tk/core/error.h>
+#include <tk/core/iterator.h>
+#include <tk/core/macros.h>
+#include <tk/core/types.h>
+
+// Forward declaration of the opaque structure.
+typedef struct tk_hashmap_t tk_hashmap_t;
+
+/**
+ * @brief Hash function for keys.
+ * @param key A pointer to the key.
+ * @param key_size The key size the map was created with.
+ * @return The hash of the key. The map mixes the result, so weak hashes
+ * (e.g. the identity on integers) are acceptable.
+ */
+typedef size_t (*tk_hash_fn_t)(const void *key, size_t key_size);
+
+/**
+ * @brief Equality function for keys.
+ * @param key1 A pointer to the first key.
+ * @param key2 A pointer to the second key.
+ * @param key_size The key size the map was created with.
+ * @return `true` if the keys are equal, `false` otherwise.
+ */
+typedef tk_bool (*tk_key_equal_fn_t)(const void *key1, const void *key2,
+                                     size_t key_size);
+
+// --- Default Hashing ---
+
+/**
+ * @brief The default hash: 64-bit FNV-1a over the key's bytes.
+ */
+size_t tk_hash_bytes(const void *key, size_t key_size);
+
+/**
+ * @brief The default key equality: `memcmp` over the key's bytes.
+ */
+tk_bool tk_key_equal_bytes(const void *key1, const void *key2,
+                           size_t key_size);
+
+// --- Lifecycle Functions ---
+
+/**
+ * @brief Creates a new, empty hash map. No table is allocated until the
+ * first insertion.
+ * @param key_size The size in bytes of each key. Must be greater than 0.
+ * @param value_size The size in bytes of each value. May be 0 (set).
+ * @param hash The hash function, or NULL for `tk_hash_bytes`.
+ * @param equal The key equality function, or NULL for `tk_key_equal_bytes`.
+ * @return A pointer to the new map, or NULL if memory allocation fails.
+ */
+tk_hashmap_t *tk_hashmap_create(size_t key_size, size_t value_size,
+                                tk_hash_fn_t hash, tk_key_equal_fn_t equal);
+
+/**
+ * @brief Creates a new, empty hash map that obtains all of its memory from a
+ * custom allocator. See `tk_vec_create_with_allocator`.
+ * @param key_size The size in bytes of each key. Must be greater than 0.
+ * @param value_size The size in bytes of each value. May be 0 (set).
+ * @param hash The hash function, or NULL for `tk_hash_bytes`.
+ * @param equal The key equality function, or NULL for `tk_key_equal_bytes`.
+ * @param allocator The allocator to use. Must not be NULL.
+ * @return A pointer to the new map, or NULL if memory allocation fails.
+ */
+tk_hashmap_t *tk_hashmap_create_with_allocator(size_t key_size,
+                                               size_t value_size,
+                                               tk_hash_fn_t hash,
+                                               tk_key_equal_fn_t equal,
+                                               const tk_allocator_t *allocator);
+
+/**
+ * @brief Destroys a hash map and frees all associated memory.
+ * @param map A pointer to the map. If NULL, the function does nothing.
+ */
+void tk_hashmap_destroy(tk_hashmap_t *map);
+
+// --- Capacity Functions ---
+
+/**
+ * @brief Returns the number of entries in the map.
+ * @param map A constant pointer to the map.
+ * @return The number of entries.
+ */
+size_t tk_hashmap_size(const tk_hashmap_t *map);
+
+/**
+ * @brief Checks if the map is empty.
+ * @param map A constant pointer to the map.
+ * @return `true` if the map has no entries, `false` otherwise.
+ */
+tk_bool tk_hashmap_is_empty(const tk_hashmap_t *map);
+
+/**
+ * @brief Returns the number of slots in the table (a multiple of 16, or 0).
+ * At most 7/8 of them are used before the table grows.
+ * @param map A constant pointer to the map.
+ * @return The slot count.
+ */
+size_t tk_hashmap_capacity(const tk_hashmap_t *map);
+
+/**
+ * @brief Grows the table so that at least `n` entries fit without a rehash.
+ * @param map A pointer to the map.
+ * @param n The number of entries to make room for.
+ * @return TK_SUCCESS, or TK_E_NOMEM if the allocation fails.
+ */
+tk_error_t tk_hashmap_reserve(tk_hashmap_t *map, size_t n);
+
+// --- Lookup & Modifiers ---
+
+/**
+ * @brief Inserts a key/value pair, overwriting the value if the key exists.
+ * @param map A pointer to the map.
+ * @param key A pointer to the key to copy in.
+ * @param value A pointer to the value to copy in (may be NULL if the map was
+ * created with a value size of 0).
+ * @return TK_SUCCESS, or TK_E_NOMEM if the table could not grow.
+ */
+tk_error_t tk_hashmap_insert(tk_hashmap_t *map, const void *key,
+                             const void *value);
+
+/**
+ * @brief Inserts a key/value pair only if the key is absent; an existing
+ * entry keeps its value. Costs a single probe, unlike `tk_hashmap_contains`
+ * followed by `tk_hashmap_insert`.
+ * @param map A pointer to the map.
+ * @param key A pointer to the key to copy in.
+ * @param value A pointer to the value to copy in (may be NULL if the map was
+ * created with a value size of 0).
+ * @param inserted If not NULL, receives `true` if the key was new and has
+ * been inserted, `false` if it was already present (or on failure).
+ * @return TK_SUCCESS, or TK_E_NOMEM if the table could not grow.
+ */
+tk_error_t tk_hashmap_try_insert(tk_hashmap_t *map, const void *key,
+                                 const void *value, tk_bool *inserted);
+
+/**
+ * @brief Looks up the value stored for a key.
+ * @param map A constant pointer to the map.
+ * @param key A pointer to the key to look for.
+ * @return A pointer to the stored value, or NULL if the key is absent. For a
+ * map with a value size of 0, a non-NULL pointer still signals presence.
+ */
+void *tk_hashmap_get(const tk_hashmap_t *map, const void *key);
+
+/**
+ * @brief Checks if the map contains a key.
+ * @param map A constant pointer to the map.
+ * @param key A pointer to the key to look for.
+ * @return `true` if the key is present, `false` otherwise.
+ */
+tk_bool tk_hashmap_contains(const tk_hashmap_t *map, const void *key);
+
+/**
+ * @brief Removes a key and its value.
+ * @param map A pointer to the map.
+ * @param key A pointer to the key to remove.
+ * @return TK_SUCCESS, or TK_E_NOT_FOUND if the key is absent.
+ */
+tk_error_t tk_hashmap_erase(tk_hashmap_t *map, const void *key);
+
+/**
+ * @brief Removes all entries, keeping the table allocated.
+ * @param map A pointer to the map.
+ */
+void tk_hashmap_clear(tk_hashmap_t *map);
+
+// --- Iterator Functions ---
+
+/**
+ * @brief Returns a forward iterator to the first entry.
+ *
+ * `tk_iter_get` yields a pointer to the entry's key; use
+ * `tk_hashmap_iter_key` / `tk_hashmap_iter_value` for typed access.
+ *
+ * @param map A pointer to the map.
+ * @return An iterator to the first entry, or `tk_hashmap_end` if empty.
+ */
+tk_iterator_t tk_hashmap_begin(tk_hashmap_t *map);
+
+/**
+ * @brief Returns an iterator past the last entry.
+ * @param map A pointer to the map.
+ * @return The end iterator.
+ */
+tk_iterator_t tk_hashmap_end(tk_hashmap_t *map);
+
+/**
+ * @brief Returns the key of the entry a hash map iterator points to.
+ * @param iter A dereferenceable iterator from `tk_hashmap_begin`.
+ * @return A pointer to the stored key (must not be modified).
+ */
+const void *tk_hashmap_iter_key(const tk_iterator_t *iter);
+
+/**
+ * @brief Returns the value of the entry a hash map iterator points to.
+ * @param iter A dereferenceable iterator from `tk_hashmap_begin`.
+ * @return A pointer to the stored value.
+ */
+void *tk_hashmap_iter_value(const tk_iterator_t *iter);
+
+#endif // TOOLKIT_DS_HASHMAP_H
@@ -0,0 +1,145 @@
+/**
+ * @file hashset.h
+ * @brief Public interface for the toolkit's generic open-addressing hash set.
+ *
+ * @details
+ * `tk_hashset_t` stores distinct fixed-size keys, copied in by value. It is
+ * a `tk_hashmap_t` with a value size of 0: the same Swiss-table probing
+ * (16 control bytes compared at once), the same pluggable hash and equality
+ * functions, and no per-entry storage beyond the key itself. The set API
+ * only removes the value parameters and reports, on insertion, whether the
+ * key was new, in a single probe.
+ *
+ * Iteration order is unspecified. Any insertion may rehash the table, which
+ * invalidates all iterators; erasure only invalidates the erased key.
+ */
+#ifndef TOOLKIT_DS_HASHSET_H
+#define TOOLKIT_DS_HASHSET_H
+
+#include <tk/core/allocator.h>
+#include <tk/core/error.h>
+#include <tk/core/iterator.h>
+#include <tk/core/types.h>
+#include <tk/ds/hashmap.h>
+
+// Forward declaration of the opaque structure.
+typedef struct tk_hashset_t tk_hashset_t;
+
+// --- Lifecycle Functions ---
+
+/**
+ * @brief Creates a new, empty hash set. No table is allocated until the
+ * first insertion.
+ * @param key_size The size in bytes of each key. Must be greater than 0.
+ * @param hash The hash function, or NULL for `tk_hash_bytes`.
+ * @param equal The key equality function, or NULL for `tk_key_equal_bytes`.
+ * @return A pointer to the new set, or NULL if memory allocation fails.
+ */
+tk_hashset_t *tk_hashset_create(size_t key_size, tk_hash_fn_t hash,
+                                tk_key_equal_fn_t equal);
+
+/**
+ * @brief Creates a new, empty hash set that obtains all of its memory from a
+ * custom allocator. See `tk_vec_create_with_allocator`.
+ * @param key_size The size in bytes of each key. Must be greater than 0.
+ * @param hash The hash function, or NULL for `tk_hash_bytes`.
+ * @param equal The key equality function, or NULL for `tk_key_equal_bytes`.
+ * @param allocator The allocator to use. Must not be NULL.
+ * @return A pointer to the new set, or NULL if memory allocation fails.
+ */
+tk_hashset_t *tk_hashset_create_with_allocator(size_t key_size,
+                                               tk_hash_fn_t hash,
+                                               tk_key_equal_fn_t equal,
+                                               const tk_allocator_t *allocator);
+
+/**
+ * @brief Destroys a hash set and frees all associated memory.
+ * @param set A pointer to the set. If NULL, the function does nothing.
+ */
+void tk_hashset_destroy(tk_hashset_t *set);
+
+// --- Capacity Functions ---
+
+/**
+ * @brief Returns the number of keys in the set.
+ * @param set A constant pointer to the set.
+ * @return The number of keys.
+ */
+size_t tk_hashset_size(const tk_hashset_t *set);
+
+/**
+ * @brief Checks if the set is empty.
+ * @param set A constant pointer to the set.
+ * @return `true` if the set has no keys, `false` otherwise.
+ */
+tk_bool tk_hashset_is_empty(const tk_hashset_t *set);
+
+/**
+ * @brief Returns the number of slots in the table. See
+ * `tk_hashmap_capacity`.
+ * @param set A constant pointer to the set.
+ * @return The slot count.
+ */
+size_t tk_hashset_capacity(const tk_hashset_t *set);
+
+/**
+ * @brief Grows the table so that at least `n` keys fit without a rehash.
+ * @param set A pointer to the set.
+ * @param n The number of keys to make room for.
+ * @return TK_SUCCESS, or TK_E_NOMEM if the allocation fails.
+ */
+tk_error_t tk_hashset_reserve(tk_hashset_t *set, size_t n);
+
+// --- Lookup & Modifiers ---
+
+/**
+ * @brief Adds a key if it is not already present.
+ * @param set A pointer to the set.
+ * @param key A pointer to the key to copy in.
+ * @param inserted If not NULL, receives `true` if the key was new, `false`
+ * if it was already present (or on failure).
+ * @return TK_SUCCESS, or TK_E_NOMEM if the table could not grow.
+ */
+tk_error_t tk_hashset_insert(tk_hashset_t *set, const void *key,
+                             tk_bool *inserted);
+
+/**
+ * @brief Checks if the set contains a key.
+ * @param set A constant pointer to the set.
+ * @param key A pointer to the key to look for.
+ * @return `true` if the key is present, `false` otherwise.
+ */
+tk_bool tk_hashset_contains(const tk_hashset_t *set, const void *key);
+
+/**
+ * @brief Removes a key.
+ * @param set A pointer to the set.
+ * @param key A pointer to the key to remove.
+ * @return TK_SUCCESS, or TK_E_NOT_FOUND if the key is absent.
+ */
+tk_error_t tk_hashset_erase(tk_hashset_t *set, const void *key);
+
+/**
+ * @brief Removes all keys, keeping the table allocated.
+ * @param set A pointer to the set.
+ */
+void tk_hashset_clear(tk_hashset_t *set);
+
+// --- Iterator Functions ---
+
+/**
+ * @brief Returns a forward iterator to the first key. `tk_iter_get` yields
+ * a pointer to the key, which must not be modified.
+ * @param set A pointer to the set.
+ * @return An iterator to the first key, or `tk_hashset_end` if empty.
+ */
+tk_iterator_t tk_hashset_begin(tk_hashset_t *set);
+
+/**
+ * @brief Returns an iterator past the last key.
+ * @param set A pointer to the set.
+ * @return The end iterator.
+ */
+tk_iterator_t tk_hashset_end(tk_hashset_t *set);
+
+#endif // TOOLKIT_DS_HASHSET_H
@@ -0,0 +1,229 @@
+/**
+ * @file heap.h
+ * @brief Public interface for the toolkit's generic priority queue.
+ *
+ * @details
+ * `tk_heap_t` is an implicit d-ary heap stored in a contiguous `tk_vec_t`:
+ * push and pop are O(log n), top is O(1) and building from a buffer is O(n).
+ * The top is the element that compares lowest, so a plain ascending
+ * comparator gives a min-heap (the usual choice for timers) and a reversed
+ * one a max-heap. Elements are copied in by value.
+ *
+ * The arity is chosen at creation. The default, 4, halves the depth of a
+ * binary heap and keeps the children of a node next to each other (four
+ * 8-byte keys share a cache line), which makes pops cheaper at the price of
+ * a few more comparisons per level.
+ *
+ * Every element gets a handle, a small integer that stays valid while the
+ * element is in the heap, however it moves. `tk_heap_update`,
+ * `tk_heap_decrease_key` and `tk_heap_erase` use it to reschedule or cancel
+ * an element in O(log n) without searching for it. Handles of removed
+ * elements are recycled.
+ */
+#ifndef TOOLKIT_DS_HEAP_H
+#define TOOLKIT_DS_HEAP_H
+
+#include <tk/core/allocator.h>
+#include <tk/core/error.h>
+#include <tk/core/types.h>
+
+// Forward declaration of the opaque structure
+typedef struct tk_heap_t tk_heap_t;
+
+// tk_compare_fn_t comes from <tk/core/types.h>
+
+/**
+ * @brief Identifies an element for as long as it is in the heap.
+ */
+typedef size_t tk_heap_handle_t;
+
+/**
+ * @brief A handle that never refers to an element.
+ */
+#define TK_HEAP_NO_HANDLE ((tk_heap_handle_t)-1)
+
+/**
+ * @brief The arity used when `tk_heap_create` is given 0.
+ */
+#define TK_HEAP_DEFAULT_ARITY 4
+
+// --- Lifecycle Functions ---
+
+/**
+ * @brief Creates a new, empty heap. No storage is allocated until the first
+ * push.
+ * @param element_size The size in bytes of each element. Must be greater
+ * than 0.
+ * @param compare The ordering; the lowest element is at the top.
+ * @param arity The number of children per node: a power of two from 2 to
+ * 16, or 0 for TK_HEAP_DEFAULT_ARITY.
+ * @return A pointer to the new heap, or NULL if an argument is invalid or
+ * memory allocation fails.
+ */
+tk_heap_t *tk_heap_create(size_t element_size, tk_compare_fn_t compare,
+                          size_t arity);
+
+/**
+ * @brief Creates a new, empty heap that obtains all of its memory from a
+ * custom allocator. See `tk_vec_create_with_allocator`.
+ * @param element_size The size in bytes of each element.
+ * @param compare The ordering; the lowest element is at the top.
+ * @param arity The number of children per node, as for `tk_heap_create`.
+ * @param allocator The allocator to use. Must not be NULL.
+ * @return A pointer to the new heap, or NULL on failure.
+ */
+tk_heap_t *tk_heap_create_with_allocator(size_t element_size,
+                                         tk_compare_fn_t compare, size_t arity,
+                                         const tk_allocator_t *allocator);
+
+/**
+ * @brief Destroys a heap and frees all associated memory.
+ * @param heap A pointer to the heap. If NULL, the function does nothing.
+ */
+void tk_heap_destroy(tk_heap_t *heap);
+
+// --- Capacity Functions ---
+
+/**
+ * @brief Returns the number of elements in the heap.
+ * @param heap A constant pointer to the heap.
+ * @return The number of elements.
+ */
+size_t tk_heap_size(const tk_heap_t *heap);
+
+/**
+ * @brief Checks if the heap is empty.
+ * @param heap A constant pointer to the heap.
+ * @return `true` if the size is 0, `false` otherwise.
+ */
+tk_bool tk_heap_is_empty(const tk_heap_t *heap);
+
+/**
+ * @brief Returns the arity the heap was created with.
+ * @param heap A constant pointer to the heap.
+ * @return The number of children per node.
+ */
+size_t tk_heap_arity(const tk_heap_t *heap);
+
+/**
+ * @brief Ensures room for at least `n` elements, so that pushes up to that
+ * size do not allocate.
+ * @param heap A pointer to the heap.
+ * @param n The number of elements to make room for.
+ * @return TK_SUCCESS or TK_E_NOMEM.
+ */
+tk_error_t tk_heap_reserve(tk_heap_t *heap, size_t n);
+
+// --- Element Access Functions ---
+
+/**
+ * @brief Returns a pointer to the lowest element. It must not be modified
+ * in place; use `tk_heap_update` to change it.
+ * @param heap A constant pointer to the heap.
+ * @return A pointer to the top element, or NULL if the heap is empty.
+ */
+const void *tk_heap_top(const tk_heap_t *heap);
+
+/**
+ * @brief Returns the handle of the lowest element.
+ * @param heap A constant pointer to the heap.
+ * @return The handle, or TK_HEAP_NO_HANDLE if the heap is empty.
+ */
+tk_heap_handle_t tk_heap_top_handle(const tk_heap_t *heap);
+
+/**
+ * @brief Returns a pointer to the element a handle refers to. Valid until
+ * the next modification of the heap.
+ * @param heap A constant pointer to the heap.
+ * @param handle A handle returned by a push.
+ * @return A pointer to the element, or NULL if the handle does not refer to
+ * an element in the heap.
+ */
+const void *tk_heap_get(const tk_heap_t *heap, tk_heap_handle_t handle);
+
+/**
+ * @brief Checks whether a handle refers to an element in the heap.
+ * @param heap A constant pointer to the heap.
+ * @param handle The handle to check.
+ * @return `true` if the element is in the heap, `false` otherwise.
+ */
+tk_bool tk_heap_contains(const tk_heap_t *heap, tk_heap_handle_t handle);
+
+// --- Modifiers ---
+
+/**
+ * @brief Adds an element.
+ * @param heap A pointer to the heap.
+ * @param element A pointer to the element to be copied in.
+ * @param handle If not NULL, receives the element's handle.
+ * @return TK_SUCCESS or TK_E_NOMEM (the heap is left unchanged).
+ */
+tk_error_t tk_heap_push(tk_heap_t *heap, const void *element,
+                        tk_heap_handle_t *handle);
+
+/**
+ * @brief Removes the lowest element. Its handle becomes invalid.
+ * @param heap A pointer to the heap.
+ * @param out If not NULL, receives a copy of the removed element.
+ * @return TK_SUCCESS, or TK_E_EMPTY if the heap is empty.
+ */
+tk_error_t tk_heap_pop(tk_heap_t *heap, void *out);
+
+/**
+ * @brief Replaces the contents of the heap with `n` elements and orders them
+ * bottom-up in O(n), instead of the O(n log n) of `n` pushes.
+ * @param heap A pointer to the heap.
+ * @param elements A pointer to `n` contiguous elements. May be NULL if `n`
+ * is 0.
+ * @param n The number of elements.
+ * @param handles If not NULL, an array of `n` that receives the handle of
+ * each element, in input order.
+ * @return TK_SUCCESS or TK_E_NOMEM (the heap is left unchanged).
+ */
+tk_error_t tk_heap_assign(tk_heap_t *heap, const void *elements, size_t n,
+                          tk_heap_handle_t *handles);
+
+/**
+ * @brief Replaces an element and restores the order, in whichever
+ * direction it moved.
+ * @param heap A pointer to the heap.
+ * @param handle The handle of the element.
+ * @param element A pointer to the new value.
+ * @return TK_SUCCESS, or TK_E_NOT_FOUND if the handle does not refer to an
+ * element in the heap.
+ */
+tk_error_t tk_heap_update(tk_heap_t *heap, tk_heap_handle_t handle,
+                          const void *element);
+
+/**
+ * @brief Replaces an element with one that compares no higher, moving it
+ * towards the top. Cheaper than `tk_heap_update` since only the path to the
+ * root is visited.
+ * @param heap A pointer to the heap.
+ * @param handle The handle of the element.
+ * @param element A pointer to the new value.
+ * @return TK_SUCCESS, TK_E_NOT_FOUND if the handle does not refer to an
+ * element in the heap, or TK_E_INVALID_ARG if the new value compares higher
+ * than the current one (the heap is left unchanged).
+ */
+tk_error_t tk_heap_decrease_key(tk_heap_t *heap, tk_heap_handle_t handle,
+                                const void *element);
+
+/**
+ * @brief Removes the element a handle refers to. The handle becomes invalid.
+ * @param heap A pointer to the heap.
+ * @param handle The handle of the element.
+ * @param out If not NULL, receives a copy of the removed element.
+ * @return TK_SUCCESS, or TK_E_NOT_FOUND if the handle does not refer to an
+ * element in the heap.
+ */
+tk_error_t tk_heap_erase(tk_heap_t *heap, tk_heap_handle_t handle, void *out);
+
+/**
+ * @brief Removes all elements, keeping the storage. Every handle becomes
+ * invalid.
+ * @param heap A pointer to the heap.
+ */
+void tk_heap_clear(tk_heap_t *heap);
+
+#endif // TOOLKIT_DS_HEAP_H
@@ -0,0 +1,210 @@
+/**
+ * @file ilist.h
+ * @brief Public interface for the toolkit's intrusive doubly-linked list.
+ *
+ * @details
+ * Unlike `tk_list_t`, which copies every element into a node it allocates,
+ * `tk_ilist_t` links objects that already exist: the user embeds a
+ * `tk_ilist_node_t` in their struct and the list threads its links through
+ * it. Linking and unlinking never allocate, an object can be removed in
+ * O(1) given only a pointer to it, and the list does not own the objects.
+ *
+ * The list records the offset of the node within the object, so the
+ * iterator (and `tk_ilist_front` / `tk_ilist_back`) hand out pointers to
+ * the objects themselves:
+ * @code
+ * typedef struct {
+ *   int id;
+ *   tk_ilist_node_t link;
+ * } job_t;
+ *
+ * tk_ilist_t queue;
+ * tk_ilist_init(&queue, offsetof(job_t, link));
+ * tk_ilist_push_back(&queue, &job->link);
+ * job_t *next = (job_t *)tk_ilist_front(&queue);
+ * @endcode
+ *
+ * Both structs are public so they can live inside other objects; treat
+ * their fields as private. The list is circular around a sentinel node
+ * stored in `tk_ilist_t`, so a list must not be moved in memory (copied by
+ * value) while it is not empty. A node may be in at most one list at a time.
+ */
+#ifndef TOOLKIT_DS_ILIST_H
+#define TOOLKIT_DS_ILIST_H
+
+#include <tk/core/iterator.h>
+#include <tk/core/macros.h>
+#include <tk/core/types.h>
+
+/**
+ * @brief The link embedded in every object that can be put in a list.
+ *
+ * A node must be zeroed or `tk_ilist_node_init`'ed before it is first
+ * linked; that state means "not in a list", and debug builds assert on it
+ * to catch a node being linked twice.
+ */
+typedef struct tk_ilist_node_t {
+  struct tk_ilist_node_t *prev;
+  struct tk_ilist_node_t *next;
+} tk_ilist_node_t;
+
+/**
+ * @brief An intrusive doubly-linked list.
+ */
+typedef struct {
+  tk_ilist_node_t sentinel; // .next is the front, .prev the back
+  size_t size;              // Number of linked nodes
+  size_t node_offset;       // Offset of the node within each object
+} tk_ilist_t;
+
+/**
+ * @brief Returns the object that contains `node`, with type checking.
+ * @param node A pointer to a `tk_ilist_node_t`.
+ * @param type The type of the containing struct.
+ * @param member The name of the node member within `type`.
+ */
+#define tk_ilist_entry(node, type, member) container_of(node, type, member)
+
+// --- Lifecycle Functions ---
+
+/**
+ * @brief Initializes an empty list.
+ * @param list A pointer to the list.
+ * @param node_offset `offsetof(T, member)` of the embedded node in the
+ * objects that will be linked.
+ */
+void tk_ilist_init(tk_ilist_t *list, size_t node_offset);
+
+/**
+ * @brief Marks a node as not being in any list.
+ * @param node A pointer to the node.
+ */
+void tk_ilist_node_init(tk_ilist_node_t *node);
+
+/**
+ * @brief Checks whether a node is currently in a list. Only meaningful for
+ * nodes that were initialized (or zeroed) before their first use.
+ * @param node A constant pointer to the node.
+ * @return `true` if the node is linked, `false` otherwise.
+ */
+tk_bool tk_ilist_node_is_linked(const tk_ilist_node_t *node);
+
+// --- Size/Query Functions ---
+
+/**
+ * @brief Returns the number of nodes in the list. O(1).
+ * @param list A constant pointer to the list.
+ * @return The number of nodes.
+ */
+size_t tk_ilist_size(const tk_ilist_t *list);
+
+/**
+ * @brief Checks if the list is empty. O(1).
+ * @param list A constant pointer to the list.
+ * @return `true` if the list has no nodes, `false` otherwise.
+ */
+tk_bool tk_ilist_is_empty(const tk_ilist_t *list);
+
+// --- Element Access Functions ---
+
+/**
+ * @brief Returns the object at the front of the list, or NULL if empty.
+ * @param list A constant pointer to the list.
+ */
+void *tk_ilist_front(const tk_ilist_t *list);
+
+/**
+ * @brief Returns the object at the back of the list, or NULL if empty.
+ * @param list A constant pointer to the list.
+ */
+void *tk_ilist_back(const tk_ilist_t *list);
+
+// --- Modifiers ---
+
+/**
+ * @brief Links a node at the back of the list. O(1), no allocation.
+ * @param list A pointer to the list.
+ * @param node A pointer to a node that is not in any list.
+ */
+void tk_ilist_push_back(tk_ilist_t *list, tk_ilist_node_t *node);
+
+/**
+ * @brief Links a node at the front of the list. O(1), no allocation.
+ * @param list A pointer to the list.
+ * @param node A pointer to a node that is not in any list.
+ */
+void tk_ilist_push_front(tk_ilist_t *list, tk_ilist_node_t *node);
+
+/**
+ * @brief Links `node` right before `position`. O(1).
+ * @param list A pointer to the list.
+ * @param position A node of `list`. To append, use `tk_ilist_push_back` or
+ * `tk_ilist_insert_at` with the end iterator.
+ * @param node A pointer to a node that is not in any list.
+ */
+void tk_ilist_insert_before(tk_ilist_t *list, tk_ilist_node_t *position,
+                            tk_ilist_node_t *node);
+
+/**
+ * @brief Links `node` right before the element `iter` points to; the end
+ * iterator appends. O(1).
+ * @param list A pointer to the list.
+ * @param iter An iterator into `list`.
+ * @param node A pointer to a node that is not in any list.
+ */
+void tk_ilist_insert_at(tk_ilist_t *list, tk_iterator_t iter,
+                        tk_ilist_node_t *node);
+
+/**
+ * @brief Unlinks a node from the list and marks it as not linked. O(1).
+ * @param list A pointer to the list the node is in.
+ * @param node A pointer to the node.
+ */
+void tk_ilist_remove(tk_ilist_t *list, tk_ilist_node_t *node);
+
+/**
+ * @brief Unlinks and returns the front node.
+ * @param list A pointer to the list.
+ * @return The unlinked node, or NULL if the list is empty.
+ */
+tk_ilist_node_t *tk_ilist_pop_front(tk_ilist_t *list);
+
+/**
+ * @brief Unlinks and returns the back node.
+ * @param list A pointer to the list.
+ * @return The unlinked node, or NULL if the list is empty.
+ */
+tk_ilist_node_t *tk_ilist_pop_back(tk_ilist_t *list);
+
+/**
+ * @brief Unlinks every node (marking each as not linked). O(n). The objects
+ * themselves are untouched.
+ * @param list A pointer to the list.
+ */
+void tk_ilist_clear(tk_ilist_t *list);
+
+// --- Iterator Functions ---
+
+/**
+ * @brief Returns a bidirectional iterator to the front object.
+ * `tk_iter_get` yields a pointer to the object, not to its node.
+ * @param list A pointer to the list.
+ * @return An iterator to the first object.
+ */
+tk_iterator_t tk_ilist_begin(tk_ilist_t *list);
+
+/**
+ * @brief Returns the end iterator. Retreating from it reaches the back.
+ * @param list A pointer to the list.
+ * @return The end iterator.
+ */
+tk_iterator_t tk_ilist_end(tk_ilist_t *list);
+
+/**
+ * @brief Returns the node an iterator points to (the sentinel for end).
+ * @param iter A constant pointer to an ilist iterator.
+ * @return The node.
+ */
+tk_ilist_node_t *tk_ilist_iter_node(const tk_iterator_t *iter);
+
+#endif // TOOLKIT_DS_ILIST_H
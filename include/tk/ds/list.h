@@ -15,15 +15,15 @@
 #ifndef TOOLKIT_DS_LIST_H
 #define TOOLKIT_DS_LIST_H
 
-#include <tk/core/error.h>    //
-#include <tk/core/iterator.h> //
-#include <tk/core/types.h>    //
+#include <tk/core/allocator.h> //
+#include <tk/core/error.h>     //
+#include <tk/core/iterator.h>  //
+#include <tk/core/types.h>     //
 
 // Forward declaration of the opaque structure
 typedef struct tk_list_t tk_list_t;
 
-// Re-use the element destroyer type definition
-typedef void (*tk_element_destroyer_t)(void *element_ptr);
+// tk_element_destroyer_t comes from <tk/core/types.h>
 
 // --- Lifecycle Functions ---
 // Mimics tk_vec_create, tk_vec_destroy, tk_vec_destroy_full
@@ -35,6 +35,38 @@ typedef void (*tk_element_destroyer_t)(void *element_ptr);
  */
 tk_list_t *tk_list_create(size_t element_size);
 
+/**
+ * @brief Creates a new list instance that obtains all of its memory from a
+ * custom allocator.
+ *
+ * The allocator is copied by value; its context must stay valid for the
+ * lifetime of the list. All nodes and the list handle itself are allocated
+ * and freed through it.
+ *
+ * @param element_size The size in bytes of each element to be stored.
+ * @param allocator The allocator to use. Must not be NULL; pass
+ * `tk_allocator_default()` for malloc/free behavior.
+ * @return A pointer to the new list, or NULL if memory allocation fails.
+ */
+tk_list_t *tk_list_create_with_allocator(size_t element_size,
+                                         const tk_allocator_t *allocator);
+
+/**
+ * @brief Creates a new list whose nodes come from a private slab node pool.
+ *
+ * Nodes are carved in chunks of `nodes_per_chunk` and recycled through an
+ * intrusive free list, so push/pop churn does not reach the global heap and
+ * consecutively pushed nodes are adjacent in memory. Freed nodes stay in the
+ * pool; the chunks are released as a whole by `tk_list_destroy` (or
+ * `tk_list_destroy_full`), and `tk_list_clear` recycles all nodes in O(1).
+ *
+ * @param element_size The size in bytes of each element to be stored.
+ * @param nodes_per_chunk The number of nodes per pool chunk, or 0 to pick a
+ * chunk of roughly 4 KiB.
+ * @return A pointer to the new list, or NULL if memory allocation fails.
+ */
+tk_list_t *tk_list_create_pooled(size_t element_size, size_t nodes_per_chunk);
+
 /**
  * @brief Destroys a list instance and frees all associated memory (nodes).
  * Performs a "shallow" destroy, meaning it does not free the user data
@@ -148,7 +180,7 @@ tk_error_t tk_list_push_front(tk_list_t *list, const void *element);
 void tk_list_pop_front(tk_list_t *list);
 
 /**
- * @brief Removes all elements from the list. O(n).
+ * @brief Removes all elements from the list. O(n), or O(1) for a pooled list.
  * @param list A pointer to the list handle.
  */
 void tk_list_clear(tk_list_t *list);
@@ -181,6 +213,90 @@ tk_error_t tk_list_insert_before(tk_list_t *list, tk_iterator_t before_iter,
  */
 tk_iterator_t tk_list_erase_at(tk_list_t *list, tk_iterator_t iter);
 
+// --- In-place Construction ---
+// Each of these links a new node and returns its uninitialized payload, so
+// the caller writes the element straight into the node instead of building
+// it elsewhere to be copied in. The pointer stays valid until the element
+// is removed.
+
+/**
+ * @brief Adds an uninitialized element to the end of the list. O(1).
+ * @param list A pointer to the list handle.
+ * @return A pointer to the element's payload, or NULL if allocation fails.
+ */
+void *tk_list_emplace_back(tk_list_t *list);
+
+/**
+ * @brief Adds an uninitialized element to the beginning of the list. O(1).
+ * @param list A pointer to the list handle.
+ * @return A pointer to the element's payload, or NULL if allocation fails.
+ */
+void *tk_list_emplace_front(tk_list_t *list);
+
+/**
+ * @brief Inserts an uninitialized element *before* the position indicated by
+ * the iterator (the end iterator appends). O(1).
+ * @param list A pointer to the list handle.
+ * @param before_iter An iterator into this list, or its end iterator.
+ * @return A pointer to the element's payload, or NULL if the iterator is not
+ * from this list or allocation fails.
+ */
+void *tk_list_emplace_before(tk_list_t *list, tk_iterator_t before_iter);
+
+// --- Bulk Modifiers ---
+// Splicing relinks nodes instead of copying them whenever both lists can own
+// the same nodes: neither is pooled (a pooled node belongs to its list's
+// slab) and both use the same allocator. Otherwise the elements are copied
+// into new nodes of `dst` and the source nodes are freed.
+
+/**
+ * @brief Appends `n` contiguous elements to the end of the list. O(n).
+ *
+ * The new nodes are chained up first and linked in with a single splice, so
+ * on failure the list is left unchanged.
+ *
+ * @param list A pointer to the list handle.
+ * @param elements A pointer to `n` packed elements to copy. May be NULL if
+ * `n` is 0.
+ * @param n The number of elements to append.
+ * @return TK_SUCCESS on success, TK_E_NOMEM if a node allocation fails.
+ */
+tk_error_t tk_list_push_back_n(tk_list_t *list, const void *elements,
+                               size_t n);
+
+/**
+ * @brief Moves the elements [first, last) of `src` before `pos` in `dst`.
+ *
+ * Cost: O(1) when `dst` and `src` are the same list, or when the whole of
+ * `src` is moved. Moving part of one list into another walks the range
+ * once, O(last - first), to keep both sizes exact (so `tk_list_size` stays
+ * O(1)). Lists that cannot share nodes (see above) copy the elements.
+ *
+ * Iterators to moved elements stay valid only when the nodes are relinked,
+ * and then belong to `dst`.
+ *
+ * @param dst The destination list.
+ * @param pos An iterator into `dst` (or its end iterator). When `dst` is
+ * `src`, `pos` must not lie inside [first, last).
+ * @param src The source list. May be `dst`.
+ * @param first An iterator into `src`: the first element to move.
+ * @param last An iterator into `src` (or its end iterator), after `first`.
+ * @return TK_SUCCESS, TK_E_INVALID_ARG if an iterator does not belong to its
+ * list or the element sizes differ, or TK_E_NOMEM if copying fails (both
+ * lists are then unchanged).
+ */
+tk_error_t tk_list_splice(tk_list_t *dst, tk_iterator_t pos, tk_list_t *src,
+                          tk_iterator_t first, tk_iterator_t last);
+
+/**
+ * @brief Moves every element of `src` to the end of `dst`, leaving `src`
+ * empty. O(1) when the lists can share nodes.
+ * @param dst The destination list.
+ * @param src The source list. Must not be `dst`.
+ * @return The same codes as `tk_list_splice`.
+ */
+tk_error_t tk_list_append_list(tk_list_t *dst, tk_list_t *src);
+
 // --- Iterator Functions ---
 // Mimics tk_vec_begin, tk_vec_end
 
@@ -0,0 +1,234 @@
+/**
+ * @file mmvec.h
+ * @brief Public interface for the toolkit's file-backed, memory-mapped
+ * vector.
+ *
+ * @details
+ * `tk_mmvec_t` is a vector of fixed-size, plain-data records whose storage
+ * is a shared mapping of a file. Pushing writes straight into the page
+ * cache, and reopening the file later maps the same records back with no
+ * parsing and no copying: startup costs page faults, not a read plus a push
+ * per element. The element API and the iterators mirror `tk_vec_t`.
+ *
+ * The file holds a 64-byte header (magic, element size, element count)
+ * followed by the records packed back to back. Growing extends the file with
+ * `ftruncate` and remaps it, so, as with `tk_vec_t`, growth invalidates
+ * element pointers. The capacity is whatever the file has room for; it
+ * persists across reopens until `tk_mmvec_shrink_to_fit` trims it.
+ *
+ * Records must not contain pointers (they would be meaningless after a
+ * reopen). The header and records use the host's byte order and layout, so
+ * a file is only portable between builds with the same ABI. Data reaches the
+ * page cache immediately and survives a process crash; `tk_mmvec_sync`
+ * additionally waits for it to reach the disk.
+ *
+ * A vector opened with TK_MMVEC_READ_ONLY is mapped with PROT_READ only.
+ * Its modifiers report TK_E_INVALID_ARG, but the element pointers handed
+ * out by `tk_mmvec_at`, `tk_mmvec_data` and the iterators are still plain
+ * pointers into that mapping: writing through them (including from an
+ * algorithm that moves elements, such as `tk_algo_sort`) faults.
+ *
+ * POSIX only (`mmap`, `ftruncate`, `msync`).
+ */
+#ifndef TOOLKIT_DS_MMVEC_H
+#define TOOLKIT_DS_MMVEC_H
+
+#include <tk/core/error.h>
+#include <tk/core/iterator.h>
+#include <tk/core/types.h>
+
+// Forward declaration of the opaque structure.
+typedef struct tk_mmvec_t tk_mmvec_t;
+
+/**
+ * @brief Flags for `tk_mmvec_open`, combined with `|`.
+ */
+enum {
+  TK_MMVEC_READ_ONLY = 1 << 0, // Map read-only; every modifier fails
+  TK_MMVEC_CREATE = 1 << 1,    // Create the file if it does not exist
+  TK_MMVEC_TRUNCATE = 1 << 2   // Discard any existing contents
+};
+
+// --- Lifecycle Functions ---
+
+/**
+ * @brief Opens (or creates) a file-backed vector.
+ *
+ * An existing file is validated (magic, element size, element count against
+ * the file size) and mapped as is. A new or truncated file starts out empty.
+ *
+ * @param path The path of the file.
+ * @param element_size The size in bytes of each record. Must match the size
+ * the file was created with.
+ * @param flags A combination of the TK_MMVEC_* flags. TK_MMVEC_READ_ONLY
+ * cannot be combined with the other two.
+ * @return A pointer to the new vector, or NULL on failure, with `errno` set
+ * by the failing system call (EINVAL if the file is not a vector of this
+ * element size).
+ */
+tk_mmvec_t *tk_mmvec_open(const char *path, size_t element_size,
+                          unsigned flags);
+
+/**
+ * @brief Unmaps the file, closes it and frees the handle. The records stay
+ * in the file. Does not wait for the disk; call `tk_mmvec_sync` first for
+ * that.
+ * @param vec A pointer to the vector. If NULL, the function does nothing.
+ */
+void tk_mmvec_close(tk_mmvec_t *vec);
+
+/**
+ * @brief Flushes the mapping to the disk and waits for it to complete.
+ * @param vec A pointer to the vector.
+ * @return TK_SUCCESS, or TK_E_IO if `msync` fails.
+ */
+tk_error_t tk_mmvec_sync(tk_mmvec_t *vec);
+
+// --- Capacity Functions ---
+
+/**
+ * @brief Returns the number of elements in the vector.
+ * @param vec A constant pointer to the vector.
+ * @return The number of elements.
+ */
+size_t tk_mmvec_size(const tk_mmvec_t *vec);
+
+/**
+ * @brief Checks if the vector is empty.
+ * @param vec A constant pointer to the vector.
+ * @return `true` if the size is 0, `false` otherwise.
+ */
+tk_bool tk_mmvec_is_empty(const tk_mmvec_t *vec);
+
+/**
+ * @brief Returns the number of elements the file has room for.
+ * @param vec A constant pointer to the vector.
+ * @return The current capacity.
+ */
+size_t tk_mmvec_capacity(const tk_mmvec_t *vec);
+
+/**
+ * @brief Checks whether the vector was opened with TK_MMVEC_READ_ONLY.
+ * @param vec A constant pointer to the vector.
+ * @return `true` if the mapping is read-only, `false` otherwise.
+ */
+tk_bool tk_mmvec_is_read_only(const tk_mmvec_t *vec);
+
+/**
+ * @brief Grows the file to hold at least `n` elements. A smaller `n` is a
+ * no-op.
+ * @param vec A pointer to the vector.
+ * @param n The new capacity.
+ * @return TK_SUCCESS, TK_E_INVALID_ARG if the vector is read-only, TK_E_IO if
+ * the file cannot be extended or TK_E_NOMEM if it cannot be remapped (the
+ * vector is left unchanged).
+ */
+tk_error_t tk_mmvec_reserve(tk_mmvec_t *vec, size_t n);
+
+/**
+ * @brief Truncates the file to the current size, giving the unused capacity
+ * back to the file system.
+ * @param vec A pointer to the vector.
+ * @return TK_SUCCESS, TK_E_INVALID_ARG if the vector is read-only, or
+ * TK_E_IO / TK_E_NOMEM as for `tk_mmvec_reserve`.
+ */
+tk_error_t tk_mmvec_shrink_to_fit(tk_mmvec_t *vec);
+
+// --- Element Access Functions ---
+
+/**
+ * @brief Returns a pointer to the element at the specified index, with bounds
+ * checking. Writing through it faults if the vector is read-only.
+ * @param vec A constant pointer to the vector.
+ * @param index The index of the element to access.
+ * @return A pointer to the element, or NULL if the index is out of bounds.
+ */
+void *tk_mmvec_at(const tk_mmvec_t *vec, size_t index);
+
+/**
+ * @brief Returns a pointer to the first element, or NULL if empty.
+ * @param vec A constant pointer to the vector.
+ */
+void *tk_mmvec_front(const tk_mmvec_t *vec);
+
+/**
+ * @brief Returns a pointer to the last element, or NULL if empty.
+ * @param vec A constant pointer to the vector.
+ */
+void *tk_mmvec_back(const tk_mmvec_t *vec);
+
+/**
+ * @brief Returns a pointer to the contiguous records in the mapping.
+ * Invalidated by any operation that grows or shrinks the file. Writing
+ * through it faults if the vector is read-only.
+ * @param vec A constant pointer to the vector.
+ * @return A pointer to the first element.
+ */
+void *tk_mmvec_data(const tk_mmvec_t *vec);
+
+// --- Modifiers ---
+// All of these fail with TK_E_INVALID_ARG (or NULL) on a read-only vector.
+
+/**
+ * @brief Adds an element to the end of the vector.
+ * @param vec A pointer to the vector.
+ * @param element A pointer to the element to be copied in.
+ * @return TK_SUCCESS, or an error as for `tk_mmvec_reserve`.
+ */
+tk_error_t tk_mmvec_push_back(tk_mmvec_t *vec, const void *element);
+
+/**
+ * @brief Appends `n` contiguous elements with at most one growth.
+ * @param vec A pointer to the vector.
+ * @param elements A pointer to `n` elements to copy. May be NULL if `n` is 0.
+ * @param n The number of elements to append.
+ * @return TK_SUCCESS, or an error as for `tk_mmvec_reserve`.
+ */
+tk_error_t tk_mmvec_push_back_n(tk_mmvec_t *vec, const void *elements,
+                                size_t n);
+
+/**
+ * @brief Appends a zeroed element and returns a pointer to it, so the record
+ * is written directly into the mapping.
+ *
+ * Unlike `tk_mmvec_push_back`, the count is updated before the caller fills
+ * the record in; a crash in between leaves a zeroed (or partly written)
+ * element at the back of the file.
+ *
+ * @param vec A pointer to the vector.
+ * @return A pointer to the new element, or NULL on failure.
+ */
+void *tk_mmvec_emplace_back(tk_mmvec_t *vec);
+
+/**
+ * @brief Removes the last element. Does nothing if the vector is empty.
+ * @param vec A pointer to the vector.
+ * @return TK_SUCCESS, or TK_E_INVALID_ARG if the vector is read-only.
+ */
+tk_error_t tk_mmvec_pop_back(tk_mmvec_t *vec);
+
+/**
+ * @brief Removes all elements. The file keeps its capacity.
+ * @param vec A pointer to the vector.
+ * @return TK_SUCCESS, or TK_E_INVALID_ARG if the vector is read-only.
+ */
+tk_error_t tk_mmvec_clear(tk_mmvec_t *vec);
+
+// --- Iterator Functions ---
+
+/**
+ * @brief Returns a contiguous, random-access iterator to the first element.
+ * The elements must not be written through it if the vector is read-only.
+ * @param vec A pointer to the vector.
+ * @return An iterator to the first element.
+ */
+tk_iterator_t tk_mmvec_begin(tk_mmvec_t *vec);
+
+/**
+ * @brief Returns an iterator to the position just past the last element.
+ * @param vec A pointer to the vector.
+ * @return The end iterator.
+ */
+tk_iterator_t tk_mmvec_end(tk_mmvec_t *vec);
+
+#endif // TOOLKIT_DS_MMVEC_H
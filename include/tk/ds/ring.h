@@ -0,0 +1,185 @@
+/**
+ * @file ring.h
+ * @brief Public interface for the toolkit's bounded lock-free ring buffer.
+ *
+ * @details
+ * `tk_ring_t` is a fixed-capacity FIFO queue for passing elements between
+ * threads. Elements are copied in and out by value, following the
+ * `element_size` convention of `tk_vec_t`; the buffer is allocated once at
+ * creation, so pushing and popping never allocate and never take a lock.
+ *
+ * Two concurrency modes are available:
+ * - `TK_RING_SPSC`: exactly one producer thread and one consumer thread.
+ *   Each side owns its index and keeps a cached copy of the other one, so
+ *   the shared cache lines are only touched when the cached view runs out.
+ * - `TK_RING_MPMC`: any number of producers and consumers. Every slot
+ *   carries a sequence number (a bounded Vyukov queue); positions are
+ *   claimed with a compare-and-swap, a whole batch at once.
+ *
+ * The producer and consumer indices live on separate cache lines. Batch
+ * operations (`tk_ring_push_n` / `tk_ring_pop_n`) move as many elements as
+ * fit with a single index update.
+ *
+ * The iterator gives the consumer a view of the readable elements, in FIFO
+ * order, without copying them out; `tk_ring_consume` then releases them:
+ * @code
+ * tk_iterator_t it = tk_ring_begin(ring), end = tk_ring_end(ring);
+ * for (; !tk_iter_equal(&it, &end); tk_iter_next(&it))
+ *   handle(tk_iter_get(&it));
+ * tk_ring_consume(ring, &end);
+ * @endcode
+ */
+#ifndef TOOLKIT_DS_RING_H
+#define TOOLKIT_DS_RING_H
+
+#include <tk/core/allocator.h>
+#include <tk/core/error.h>
+#include <tk/core/iterator.h>
+#include <tk/core/types.h>
+
+// Forward declaration of the opaque structure.
+typedef struct tk_ring_t tk_ring_t;
+
+/**
+ * @brief Which threads may use a ring concurrently.
+ */
+typedef enum {
+  TK_RING_SPSC, // One producer thread, one consumer thread
+  TK_RING_MPMC  // Any number of producers and consumers
+} tk_ring_mode_t;
+
+// --- Lifecycle Functions ---
+
+/**
+ * @brief Creates a new, empty ring buffer.
+ * @param element_size The size in bytes of each element. Must be greater
+ * than 0.
+ * @param capacity The minimum number of elements the ring can hold; rounded
+ * up to a power of two (at least 2).
+ * @param mode The concurrency mode.
+ * @return A pointer to the new ring, or NULL if memory allocation fails.
+ */
+tk_ring_t *tk_ring_create(size_t element_size, size_t capacity,
+                          tk_ring_mode_t mode);
+
+/**
+ * @brief Creates a new, empty ring buffer that obtains its memory from a
+ * custom allocator. The allocator is only used by create and destroy.
+ * @param element_size The size in bytes of each element. Must be greater
+ * than 0.
+ * @param capacity The minimum number of elements; see `tk_ring_create`.
+ * @param mode The concurrency mode.
+ * @param allocator The allocator to use. Must not be NULL.
+ * @return A pointer to the new ring, or NULL if memory allocation fails.
+ */
+tk_ring_t *tk_ring_create_with_allocator(size_t element_size, size_t capacity,
+                                         tk_ring_mode_t mode,
+                                         const tk_allocator_t *allocator);
+
+/**
+ * @brief Destroys a ring buffer. No other thread may still be using it.
+ * @param ring A pointer to the ring. If NULL, the function does nothing.
+ */
+void tk_ring_destroy(tk_ring_t *ring);
+
+// --- Capacity Functions ---
+
+/**
+ * @brief Returns the number of elements in the ring. Exact when no other
+ * thread is pushing or popping, a momentary estimate otherwise.
+ * @param ring A constant pointer to the ring.
+ * @return The number of elements.
+ */
+size_t tk_ring_size(const tk_ring_t *ring);
+
+/**
+ * @brief Checks if the ring is empty (with the caveat of `tk_ring_size`).
+ * @param ring A constant pointer to the ring.
+ * @return `true` if the ring holds no elements, `false` otherwise.
+ */
+tk_bool tk_ring_is_empty(const tk_ring_t *ring);
+
+/**
+ * @brief Returns the number of elements the ring can hold.
+ * @param ring A constant pointer to the ring.
+ * @return The capacity (a power of two).
+ */
+size_t tk_ring_capacity(const tk_ring_t *ring);
+
+/**
+ * @brief Returns the size of one element.
+ * @param ring A constant pointer to the ring.
+ * @return The element size in bytes.
+ */
+size_t tk_ring_element_size(const tk_ring_t *ring);
+
+// --- Producer Functions ---
+
+/**
+ * @brief Copies one element into the ring.
+ * @param ring A pointer to the ring.
+ * @param element A pointer to the element to copy.
+ * @return TK_SUCCESS, or TK_E_FULL if the ring has no free slot.
+ */
+tk_error_t tk_ring_push(tk_ring_t *ring, const void *element);
+
+/**
+ * @brief Copies up to `count` consecutive elements into the ring, as many as
+ * currently fit.
+ * @param ring A pointer to the ring.
+ * @param elements A pointer to the first of `count` packed elements.
+ * @param count The number of elements offered.
+ * @return The number of elements pushed (the first ones of `elements`), 0 if
+ * the ring is full.
+ */
+size_t tk_ring_push_n(tk_ring_t *ring, const void *elements, size_t count);
+
+// --- Consumer Functions ---
+
+/**
+ * @brief Copies the oldest element out of the ring and removes it.
+ * @param ring A pointer to the ring.
+ * @param out Where to copy the element. May be NULL to discard it.
+ * @return TK_SUCCESS, or TK_E_EMPTY if there is nothing to pop.
+ */
+tk_error_t tk_ring_pop(tk_ring_t *ring, void *out);
+
+/**
+ * @brief Copies out and removes up to `count` of the oldest elements.
+ * @param ring A pointer to the ring.
+ * @param out Room for `count` packed elements. May be NULL to discard them.
+ * @param count The maximum number of elements to pop.
+ * @return The number of elements popped, 0 if the ring is empty.
+ */
+size_t tk_ring_pop_n(tk_ring_t *ring, void *out, size_t count);
+
+// --- Iterator Functions ---
+
+/**
+ * @brief Returns an iterator to the oldest element.
+ *
+ * The iterator functions are consumer operations. On an MPMC ring they
+ * require that no other thread pops while the view is in use.
+ *
+ * @param ring A pointer to the ring.
+ * @return A forward iterator.
+ */
+tk_iterator_t tk_ring_begin(tk_ring_t *ring);
+
+/**
+ * @brief Returns an iterator past the newest element that is ready to be
+ * read. Elements pushed afterwards are not part of [begin, end).
+ * @param ring A pointer to the ring.
+ * @return A forward iterator.
+ */
+tk_iterator_t tk_ring_end(tk_ring_t *ring);
+
+/**
+ * @brief Removes every element before `upto` (an iterator obtained from
+ * this ring since the last pop), freeing their slots for producers.
+ * @param ring A pointer to the ring.
+ * @param upto An iterator into the ring, typically `tk_ring_end`.
+ */
+void tk_ring_consume(tk_ring_t *ring, const tk_iterator_t *upto);
+
+#endif // TOOLKIT_DS_RING_H
@@ -0,0 +1,182 @@
+/**
+ * @file typed_list.h
+ * @brief Code-generation macro for type-specialized doubly-linked lists.
+ *
+ * @details
+ * `TK_LIST_DEFINE(prefix, T)` emits a typed list `prefix_t` whose nodes
+ * (`prefix_node_t`) store a `T` inline next to the links, plus a set of
+ * `static inline` functions named `prefix_*`. Element copies are plain
+ * assignments of a compile-time-sized `T`, and accessors return `T *`.
+ *
+ * Like the typed vector, a typed list is a value type set up with
+ * `prefix_init`; nodes are obtained from a `tk_allocator_t`. The node links
+ * are public so callers can walk the list directly:
+ *
+ * @code
+ * TK_LIST_DEFINE(int_list, int)
+ *
+ * int_list_t l;
+ * int_list_init(&l);
+ * int_list_push_back(&l, 1);
+ * for (int_list_node_t *n = l.head; n; n = n->next)
+ *   printf("%d\n", n->value);
+ * int_list_destroy(&l);
+ * @endcode
+ *
+ * The generic `tk_list_t` remains the type-erased fallback.
+ */
+#ifndef TOOLKIT_DS_TYPED_LIST_H
+#define TOOLKIT_DS_TYPED_LIST_H
+
+#include <tk/core/allocator.h>
+#include <tk/core/error.h>
+#include <tk/core/macros.h>
+#include <tk/core/types.h>
+
+/**
+ * @brief Defines a typed list `PREFIX##_t` of `T` and its functions.
+ *
+ * Generated API (all `static inline`):
+ * - `void PREFIX##_init(PREFIX##_t *l)`
+ * - `void PREFIX##_init_with_allocator(PREFIX##_t *l, const tk_allocator_t *a)`
+ * - `void PREFIX##_destroy(PREFIX##_t *l)` (also usable as clear)
+ * - `size_t PREFIX##_size(const PREFIX##_t *l)`
+ * - `tk_bool PREFIX##_is_empty(const PREFIX##_t *l)`
+ * - `tk_error_t PREFIX##_push_back(PREFIX##_t *l, T value)`
+ * - `T *PREFIX##_emplace_back(PREFIX##_t *l)` (uninitialized; NULL on failure)
+ * - `tk_error_t PREFIX##_push_front(PREFIX##_t *l, T value)`
+ * - `tk_error_t PREFIX##_pop_back(PREFIX##_t *l, T *out)` (out may be NULL)
+ * - `tk_error_t PREFIX##_pop_front(PREFIX##_t *l, T *out)` (out may be NULL)
+ * - `T *PREFIX##_front(const PREFIX##_t *l)` (NULL if empty)
+ * - `T *PREFIX##_back(const PREFIX##_t *l)` (NULL if empty)
+ *
+ * @param PREFIX The name prefix for the generated types and functions.
+ * @param T The element type.
+ */
+#define TK_LIST_DEFINE(PREFIX, T)                                              \
+  typedef struct PREFIX##_node_t {                                             \
+    struct PREFIX##_node_t *prev;                                              \
+    struct PREFIX##_node_t *next;                                              \
+    T value; /* Stored inline, next to the links */                            \
+  } PREFIX##_node_t;                                                           \
+                                                                               \
+  typedef struct {                                                             \
+    PREFIX##_node_t *head;    /* First node, or NULL if empty */               \
+    PREFIX##_node_t *tail;    /* Last node, or NULL if empty */                \
+    size_t size;              /* Number of elements */                         \
+    tk_allocator_t allocator; /* Source of the nodes */                        \
+  } PREFIX##_t;                                                                \
+                                                                               \
+  static inline void PREFIX##_init_with_allocator(                             \
+      PREFIX##_t *l, const tk_allocator_t *allocator) {                        \
+    tk_allocator_validate(allocator);                                          \
+    l->head = NULL;                                                            \
+    l->tail = NULL;                                                            \
+    l->size = 0;                                                               \
+    l->allocator = *allocator;                                                 \
+  }                                                                            \
+                                                                               \
+  static inline void PREFIX##_init(PREFIX##_t *l) {                            \
+    PREFIX##_init_with_allocator(l, tk_allocator_default());                   \
+  }                                                                            \
+                                                                               \
+  static inline void PREFIX##_destroy(PREFIX##_t *l) {                         \
+    PREFIX##_node_t *node = l->head;                                           \
+    while (node) {                                                             \
+      PREFIX##_node_t *next = node->next;                                      \
+      tk_allocator_free(&l->allocator, node, sizeof(PREFIX##_node_t));         \
+      node = next;                                                             \
+    }                                                                          \
+    l->head = NULL;                                                            \
+    l->tail = NULL;                                                            \
+    l->size = 0;                                                               \
+  }                                                                            \
+                                                                               \
+  static inline size_t PREFIX##_size(const PREFIX##_t *l) { return l->size; }  \
+                                                                               \
+  static inline tk_bool PREFIX##_is_empty(const PREFIX##_t *l) {               \
+    return l->size == 0;                                                       \
+  }                                                                            \
+                                                                               \
+  static inline T *PREFIX##_emplace_back(PREFIX##_t *l) {                     \
+    PREFIX##_node_t *node = (PREFIX##_node_t *)tk_allocator_alloc(             \
+        &l->allocator, sizeof(PREFIX##_node_t));                               \
+    if (!node)                                                                 \
+      return NULL;                                                             \
+    node->next = NULL;                                                         \
+    node->prev = l->tail;                                                      \
+    if (l->tail)                                                               \
+      l->tail->next = node;                                                    \
+    else                                                                       \
+      l->head = node;                                                          \
+    l->tail = node;                                                            \
+    l->size++;                                                                 \
+    return &node->value;                                                       \
+  }                                                                            \
+                                                                               \
+  static inline tk_error_t PREFIX##_push_back(PREFIX##_t *l, T value) {        \
+    T *slot = PREFIX##_emplace_back(l);                                        \
+    if (!slot)                                                                 \
+      return TK_E_NOMEM;                                                       \
+    *slot = value;                                                             \
+    return TK_SUCCESS;                                                         \
+  }                                                                            \
+                                                                               \
+  static inline tk_error_t PREFIX##_push_front(PREFIX##_t *l, T value) {       \
+    PREFIX##_node_t *node = (PREFIX##_node_t *)tk_allocator_alloc(             \
+        &l->allocator, sizeof(PREFIX##_node_t));                               \
+    if (!node)                                                                 \
+      return TK_E_NOMEM;                                                       \
+    node->value = value;                                                       \
+    node->prev = NULL;                                                         \
+    node->next = l->head;                                                      \
+    if (l->head)                                                               \
+      l->head->prev = node;                                                    \
+    else                                                                       \
+      l->tail = node;                                                          \
+    l->head = node;                                                            \
+    l->size++;                                                                 \
+    return TK_SUCCESS;                                                         \
+  }                                                                            \
+                                                                               \
+  static inline tk_error_t PREFIX##_pop_back(PREFIX##_t *l, T *out) {          \
+    PREFIX##_node_t *node = l->tail;                                           \
+    if (!node)                                                                 \
+      return TK_E_EMPTY;                                                       \
+    if (out)                                                                   \
+      *out = node->value;                                                      \
+    l->tail = node->prev;                                                      \
+    if (l->tail)                                                               \
+      l->tail->next = NULL;                                                    \
+    else                                                                       \
+      l->head = NULL;                                                          \
+    tk_allocator_free(&l->allocator, node, sizeof(PREFIX##_node_t));           \
+    l->size--;                                                                 \
+    return TK_SUCCESS;                                                         \
+  }                                                                            \
+                                                                               \
+  static inline tk_error_t PREFIX##_pop_front(PREFIX##_t *l, T *out) {         \
+    PREFIX##_node_t *node = l->head;                                           \
+    if (!node)                                                                 \
+      return TK_E_EMPTY;                                                       \
+    if (out)                                                                   \
+      *out = node->value;                                                      \
+    l->head = node->next;                                                      \
+    if (l->head)                                                               \
+      l->head->prev = NULL;                                                    \
+    else                                                                       \
+      l->tail = NULL;                                                          \
+    tk_allocator_free(&l->allocator, node, sizeof(PREFIX##_node_t));           \
+    l->size--;                                                                 \
+    return TK_SUCCESS;                                                         \
+  }                                                                            \
+                                                                               \
+  static inline T *PREFIX##_front(const PREFIX##_t *l) {                       \
+    return l->head ? &l->head->value : NULL;                                   \
+  }                                                                            \
+                                                                               \
+  static inline T *PREFIX##_back(const PREFIX##_t *l) {                        \
+    return l->tail ? &l->tail->value : NULL;                                   \
+  }
+
+#endif // TOOLKIT_DS_TYPED_LIST_H
@@ -0,0 +1,178 @@
+/**
+ * @file typed_vec.h
+ * @brief Code-generation macro for type-specialized dynamic arrays.
+ *
+ * @details
+ * `TK_VEC_DEFINE(prefix, T)` emits a typed vector `prefix_t` holding values
+ * of type `T`, plus a set of `static inline` functions named `prefix_*`.
+ * Because `sizeof(T)` is a compile-time constant, element copies become
+ * plain assignments and accesses return `T *` instead of `void *`, so the
+ * compiler can inline and vectorize everything.
+ *
+ * Unlike `tk_vec_t`, a typed vector is a value type: it lives wherever the
+ * caller puts it and is set up with `prefix_init`. Storage is still obtained
+ * from a `tk_allocator_t`. The generic `tk_vec_t` remains the type-erased
+ * fallback (e.g. for the iterator-based algorithms).
+ *
+ * @code
+ * TK_VEC_DEFINE(int_vec, int)
+ *
+ * int_vec_t v;
+ * int_vec_init(&v);
+ * int_vec_push_back(&v, 42);
+ * int *first = int_vec_at(&v, 0);
+ * int_vec_destroy(&v);
+ * @endcode
+ */
+#ifndef TOOLKIT_DS_TYPED_VEC_H
+#define TOOLKIT_DS_TYPED_VEC_H
+
+#include <stdint.h> // For SIZE_MAX
+#include <tk/core/allocator.h>
+#include <tk/core/error.h>
+#include <tk/core/macros.h>
+#include <tk/core/types.h>
+
+/**
+ * @brief Computes the capacity a typed vector grows to.
+ *
+ * Doubles the current capacity (with a floor of 4) until `needed` fits,
+ * matching the default growth policy of `tk_vec_t`.
+ *
+ * @param capacity The current capacity.
+ * @param needed The minimum capacity required.
+ * @param max The largest capacity whose byte count does not overflow.
+ * @return The new capacity, or 0 if `needed` exceeds `max`.
+ */
+static inline size_t tk_typed_vec_grow_capacity(size_t capacity, size_t needed,
+                                                size_t max) {
+  if (needed > max)
+    return 0;
+  capacity = capacity > max / 2 ? max : capacity * 2;
+  if (capacity < needed)
+    capacity = needed;
+  if (capacity < 4)
+    capacity = 4 < max ? 4 : max;
+  return capacity;
+}
+
+/**
+ * @brief Defines a typed vector `PREFIX##_t` of `T` and its functions.
+ *
+ * Generated API (all `static inline`):
+ * - `void PREFIX##_init(PREFIX##_t *v)`
+ * - `void PREFIX##_init_with_allocator(PREFIX##_t *v, const tk_allocator_t *a)`
+ * - `void PREFIX##_destroy(PREFIX##_t *v)`
+ * - `size_t PREFIX##_size(const PREFIX##_t *v)`
+ * - `tk_bool PREFIX##_is_empty(const PREFIX##_t *v)`
+ * - `size_t PREFIX##_capacity(const PREFIX##_t *v)`
+ * - `tk_error_t PREFIX##_reserve(PREFIX##_t *v, size_t n)`
+ * - `tk_error_t PREFIX##_push_back(PREFIX##_t *v, T value)`
+ * - `T *PREFIX##_emplace_back(PREFIX##_t *v)` (uninitialized; NULL on failure)
+ * - `tk_error_t PREFIX##_pop_back(PREFIX##_t *v, T *out)` (out may be NULL)
+ * - `T *PREFIX##_at(const PREFIX##_t *v, size_t index)` (NULL if out of range)
+ * - `T *PREFIX##_back(const PREFIX##_t *v)` (NULL if empty)
+ * - `T *PREFIX##_data(const PREFIX##_t *v)`
+ * - `void PREFIX##_clear(PREFIX##_t *v)`
+ *
+ * @param PREFIX The name prefix for the generated type and functions.
+ * @param T The element type.
+ */
+#define TK_VEC_DEFINE(PREFIX, T)                                               \
+  typedef struct {                                                             \
+    T *data;                  /* Element storage, or NULL */                   \
+    size_t size;              /* Number of elements stored */                  \
+    size_t capacity;          /* Number of elements 'data' can hold */         \
+    tk_allocator_t allocator; /* Owner of 'data' */                            \
+  } PREFIX##_t;                                                                \
+                                                                               \
+  static inline void PREFIX##_init_with_allocator(                             \
+      PREFIX##_t *v, const tk_allocator_t *allocator) {                        \
+    tk_allocator_validate(allocator);                                          \
+    v->data = NULL;                                                            \
+    v->size = 0;                                                               \
+    v->capacity = 0;                                                           \
+    v->allocator = *allocator;                                                 \
+  }                                                                            \
+                                                                               \
+  static inline void PREFIX##_init(PREFIX##_t *v) {                            \
+    PREFIX##_init_with_allocator(v, tk_allocator_default());                   \
+  }                                                                            \
+                                                                               \
+  static inline void PREFIX##_destroy(PREFIX##_t *v) {                         \
+    tk_allocator_free(&v->allocator, v->data, v->capacity * sizeof(T));        \
+    v->data = NULL;                                                            \
+    v->size = 0;                                                               \
+    v->capacity = 0;                                                           \
+  }                                                                            \
+                                                                               \
+  static inline size_t PREFIX##_size(const PREFIX##_t *v) { return v->size; }  \
+                                                                               \
+  static inline tk_bool PREFIX##_is_empty(const PREFIX##_t *v) {               \
+    return v->size == 0;                                                       \
+  }                                                                            \
+                                                                               \
+  static inline size_t PREFIX##_capacity(const PREFIX##_t *v) {                \
+    return v->capacity;                                                        \
+  }                                                                            \
+                                                                               \
+  static inline tk_error_t PREFIX##_set_capacity(PREFIX##_t *v,                \
+                                                  size_t capacity) {           \
+    T *data = (T *)tk_allocator_realloc(&v->allocator, v->data,                \
+                                        v->capacity * sizeof(T),               \
+                                        capacity * sizeof(T));                 \
+    if (!data)                                                                 \
+      return TK_E_NOMEM;                                                       \
+    v->data = data;                                                            \
+    v->capacity = capacity;                                                    \
+    return TK_SUCCESS;                                                         \
+  }                                                                            \
+                                                                               \
+  static inline tk_error_t PREFIX##_reserve(PREFIX##_t *v, size_t n) {         \
+    if (n <= v->capacity)                                                      \
+      return TK_SUCCESS;                                                       \
+    if (n > SIZE_MAX / sizeof(T))                                              \
+      return TK_E_NOMEM;                                                       \
+    return PREFIX##_set_capacity(v, n);                                        \
+  }                                                                            \
+                                                                               \
+  static inline T *PREFIX##_emplace_back(PREFIX##_t *v) {                     \
+    if (v->size == v->capacity) {                                              \
+      size_t capacity = tk_typed_vec_grow_capacity(                            \
+          v->capacity, v->size + 1, SIZE_MAX / sizeof(T));                     \
+      if (capacity == 0 || PREFIX##_set_capacity(v, capacity) != TK_SUCCESS)   \
+        return NULL;                                                           \
+    }                                                                          \
+    return &v->data[v->size++];                                                \
+  }                                                                            \
+                                                                               \
+  static inline tk_error_t PREFIX##_push_back(PREFIX##_t *v, T value) {        \
+    T *slot = PREFIX##_emplace_back(v);                                        \
+    if (!slot)                                                                 \
+      return TK_E_NOMEM;                                                       \
+    *slot = value;                                                             \
+    return TK_SUCCESS;                                                         \
+  }                                                                            \
+                                                                               \
+  static inline tk_error_t PREFIX##_pop_back(PREFIX##_t *v, T *out) {          \
+    if (v->size == 0)                                                          \
+      return TK_E_EMPTY;                                                       \
+    v->size--;                                                                 \
+    if (out)                                                                   \
+      *out = v->data[v->size];                                                 \
+    return TK_SUCCESS;                                                         \
+  }                                                                            \
+                                                                               \
+  static inline T *PREFIX##_at(const PREFIX##_t *v, size_t index) {            \
+    return index < v->size ? &v->data[index] : NULL;                           \
+  }                                                                            \
+                                                                               \
+  static inline T *PREFIX##_back(const PREFIX##_t *v) {                        \
+    return v->size ? &v->data[v->size - 1] : NULL;                             \
+  }                                                                            \
+                                                                               \
+  static inline T *PREFIX##_data(const PREFIX##_t *v) { return v->data; }      \
+                                                                               \
+  static inline void PREFIX##_clear(PREFIX##_t *v) { v->size = 0; }
+
+#endif // TOOLKIT_DS_TYPED_VEC_H
@@ -5,28 +5,27 @@
  * This file defines the API for a type-safe, generic dynamic array container.
  * It is implemented using an opaque pointer (tk_vec_t) to hide the underlying
  * implementation details, providing a stable and consistent interface.
+ *
+ * Defining `TK_VEC_INLINE` before including this header opts into an inline
+ * mode: the struct layout is exposed and `static inline`, unchecked
+ * accessors (`tk_vec_size_fast`, `tk_vec_at_unchecked`) become available, so
+ * tight loops over the contiguous buffer can be fully inlined and
+ * auto-vectorized. The layout is not part of the stable API.
  */
 #ifndef TOOLKIT_DS_VEC_H
 #define TOOLKIT_DS_VEC_H
 
+#include <tk/core/allocator.h>
 #include <tk/core/error.h>
 #include <tk/core/iterator.h>
+#include <tk/core/macros.h>
 #include <tk/core/types.h>
 
 // Forward declaration of the opaque structure. The user never knows its
 // contents.
 typedef struct tk_vec_t tk_vec_t;
 
-/**
- * @brief Defines a function pointer type for an element destroyer.
- *
- * This function receives a pointer TO the element stored in the vector
- * (e.g., if the vector stores `char*`, this function receives a `char**`).
- * It is responsible for freeing any resources owned by that element.
- *
- * @param element_ptr A pointer to the element within the vector's storage.
- */
-typedef void (*tk_element_destroyer_t)(void *element_ptr);
+// tk_element_destroyer_t comes from <tk/core/types.h>
 
 // --- Lifecycle Functions ---
 
@@ -38,6 +37,113 @@ typedef void (*tk_element_destroyer_t)(void *element_ptr);
  */
 tk_vec_t *tk_vec_create(size_t element_size);
 
+/**
+ * @brief Creates a new vector instance that obtains all of its memory from a
+ * custom allocator.
+ *
+ * The allocator is copied by value; its context must stay valid for the
+ * lifetime of the vector. The element storage and the vector handle itself
+ * are allocated, grown and freed through it.
+ *
+ * @param element_size The size in bytes of each element to be stored in the
+ * vector.
+ * @param allocator The allocator to use. Must not be NULL; pass
+ * `tk_allocator_default()` for malloc/realloc/free behavior.
+ * @return A pointer to the new vector, or NULL if memory allocation fails.
+ */
+tk_vec_t *tk_vec_create_with_allocator(size_t element_size,
+                                       const tk_allocator_t *allocator);
+
+/**
+ * @brief Creates a vector that keeps its first elements inside the handle.
+ *
+ * The handle is allocated together with an inline buffer of `inline_bytes`
+ * (rounded down to whole elements), much like the small-buffer state of
+ * `tk_iterator_t`. Until the vector outgrows that buffer, pushes never touch
+ * the allocator, so a small vector costs a single allocation in total. Once
+ * it spills, the elements move to heap storage as usual; shrinking back to
+ * the inline capacity (`tk_vec_shrink_to_fit`, auto-shrink) moves them home.
+ *
+ * Pointers to elements are invalidated when the vector spills or moves back,
+ * exactly as they are by any other reallocation.
+ *
+ * @param element_size The size in bytes of each element.
+ * @param inline_bytes The size of the inline buffer, in bytes. 0 creates a
+ * regular vector.
+ * @return A pointer to the new vector, or NULL if memory allocation fails.
+ */
+tk_vec_t *tk_vec_create_inline(size_t element_size, size_t inline_bytes);
+
+/**
+ * @brief Like `tk_vec_create_inline`, with a custom allocator for the handle
+ * (including its inline buffer) and any heap storage.
+ * @param element_size The size in bytes of each element.
+ * @param inline_bytes The size of the inline buffer, in bytes.
+ * @param allocator The allocator to use. Must not be NULL.
+ * @return A pointer to the new vector, or NULL if memory allocation fails.
+ */
+tk_vec_t *tk_vec_create_inline_with_allocator(size_t element_size,
+                                              size_t inline_bytes,
+                                              const tk_allocator_t *allocator);
+
+/**
+ * @brief The cache line size assumed by `tk_vec_create_aligned` callers that
+ * want one element per line.
+ */
+#ifndef TK_VEC_CACHE_LINE
+#define TK_VEC_CACHE_LINE 64
+#endif
+
+/**
+ * @brief Flags for `tk_vec_create_aligned`, combined with `|`.
+ */
+enum {
+  TK_VEC_PAD_ELEMENTS = 1 << 0 // Round each slot up to the alignment
+};
+
+/**
+ * @brief Creates a vector whose storage starts on an `alignment` boundary.
+ *
+ * The first element is aligned on creation and after every reallocation
+ * (growth, `tk_vec_reserve`, `tk_vec_shrink_to_fit`, auto-shrink), so the
+ * buffer can be read with aligned vector loads, and a buffer aligned to a
+ * cache line shares no line with unrelated data. The allocator interface
+ * has no alignment argument, so each block is over-allocated by
+ * `alignment - 1` bytes and the elements start at the first boundary in it.
+ *
+ * With TK_VEC_PAD_ELEMENTS, every element also gets a slot of its own,
+ * `element_size` rounded up to `alignment` (see `tk_vec_stride`), e.g. so
+ * per-thread counters written concurrently never share a cache line. The
+ * padding bytes are kept zeroed. Elements are still copied in and out
+ * `element_size` bytes at a time; only the storage is spread out, so
+ * `tk_vec_data` and the iterators step by the stride.
+ *
+ * Aligned vectors cannot hand their buffer out (`tk_vec_take_buffer`), and
+ * swap or move only with vectors of the same layout.
+ *
+ * @param element_size The size in bytes of each element.
+ * @param alignment The alignment of the storage in bytes: a power of two,
+ * such as TK_VEC_CACHE_LINE or the page size.
+ * @param flags 0 or TK_VEC_PAD_ELEMENTS.
+ * @return A pointer to the new vector, or NULL if the arguments are invalid
+ * or memory allocation fails.
+ */
+tk_vec_t *tk_vec_create_aligned(size_t element_size, size_t alignment,
+                                unsigned flags);
+
+/**
+ * @brief Like `tk_vec_create_aligned`, with a custom allocator for the
+ * handle and the (over-allocated) storage.
+ * @param element_size The size in bytes of each element.
+ * @param alignment The alignment of the storage (a power of two).
+ * @param flags 0 or TK_VEC_PAD_ELEMENTS.
+ * @param allocator The allocator to use. Must not be NULL.
+ * @return A pointer to the new vector, or NULL on failure.
+ */
+tk_vec_t *tk_vec_create_aligned_with_allocator(size_t element_size,
+                                               size_t alignment, unsigned flags,
+                                               const tk_allocator_t *allocator);
+
 /**
  * @brief Destroys a vector instance and frees all associated memory.
  * @param vec A pointer to the vector handle to be destroyed. If NULL, the
@@ -87,13 +193,70 @@ size_t tk_vec_capacity(const tk_vec_t *vec);
 
 /**
  * @brief Requests that the vector capacity be at least enough to contain n
- * elements.
+ * elements. Growing allocates exactly `n` elements; a smaller `n` is a no-op.
  * @param vec A pointer to the vector handle.
  * @param n The new capacity.
  * @return TK_SUCCESS on success, TK_E_NOMEM if reallocation fails.
  */
 tk_error_t tk_vec_reserve(tk_vec_t *vec, size_t n);
 
+/**
+ * @brief Reduces the capacity to the current size, returning the unused
+ * storage to the allocator. An empty vector frees its storage entirely; an
+ * inline vector that fits in its buffer moves back into it.
+ * @param vec A pointer to the vector handle.
+ * @return TK_SUCCESS on success, TK_E_NOMEM if the reallocation fails (the
+ * vector is left unchanged).
+ */
+tk_error_t tk_vec_shrink_to_fit(tk_vec_t *vec);
+
+/**
+ * @brief Returns the distance in bytes between consecutive elements: the
+ * element size, or the padded slot size of a TK_VEC_PAD_ELEMENTS vector.
+ * @param vec A constant pointer to the vector handle.
+ * @return The stride of the storage.
+ */
+size_t tk_vec_stride(const tk_vec_t *vec);
+
+/**
+ * @brief Checks whether the elements currently live in the handle's inline
+ * buffer (see `tk_vec_create_inline`).
+ * @param vec A constant pointer to the vector handle.
+ * @return `true` if the storage is inline, `false` otherwise.
+ */
+tk_bool tk_vec_is_inline(const tk_vec_t *vec);
+
+// --- Growth Policy ---
+
+/**
+ * @brief Sets the factor the capacity is multiplied by when a push or insert
+ * runs out of room, as the fraction `num / den` (e.g. 3 / 2 for 1.5x).
+ *
+ * Smaller factors waste less memory at the cost of more reallocations; the
+ * default is the library-wide TK_VEC_GROWTH_NUM / TK_VEC_GROWTH_DEN (2x).
+ *
+ * @param vec A pointer to the vector handle.
+ * @param num The numerator of the factor.
+ * @param den The denominator of the factor.
+ * @return TK_SUCCESS on success, TK_E_INVALID_ARG unless `num > den > 0`.
+ */
+tk_error_t tk_vec_set_growth_factor(tk_vec_t *vec, unsigned num, unsigned den);
+
+/**
+ * @brief Enables or disables automatic shrinking (off by default).
+ *
+ * When enabled, any operation that removes elements (pop, clear, erase,
+ * a shrinking resize or an assign) checks whether the size has dropped to a
+ * quarter of the capacity or less, and if so reallocates to twice the size.
+ * The gap between the shrink threshold and the new capacity means alternating
+ * pushes and pops never thrash, so all operations stay O(1) amortized. A
+ * failed shrink is ignored; the vector simply keeps its storage.
+ *
+ * @param vec A pointer to the vector handle.
+ * @param enable `true` to return memory as the vector drains.
+ */
+void tk_vec_set_auto_shrink(tk_vec_t *vec, tk_bool enable);
+
 // --- Element Access Functions ---
 
 /**
@@ -119,6 +282,19 @@ void *tk_vec_front(const tk_vec_t *vec);
  */
 void *tk_vec_back(const tk_vec_t *vec);
 
+/**
+ * @brief Returns a pointer to the contiguous element storage.
+ *
+ * Elements are laid out back to back, `tk_vec_stride` bytes apart (the
+ * element size, unless the vector pads its elements). The pointer is
+ * invalidated by any operation that grows the vector.
+ *
+ * @param vec A constant pointer to the vector handle.
+ * @return A pointer to the first element, or NULL if no storage has been
+ * allocated yet.
+ */
+void *tk_vec_data(const tk_vec_t *vec);
+
 // --- Modifiers ---
 
 /**
@@ -129,6 +305,20 @@ void *tk_vec_back(const tk_vec_t *vec);
  */
 tk_error_t tk_vec_push_back(tk_vec_t *vec, const void *element);
 
+/**
+ * @brief Appends an uninitialized element and returns a pointer to it, so
+ * the caller can write the element directly into its final location instead
+ * of building it elsewhere and having it copied in.
+ *
+ * The pointer is invalidated by the next operation that grows the vector,
+ * like any other pointer into the storage.
+ *
+ * @param vec A pointer to the vector handle.
+ * @return A pointer to the new, uninitialized element, or NULL if
+ * reallocation fails (the vector is left unchanged).
+ */
+void *tk_vec_emplace_back(tk_vec_t *vec);
+
 /**
  * @brief Removes the last element from the vector.
  * @param vec A pointer to the vector handle.
@@ -136,11 +326,159 @@ tk_error_t tk_vec_push_back(tk_vec_t *vec, const void *element);
 void tk_vec_pop_back(tk_vec_t *vec);
 
 /**
- * @brief Removes all elements from the vector, leaving the capacity unchanged.
+ * @brief Removes all elements from the vector. The capacity is kept for reuse
+ * unless auto-shrink is enabled.
  * @param vec A pointer to the vector handle.
  */
 void tk_vec_clear(tk_vec_t *vec);
 
+// --- Bulk Modifiers ---
+// Each of these grows the storage at most once and moves the elements with a
+// single memcpy/memmove (source elements are copied one by one into padded
+// slots). Source buffers are packed arrays of elements and must not point
+// into the vector itself.
+
+/**
+ * @brief Appends `n` contiguous elements to the end of the vector.
+ * @param vec A pointer to the vector handle.
+ * @param elements A pointer to `n` elements to copy. May be NULL if `n` is 0.
+ * @param n The number of elements to append.
+ * @return TK_SUCCESS on success, TK_E_NOMEM if reallocation fails.
+ */
+tk_error_t tk_vec_push_back_n(tk_vec_t *vec, const void *elements, size_t n);
+
+/**
+ * @brief Inserts `n` contiguous elements before index `at`, shifting the
+ * following elements back.
+ * @param vec A pointer to the vector handle.
+ * @param at The index to insert at (0 to size, inclusive).
+ * @param src A pointer to `n` elements to copy. May be NULL if `n` is 0.
+ * @param n The number of elements to insert.
+ * @return TK_SUCCESS on success, TK_E_OUT_OF_BOUNDS if `at` is greater than
+ * the size, TK_E_NOMEM if reallocation fails.
+ */
+tk_error_t tk_vec_insert_range(tk_vec_t *vec, size_t at, const void *src,
+                               size_t n);
+
+/**
+ * @brief Removes the `n` elements starting at index `at`, shifting the
+ * following elements forward. The capacity is unchanged unless auto-shrink
+ * is enabled.
+ * @param vec A pointer to the vector handle.
+ * @param at The index of the first element to remove.
+ * @param n The number of elements to remove.
+ * @return TK_SUCCESS on success, TK_E_OUT_OF_BOUNDS if the range
+ * [at, at + n) is not inside the vector.
+ */
+tk_error_t tk_vec_erase_range(tk_vec_t *vec, size_t at, size_t n);
+
+/**
+ * @brief Changes the number of elements to `n`.
+ * Shrinking drops the trailing elements and keeps the capacity (unless
+ * auto-shrink is enabled). Growing
+ * appends copies of `fill`, or zero bytes if `fill` is NULL.
+ * @param vec A pointer to the vector handle.
+ * @param n The new number of elements.
+ * @param fill A pointer to the value for new elements, or NULL to zero them.
+ * @return TK_SUCCESS on success, TK_E_NOMEM if reallocation fails.
+ */
+tk_error_t tk_vec_resize(tk_vec_t *vec, size_t n, const void *fill);
+
+/**
+ * @brief Replaces the contents of the vector with `n` contiguous elements.
+ * @param vec A pointer to the vector handle.
+ * @param src A pointer to `n` elements to copy. May be NULL if `n` is 0.
+ * @param n The number of elements to copy.
+ * @return TK_SUCCESS on success, TK_E_NOMEM if reallocation fails (the
+ * vector is left empty).
+ */
+tk_error_t tk_vec_assign(tk_vec_t *vec, const void *src, size_t n);
+
+// --- Ownership Transfer ---
+// These hand the element storage itself over instead of copying elements.
+// A buffer that crosses the API boundary belongs to the vector's allocator:
+// it must have been allocated from it, and must be freed through it with
+// its full size, `capacity * element_size` bytes (for the default allocator,
+// plain malloc and free).
+
+/**
+ * @brief Creates a vector that adopts an existing buffer as its storage,
+ * without copying it.
+ * @param element_size The size in bytes of each element.
+ * @param buffer A buffer of `capacity` elements obtained from `malloc` (the
+ * default allocator), or NULL if `capacity` is 0. On success the vector owns
+ * it; on failure the caller still does.
+ * @param size The number of initialized elements at the start of `buffer`.
+ * @param capacity The number of elements `buffer` can hold (>= `size`).
+ * @return A pointer to the new vector, or NULL if the arguments are invalid
+ * or memory allocation fails.
+ */
+tk_vec_t *tk_vec_from_buffer(size_t element_size, void *buffer, size_t size,
+                             size_t capacity);
+
+/**
+ * @brief Like `tk_vec_from_buffer`, for a buffer obtained from `allocator`.
+ * @param element_size The size in bytes of each element.
+ * @param buffer A buffer of `capacity` elements from `allocator`, or NULL.
+ * @param size The number of initialized elements.
+ * @param capacity The number of elements `buffer` can hold.
+ * @param allocator The allocator the buffer came from, which the vector then
+ * uses for everything. Must not be NULL.
+ * @return A pointer to the new vector, or NULL on failure.
+ */
+tk_vec_t *tk_vec_from_buffer_with_allocator(size_t element_size, void *buffer,
+                                            size_t size, size_t capacity,
+                                            const tk_allocator_t *allocator);
+
+/**
+ * @brief Detaches the element storage, leaving the vector empty.
+ *
+ * O(1) for heap storage. Elements in the inline buffer of an inline vector
+ * are first copied to an exactly sized heap buffer, since the inline buffer
+ * cannot outlive the handle. The vector stays usable afterwards.
+ *
+ * @param vec A pointer to the vector handle.
+ * @param buffer Receives the storage (NULL if there is none). The caller
+ * must free it through the vector's allocator.
+ * @param size Receives the number of elements, or NULL.
+ * @param capacity Receives the capacity of the buffer in elements, or NULL.
+ * @return TK_SUCCESS, TK_E_INVALID_ARG for an aligned vector (its buffer
+ * does not start at the block the allocator returned), or TK_E_NOMEM if
+ * copying inline elements out fails (the vector is left unchanged).
+ */
+tk_error_t tk_vec_take_buffer(tk_vec_t *vec, void **buffer, size_t *size,
+                              size_t *capacity);
+
+/**
+ * @brief Exchanges the elements of two vectors.
+ *
+ * O(1) when both keep their elements on the heap; inline elements are first
+ * copied to the heap, and moved back into an inline buffer afterwards if
+ * they fit. Each vector keeps its own growth policy and inline buffer.
+ *
+ * @param a A pointer to the first vector.
+ * @param b A pointer to the second vector.
+ * @return TK_SUCCESS, TK_E_INVALID_ARG if the element sizes, layouts
+ * (alignment, padding) or allocators differ, or TK_E_NOMEM if copying inline
+ * elements out fails (both vectors then keep their elements).
+ */
+tk_error_t tk_vec_swap(tk_vec_t *a, tk_vec_t *b);
+
+/**
+ * @brief Transfers the elements of `src` to `dest`, leaving `src` empty.
+ *
+ * The previous elements of `dest` are dropped (use `tk_vec_destroy_full`-
+ * style cleanup first if they own resources). O(1) when `src` keeps its
+ * elements on the heap; inline elements are copied.
+ *
+ * @param dest A pointer to the vector that receives the elements.
+ * @param src A pointer to the vector to empty.
+ * @return TK_SUCCESS, TK_E_INVALID_ARG if the element sizes, layouts
+ * (alignment, padding) or allocators differ, or TK_E_NOMEM if copying inline
+ * elements fails (`dest` is then left empty and `src` unchanged).
+ */
+tk_error_t tk_vec_move(tk_vec_t *dest, tk_vec_t *src);
+
 // --- Iterator Functions ---
 
 /**
@@ -157,4 +495,97 @@ tk_iterator_t tk_vec_begin(tk_vec_t *vec);
  */
 tk_iterator_t tk_vec_end(tk_vec_t *vec);
 
+// --- Inline Mode ---
+
+#ifdef TK_VEC_INLINE
+
+/**
+ * @struct tk_vec_t
+ * @brief The dynamic array (vector) layout, exposed for the inline accessors.
+ * @warning Treat every field as private; use the functions in this header.
+ */
+struct tk_vec_t {
+  /**
+   * @brief The element storage: NULL while the capacity is 0, the inline
+   * buffer that follows the handle, or a heap block.
+   */
+  char *data;
+
+  /**
+   * @brief The number of elements currently stored.
+   */
+  size_t size;
+
+  /**
+   * @brief The number of elements 'data' can hold.
+   */
+  size_t capacity;
+
+  /**
+   * @brief The distance in bytes between consecutive elements (the stride).
+   */
+  size_t element_size;
+
+  /**
+   * @brief The bytes of each element copied in and out: 'element_size',
+   * unless the slots are padded.
+   */
+  size_t value_size;
+
+  /**
+   * @brief The alignment of heap storage, or 0 for the allocator's own.
+   */
+  size_t alignment;
+
+  /**
+   * @brief The distance from the heap block to 'data' (0 unless aligned).
+   */
+  size_t data_offset;
+
+  /**
+   * @brief The allocator that owns 'data' and this handle.
+   */
+  tk_allocator_t allocator;
+
+  /**
+   * @brief The growth factor, as growth_num / growth_den (always > 1).
+   */
+  unsigned growth_num;
+  unsigned growth_den;
+
+  /**
+   * @brief Whether removing elements may give storage back.
+   */
+  tk_bool auto_shrink;
+
+  /**
+   * @brief The number of elements the inline buffer holds (0 if none).
+   */
+  size_t inline_capacity;
+};
+
+/**
+ * @brief Returns the number of elements in the vector, inlined.
+ * @param vec A constant pointer to the vector handle. Must not be NULL.
+ * @return The number of elements.
+ */
+static inline size_t tk_vec_size_fast(const tk_vec_t *vec) {
+  return vec->size;
+}
+
+/**
+ * @brief Returns a pointer to the element at `index` without bounds
+ * checking, inlined.
+ * @param vec A constant pointer to the vector handle. Must not be NULL.
+ * @param index The index of the element. Must be less than the size
+ * (asserted in debug builds).
+ * @return A pointer to the element.
+ */
+static inline void *tk_vec_at_unchecked(const tk_vec_t *vec, size_t index) {
+  TK_ASSERT(index < vec->size);
+  return vec->data + index * vec->element_size;
+}
+
+#endif // TK_VEC_INLINE
+
 #endif // TOOLKIT_DS_VEC_H
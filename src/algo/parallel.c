@@ -0,0 +1,302 @@
+/**
+ * @file parallel.c
+ * @brief Implements the multi-threaded sequence algorithms.
+ *
+ * @details
+ * Every algorithm is expressed as a job over a span of `count` elements:
+ * either a contiguous array, or any other random-access range, whose blocks
+ * are reached with `tk_iter_advance_n` from a copy of `begin`. Workers (the
+ * calling thread plus up to `num_threads - 1` tasks on the shared
+ * `tk_pool_default()` pool) claim fixed-size blocks from a shared atomic
+ * cursor, so blocks are handed out in increasing order and fast workers
+ * simply take more of them. A block callback returning `false` makes its
+ * worker stop claiming; `find_if` uses this to cancel every block that
+ * starts after the best match found so far.
+ */
+
+#define _POSIX_C_SOURCE 200809L // For sysconf
+
+#include <unistd.h>
+#include <tk/algo/parallel.h>
+#include <tk/core/atomic.h>
+#include <tk/core/macros.h>
+#include <tk/core/pool.h>
+
+/**
+ * @brief Ranges shorter than this are not worth a thread.
+ */
+#define TK_PAR_MIN_BLOCK 4096
+
+/**
+ * @brief Target number of blocks per worker, for load balancing.
+ */
+#define TK_PAR_BLOCKS_PER_WORKER 8
+
+typedef struct tk_par_job_t tk_par_job_t;
+
+/**
+ * @brief Processes elements [first, last) of a job.
+ * @return `true` to keep claiming blocks, `false` to stop this worker.
+ */
+typedef tk_bool (*tk_par_block_fn_t)(tk_par_job_t *job, size_t first,
+                                     size_t last);
+
+/**
+ * @brief Shared state of one parallel call.
+ */
+struct tk_par_job_t {
+  char *data;             // First element of the input span, or NULL
+  tk_iterator_t begin;    // Start of the input range (when 'data' is NULL)
+  size_t stride;          // Input element stride
+  char *out;              // First output element (transform)
+  size_t out_stride;      // Output element stride (transform)
+  size_t count;           // Number of elements
+  size_t block;           // Elements per claimed block
+  size_t next;            // (atomic) Start of the next unclaimed block
+  size_t result;          // (atomic) Match index (find_if) or count
+  tk_par_block_fn_t body; // Block callback
+
+  // The user callback of the running algorithm.
+  void (*fn)(void *element);
+  tk_bool (*predicate)(const void *element);
+  void (*op)(const void *in, void *out);
+};
+
+// --- Scheduling ---
+
+/**
+ * @brief Claims and processes blocks until the range is exhausted or the
+ * block callback asks to stop.
+ */
+static void tk_par_worker(void *arg) {
+  tk_par_job_t *job = (tk_par_job_t *)arg;
+  for (;;) {
+    size_t first = TK_ATOMIC_FETCH_ADD(&job->next, job->block,
+                                       TK_ATOMIC_RELAXED);
+    if (first >= job->count)
+      break;
+    size_t last = job->count - first < job->block ? job->count
+                                                  : first + job->block;
+    if (!job->body(job, first, last))
+      break;
+  }
+}
+
+/**
+ * @brief Runs 'job' with up to 'num_threads' workers and waits for all of
+ * them. Falls back to fewer workers (down to just the caller) if the pool
+ * is unavailable or a task cannot be submitted. Waiting runs pool tasks, so
+ * calling this from inside a pool task is safe.
+ */
+static void tk_par_run(tk_par_job_t *job, size_t num_threads) {
+  if (num_threads == 0)
+    num_threads = tk_algo_par_hardware_threads();
+
+  size_t max_workers = (job->count + TK_PAR_MIN_BLOCK - 1) / TK_PAR_MIN_BLOCK;
+  size_t workers = num_threads < max_workers ? num_threads : max_workers;
+  if (workers == 0)
+    workers = 1;
+
+  job->block = job->count / (workers * TK_PAR_BLOCKS_PER_WORKER);
+  if (job->block < TK_PAR_MIN_BLOCK)
+    job->block = TK_PAR_MIN_BLOCK;
+  job->next = 0;
+
+  tk_pool_t *pool = workers > 1 ? tk_pool_default() : NULL;
+  if (!pool) {
+    tk_par_worker(job);
+    return;
+  }
+
+  tk_wait_group_t wg;
+  tk_wait_group_init(&wg);
+  for (size_t i = 1; i < workers; ++i) {
+    if (tk_pool_submit(pool, tk_par_worker, job, &wg) != TK_SUCCESS)
+      break;
+  }
+  tk_par_worker(job);
+  tk_pool_wait(pool, &wg);
+}
+
+/**
+ * @brief Describes the range [begin, end) in 'job': as a contiguous span
+ * when the iterators expose one ('data' set), otherwise through
+ * 'job->begin' and the O(1) distance of random-access iterators.
+ */
+static void tk_par_span(tk_par_job_t *job, const tk_iterator_t *begin,
+                        const tk_iterator_t *end) {
+  TK_ASSERT(begin->vtable != NULL && begin->vtable == end->vtable &&
+            "tk_algo_par: 'begin' and 'end' must be of the same type.");
+  TK_ASSERT(begin->vtable->category == TK_ITER_RANDOM_ACCESS &&
+            "tk_algo_par: random-access iterators are required.");
+
+  job->begin = *begin;
+  char *first = (char *)tk_iter_contiguous(begin, &job->stride);
+  if (first) {
+    char *last = (char *)tk_iter_contiguous(end, &job->stride);
+    job->data = first;
+    job->count = (size_t)(last - first) / job->stride;
+    return;
+  }
+  job->data = NULL;
+  job->count = (size_t)tk_iter_distance(begin, end);
+}
+
+/**
+ * @brief Returns an iterator to element 'first' of an iterator job.
+ */
+static tk_iterator_t tk_par_iter_at(const tk_par_job_t *job, size_t first) {
+  tk_iterator_t it;
+  tk_iter_clone(&it, &job->begin);
+  tk_iter_advance_n(&it, (ptrdiff_t)first);
+  return it;
+}
+
+// --- Block Callbacks ---
+
+static tk_bool tk_par_for_each_block(tk_par_job_t *job, size_t first,
+                                     size_t last) {
+  if (!job->data) {
+    tk_iterator_t it = tk_par_iter_at(job, first);
+    for (size_t i = first; i < last; ++i, tk_iter_next(&it))
+      job->fn(tk_iter_get(&it));
+    return true;
+  }
+
+  char *element = job->data + first * job->stride;
+  for (size_t i = first; i < last; ++i, element += job->stride)
+    job->fn(element);
+  return true;
+}
+
+static tk_bool tk_par_find_if_block(tk_par_job_t *job, size_t first,
+                                    size_t last) {
+  // Blocks are claimed in order, so once a match lies before this block,
+  // every block this worker could still claim lies after it too.
+  if (TK_ATOMIC_LOAD(&job->result, TK_ATOMIC_RELAXED) < first)
+    return false;
+
+  size_t i = first;
+  if (!job->data) {
+    tk_iterator_t it = tk_par_iter_at(job, first);
+    for (; i < last && !job->predicate(tk_iter_get(&it)); ++i)
+      tk_iter_next(&it);
+  } else {
+    const char *element = job->data + first * job->stride;
+    for (; i < last && !job->predicate(element); ++i)
+      element += job->stride;
+  }
+  if (i == last)
+    return true;
+
+  size_t best = TK_ATOMIC_LOAD(&job->result, TK_ATOMIC_RELAXED);
+  while (i < best &&
+         !TK_ATOMIC_CAS_WEAK(&job->result, &best, i, TK_ATOMIC_RELAXED,
+                             TK_ATOMIC_RELAXED)) {
+  }
+  return false;
+}
+
+static tk_bool tk_par_count_if_block(tk_par_job_t *job, size_t first,
+                                     size_t last) {
+  size_t local = 0;
+  if (!job->data) {
+    tk_iterator_t it = tk_par_iter_at(job, first);
+    for (size_t i = first; i < last; ++i, tk_iter_next(&it))
+      local += job->predicate(tk_iter_get(&it)) ? 1 : 0;
+  } else {
+    const char *element = job->data + first * job->stride;
+    for (size_t i = first; i < last; ++i, element += job->stride)
+      local += job->predicate(element) ? 1 : 0;
+  }
+  TK_ATOMIC_FETCH_ADD(&job->result, local, TK_ATOMIC_RELAXED);
+  return true;
+}
+
+static tk_bool tk_par_transform_block(tk_par_job_t *job, size_t first,
+                                      size_t last) {
+  const char *in = job->data + first * job->stride;
+  char *out = job->out + first * job->out_stride;
+  for (size_t i = first; i < last; ++i) {
+    job->op(in, out);
+    in += job->stride;
+    out += job->out_stride;
+  }
+  return true;
+}
+
+// --- Public Functions ---
+
+size_t tk_algo_par_hardware_threads(void) {
+  long n = sysconf(_SC_NPROCESSORS_ONLN);
+  return n > 0 ? (size_t)n : 1;
+}
+
+void tk_algo_par_for_each(tk_iterator_t begin, tk_iterator_t end,
+                          void (*fn)(void *element), size_t num_threads) {
+  TK_ASSERT(fn != NULL);
+  tk_par_job_t job = {0};
+  tk_par_span(&job, &begin, &end);
+  job.body = tk_par_for_each_block;
+  job.fn = fn;
+  tk_par_run(&job, num_threads);
+}
+
+tk_iterator_t tk_algo_par_find_if(tk_iterator_t begin, tk_iterator_t end,
+                                  tk_bool (*predicate)(const void *element),
+                                  size_t num_threads) {
+  TK_ASSERT(predicate != NULL);
+  tk_par_job_t job = {0};
+  tk_par_span(&job, &begin, &end);
+  job.body = tk_par_find_if_block;
+  job.predicate = predicate;
+  job.result = job.count; // "No match"
+  tk_par_run(&job, num_threads);
+
+  if (job.result == job.count)
+    return end;
+  tk_iter_advance_n(&begin, (ptrdiff_t)job.result);
+  return begin;
+}
+
+size_t tk_algo_par_count_if(tk_iterator_t begin, tk_iterator_t end,
+                            tk_bool (*predicate)(const void *element),
+                            size_t num_threads) {
+  TK_ASSERT(predicate != NULL);
+  tk_par_job_t job = {0};
+  tk_par_span(&job, &begin, &end);
+  job.body = tk_par_count_if_block;
+  job.predicate = predicate;
+  tk_par_run(&job, num_threads);
+  return job.result;
+}
+
+tk_iterator_t tk_algo_par_transform(tk_iterator_t begin, tk_iterator_t end,
+                                    tk_iterator_t out,
+                                    void (*op)(const void *in, void *out),
+                                    size_t num_threads) {
+  TK_ASSERT(op != NULL);
+  TK_ASSERT(out.vtable != NULL &&
+            out.vtable->category == TK_ITER_RANDOM_ACCESS &&
+            "tk_algo_par_transform: 'out' must be random-access.");
+  tk_par_job_t job = {0};
+  tk_par_span(&job, &begin, &end);
+  if (job.data)
+    job.out = (char *)tk_iter_contiguous(&out, &job.out_stride);
+
+  // The output is written in place, so only contiguous ranges are split.
+  if (!job.data || !job.out) {
+    for (; !tk_iter_equal(&begin, &end); tk_iter_next(&begin)) {
+      op(tk_iter_get(&begin), tk_iter_get(&out));
+      tk_iter_next(&out);
+    }
+    return out;
+  }
+
+  job.body = tk_par_transform_block;
+  job.op = op;
+  tk_par_run(&job, num_threads);
+
+  tk_iter_advance_n(&out, (ptrdiff_t)job.count);
+  return out;
+}
@@ -0,0 +1,797 @@
+/**
+ * @file search.c
+ * @brief Implements the vectorized value searches.
+ *
+ * @details
+ * Every scalar type has three kernels over a dense array (find, count and
+ * min_max), collected in a `tk_search_ops_t`. The portable kernels are
+ * written once, as the TK_SEARCH_DEFINE_PORTABLE template. Each instruction
+ * set then instantiates the TK_SEARCH_DEFINE_EQ and TK_SEARCH_DEFINE_MIN_MAX
+ * templates with its own vector type and primitives. Those kernels process
+ * whole vectors and hand the remaining tail to the portable kernel of the
+ * same type. Equality does not depend on signedness, so the signed and
+ * unsigned integer types of one width share their find and count kernels.
+ *
+ * The ISA table is picked on every call: AVX2 if the CPU reports it (the
+ * kernels are compiled with a `target` attribute, so the library itself
+ * needs no -mavx2), otherwise the baseline SSE2 or NEON table.
+ *
+ * Ranges that are not densely packed are copied, TK_SEARCH_BLOCK elements
+ * at a time, into a small staging buffer and run through the same kernels.
+ */
+
+#include <string.h>
+#include <tk/algo/search.h>
+#include <tk/core/macros.h>
+
+#if !defined(TK_SEARCH_PORTABLE)
+#if defined(__SSE2__) || defined(_M_X64) ||                                    \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TK_SEARCH_SSE2
+#include <emmintrin.h>
+#if defined(__GNUC__) || defined(__clang__)
+#define TK_SEARCH_AVX2
+#include <immintrin.h>
+#endif
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define TK_SEARCH_NEON
+#include <arm_neon.h>
+#endif
+#endif
+
+/**
+ * @brief Number of elements staged per block for non-dense ranges.
+ */
+#define TK_SEARCH_BLOCK 64
+
+/**
+ * @brief Returns the index of the first element equal to `*value`, or
+ * `count` if there is none.
+ */
+typedef size_t (*tk_search_find_fn_t)(const char *data, size_t count,
+                                      const void *value);
+
+/**
+ * @brief Returns the number of elements equal to `*value`.
+ */
+typedef size_t (*tk_search_count_fn_t)(const char *data, size_t count,
+                                       const void *value);
+
+/**
+ * @brief Stores the smallest and largest of `count` (>= 1) elements.
+ */
+typedef void (*tk_search_min_max_fn_t)(const char *data, size_t count,
+                                       void *min, void *max);
+
+/**
+ * @brief The kernels for one scalar type.
+ */
+typedef struct {
+  size_t size; // sizeof the scalar type
+  tk_search_find_fn_t find;
+  tk_search_count_fn_t count;
+  tk_search_min_max_fn_t min_max;
+} tk_search_ops_t;
+
+// --- Portable Kernels ---
+
+/**
+ * @brief Defines the portable find and count kernels for one scalar type.
+ * Elements are read with memcpy, which compiles to a plain load.
+ *
+ * Integer equality does not depend on the sign, so these are only
+ * instantiated once per width (the unsigned type) and shared by both
+ * signednesses; floats keep their own, since -0.0 == 0.0 and NaN != NaN.
+ */
+#define TK_SEARCH_DEFINE_PORTABLE_EQ(NAME, T)                                  \
+  static size_t tk_search_find_##NAME(const char *data, size_t count,          \
+                                      const void *value) {                     \
+    T v, x;                                                                    \
+    memcpy(&v, value, sizeof(T));                                              \
+    for (size_t i = 0; i < count; ++i) {                                       \
+      memcpy(&x, data + i * sizeof(T), sizeof(T));                             \
+      if (x == v)                                                              \
+        return i;                                                              \
+    }                                                                          \
+    return count;                                                              \
+  }                                                                            \
+                                                                               \
+  static size_t tk_search_count_##NAME(const char *data, size_t count,         \
+                                       const void *value) {                    \
+    T v, x;                                                                    \
+    memcpy(&v, value, sizeof(T));                                              \
+    size_t n = 0;                                                              \
+    for (size_t i = 0; i < count; ++i) {                                       \
+      memcpy(&x, data + i * sizeof(T), sizeof(T));                             \
+      n += x == v;                                                             \
+    }                                                                          \
+    return n;                                                                  \
+  }
+
+/**
+ * @brief Defines the portable min_max kernel for one scalar type.
+ */
+#define TK_SEARCH_DEFINE_PORTABLE_MIN_MAX(NAME, T)                             \
+  static void tk_search_min_max_##NAME(const char *data, size_t count,         \
+                                       void *min, void *max) {                 \
+    T lo, hi, x;                                                               \
+    memcpy(&lo, data, sizeof(T));                                              \
+    hi = lo;                                                                   \
+    for (size_t i = 1; i < count; ++i) {                                       \
+      memcpy(&x, data + i * sizeof(T), sizeof(T));                             \
+      if (x < lo)                                                              \
+        lo = x;                                                                \
+      if (x > hi)                                                              \
+        hi = x;                                                                \
+    }                                                                          \
+    memcpy(min, &lo, sizeof(T));                                               \
+    memcpy(max, &hi, sizeof(T));                                               \
+  }
+
+TK_SEARCH_DEFINE_PORTABLE_EQ(u8, uint8_t)
+TK_SEARCH_DEFINE_PORTABLE_EQ(u16, uint16_t)
+TK_SEARCH_DEFINE_PORTABLE_EQ(u32, uint32_t)
+TK_SEARCH_DEFINE_PORTABLE_EQ(u64, uint64_t)
+TK_SEARCH_DEFINE_PORTABLE_EQ(f32, float)
+TK_SEARCH_DEFINE_PORTABLE_EQ(f64, double)
+
+TK_SEARCH_DEFINE_PORTABLE_MIN_MAX(i8, int8_t)
+TK_SEARCH_DEFINE_PORTABLE_MIN_MAX(u8, uint8_t)
+TK_SEARCH_DEFINE_PORTABLE_MIN_MAX(i16, int16_t)
+TK_SEARCH_DEFINE_PORTABLE_MIN_MAX(u16, uint16_t)
+TK_SEARCH_DEFINE_PORTABLE_MIN_MAX(i32, int32_t)
+TK_SEARCH_DEFINE_PORTABLE_MIN_MAX(u32, uint32_t)
+TK_SEARCH_DEFINE_PORTABLE_MIN_MAX(i64, int64_t)
+TK_SEARCH_DEFINE_PORTABLE_MIN_MAX(u64, uint64_t)
+TK_SEARCH_DEFINE_PORTABLE_MIN_MAX(f32, float)
+TK_SEARCH_DEFINE_PORTABLE_MIN_MAX(f64, double)
+
+#if !defined(TK_SEARCH_SSE2) && !defined(TK_SEARCH_NEON)
+static const tk_search_ops_t g_search_portable[] = {
+    {1, tk_search_find_u8, tk_search_count_u8, tk_search_min_max_i8},
+    {1, tk_search_find_u8, tk_search_count_u8, tk_search_min_max_u8},
+    {2, tk_search_find_u16, tk_search_count_u16, tk_search_min_max_i16},
+    {2, tk_search_find_u16, tk_search_count_u16, tk_search_min_max_u16},
+    {4, tk_search_find_u32, tk_search_count_u32, tk_search_min_max_i32},
+    {4, tk_search_find_u32, tk_search_count_u32, tk_search_min_max_u32},
+    {8, tk_search_find_u64, tk_search_count_u64, tk_search_min_max_i64},
+    {8, tk_search_find_u64, tk_search_count_u64, tk_search_min_max_u64},
+    {4, tk_search_find_f32, tk_search_count_f32, tk_search_min_max_f32},
+    {8, tk_search_find_f64, tk_search_count_f64, tk_search_min_max_f64}};
+#endif
+
+// --- SIMD Templates ---
+
+/**
+ * @brief Defines the find and count kernels of one type for one ISA.
+ *
+ * MATCH(ptr, v) compares the WIDTH-byte vector at 'ptr' with the splatted
+ * value and returns a bit mask with BITS bits per byte for every equal
+ * element, so the first match is at ctz / (BITS * sizeof(T)). ATTR holds
+ * the function attributes the ISA needs (empty for the baseline ones).
+ */
+#define TK_SEARCH_DEFINE_EQ(ATTR, ISA, NAME, T, VEC, WIDTH, SPLAT, MATCH,      \
+                            BITS)                                              \
+  static ATTR size_t tk_search_find_##NAME##_##ISA(                            \
+      const char *data, size_t count, const void *value) {                     \
+    const size_t lanes = (WIDTH) / sizeof(T);                                  \
+    VEC v = SPLAT(value, sizeof(T));                                           \
+    size_t i = 0;                                                              \
+    for (; i + lanes <= count; i += lanes) {                                   \
+      uint64_t mask = MATCH(data + i * sizeof(T), v);                          \
+      if (mask)                                                                \
+        return i + TK_CTZ64(mask) / ((BITS) * sizeof(T));                      \
+    }                                                                          \
+    return i + tk_search_find_##NAME(data + i * sizeof(T), count - i, value);  \
+  }                                                                            \
+                                                                               \
+  static ATTR size_t tk_search_count_##NAME##_##ISA(                           \
+      const char *data, size_t count, const void *value) {                     \
+    const size_t lanes = (WIDTH) / sizeof(T);                                  \
+    VEC v = SPLAT(value, sizeof(T));                                           \
+    size_t bits = 0, i = 0;                                                    \
+    for (; i + lanes <= count; i += lanes)                                     \
+      bits += TK_POPCOUNT64(MATCH(data + i * sizeof(T), v));                   \
+    return bits / ((BITS) * sizeof(T)) +                                       \
+           tk_search_count_##NAME(data + i * sizeof(T), count - i, value);     \
+  }
+
+/**
+ * @brief Defines the min_max kernel of one type for one ISA.
+ *
+ * The running minimum and maximum are kept per lane. At the end the lanes
+ * and the tail are reduced together with a single portable pass.
+ */
+#define TK_SEARCH_DEFINE_MIN_MAX(ATTR, ISA, NAME, T, VEC, WIDTH, LOAD, STORE,  \
+                                 MIN, MAX)                                     \
+  static ATTR void tk_search_min_max_##NAME##_##ISA(                           \
+      const char *data, size_t count, void *min, void *max) {                  \
+    enum { LANES = (WIDTH) / sizeof(T) };                                      \
+    if (count < 2 * LANES) {                                                   \
+      tk_search_min_max_##NAME(data, count, min, max);                         \
+      return;                                                                  \
+    }                                                                          \
+    VEC lo = LOAD(data), hi = lo;                                              \
+    size_t i = LANES;                                                          \
+    for (; i + LANES <= count; i += LANES) {                                   \
+      VEC x = LOAD(data + i * sizeof(T));                                      \
+      lo = MIN(x, lo);                                                         \
+      hi = MAX(x, hi);                                                         \
+    }                                                                          \
+    T lanes[3 * LANES];                                                        \
+    STORE(lanes, lo);                                                          \
+    STORE(lanes + LANES, hi);                                                  \
+    memcpy(lanes + 2 * LANES, data + i * sizeof(T), (count - i) * sizeof(T));  \
+    tk_search_min_max_##NAME((const char *)lanes, 2 * LANES + (count - i),     \
+                             min, max);                                        \
+  }
+
+// --- SSE2 Kernels ---
+
+#if defined(TK_SEARCH_SSE2)
+
+static inline __m128i tk_sse2_splat(const void *value, size_t size) {
+  unsigned char bytes[16];
+  for (size_t i = 0; i < 16; i += size)
+    memcpy(bytes + i, value, size);
+  return _mm_loadu_si128((const __m128i *)bytes);
+}
+
+static inline __m128i tk_sse2_load(const void *p) {
+  return _mm_loadu_si128((const __m128i *)p);
+}
+
+static inline void tk_sse2_store(void *p, __m128i v) {
+  _mm_storeu_si128((__m128i *)p, v);
+}
+
+static inline __m128 tk_sse2_load_ps(const void *p) {
+  return _mm_loadu_ps((const float *)p);
+}
+
+static inline void tk_sse2_store_ps(void *p, __m128 v) {
+  _mm_storeu_ps((float *)p, v);
+}
+
+static inline __m128d tk_sse2_load_pd(const void *p) {
+  return _mm_loadu_pd((const double *)p);
+}
+
+static inline void tk_sse2_store_pd(void *p, __m128d v) {
+  _mm_storeu_pd((double *)p, v);
+}
+
+static inline uint64_t tk_sse2_mask(__m128i eq) {
+  return (uint32_t)_mm_movemask_epi8(eq);
+}
+
+static inline uint64_t tk_sse2_match8(const char *p, __m128i v) {
+  return tk_sse2_mask(_mm_cmpeq_epi8(tk_sse2_load(p), v));
+}
+
+static inline uint64_t tk_sse2_match16(const char *p, __m128i v) {
+  return tk_sse2_mask(_mm_cmpeq_epi16(tk_sse2_load(p), v));
+}
+
+static inline uint64_t tk_sse2_match32(const char *p, __m128i v) {
+  return tk_sse2_mask(_mm_cmpeq_epi32(tk_sse2_load(p), v));
+}
+
+static inline uint64_t tk_sse2_match64(const char *p, __m128i v) {
+  // No 64-bit compare in SSE2: both 32-bit halves must be equal.
+  __m128i eq = _mm_cmpeq_epi32(tk_sse2_load(p), v);
+  return tk_sse2_mask(
+      _mm_and_si128(eq, _mm_shuffle_epi32(eq, _MM_SHUFFLE(2, 3, 0, 1))));
+}
+
+static inline uint64_t tk_sse2_match_f32(const char *p, __m128i v) {
+  return tk_sse2_mask(
+      _mm_castps_si128(_mm_cmpeq_ps(tk_sse2_load_ps(p), _mm_castsi128_ps(v))));
+}
+
+static inline uint64_t tk_sse2_match_f64(const char *p, __m128i v) {
+  return tk_sse2_mask(
+      _mm_castpd_si128(_mm_cmpeq_pd(tk_sse2_load_pd(p), _mm_castsi128_pd(v))));
+}
+
+/**
+ * @brief Selects 'b' where 'mask' is set and 'a' elsewhere.
+ */
+static inline __m128i tk_sse2_select(__m128i mask, __m128i a, __m128i b) {
+  return _mm_or_si128(_mm_and_si128(mask, b), _mm_andnot_si128(mask, a));
+}
+
+// SSE2 only has min/max for u8 and i16; the other 8- to 32-bit types flip
+// the sign bit to reuse them, or compare and select.
+
+static inline __m128i tk_sse2_min_i8(__m128i a, __m128i b) {
+  __m128i bias = _mm_set1_epi8((char)0x80);
+  return _mm_xor_si128(
+      _mm_min_epu8(_mm_xor_si128(a, bias), _mm_xor_si128(b, bias)), bias);
+}
+
+static inline __m128i tk_sse2_max_i8(__m128i a, __m128i b) {
+  __m128i bias = _mm_set1_epi8((char)0x80);
+  return _mm_xor_si128(
+      _mm_max_epu8(_mm_xor_si128(a, bias), _mm_xor_si128(b, bias)), bias);
+}
+
+static inline __m128i tk_sse2_min_u16(__m128i a, __m128i b) {
+  __m128i bias = _mm_set1_epi16((short)0x8000);
+  return _mm_xor_si128(
+      _mm_min_epi16(_mm_xor_si128(a, bias), _mm_xor_si128(b, bias)), bias);
+}
+
+static inline __m128i tk_sse2_max_u16(__m128i a, __m128i b) {
+  __m128i bias = _mm_set1_epi16((short)0x8000);
+  return _mm_xor_si128(
+      _mm_max_epi16(_mm_xor_si128(a, bias), _mm_xor_si128(b, bias)), bias);
+}
+
+static inline __m128i tk_sse2_min_i32(__m128i a, __m128i b) {
+  return tk_sse2_select(_mm_cmpgt_epi32(a, b), a, b);
+}
+
+static inline __m128i tk_sse2_max_i32(__m128i a, __m128i b) {
+  return tk_sse2_select(_mm_cmpgt_epi32(b, a), a, b);
+}
+
+static inline __m128i tk_sse2_min_u32(__m128i a, __m128i b) {
+  __m128i bias = _mm_set1_epi32((int)0x80000000u);
+  __m128i gt =
+      _mm_cmpgt_epi32(_mm_xor_si128(a, bias), _mm_xor_si128(b, bias));
+  return tk_sse2_select(gt, a, b);
+}
+
+static inline __m128i tk_sse2_max_u32(__m128i a, __m128i b) {
+  __m128i bias = _mm_set1_epi32((int)0x80000000u);
+  __m128i lt =
+      _mm_cmpgt_epi32(_mm_xor_si128(b, bias), _mm_xor_si128(a, bias));
+  return tk_sse2_select(lt, a, b);
+}
+
+#define TK_SSE2_EQ(NAME, T, MATCH)                                             \
+  TK_SEARCH_DEFINE_EQ(, sse2, NAME, T, __m128i, 16, tk_sse2_splat, MATCH, 1)
+
+TK_SSE2_EQ(u8, uint8_t, tk_sse2_match8)
+TK_SSE2_EQ(u16, uint16_t, tk_sse2_match16)
+TK_SSE2_EQ(u32, uint32_t, tk_sse2_match32)
+TK_SSE2_EQ(u64, uint64_t, tk_sse2_match64)
+TK_SSE2_EQ(f32, float, tk_sse2_match_f32)
+TK_SSE2_EQ(f64, double, tk_sse2_match_f64)
+
+#define TK_SSE2_MIN_MAX(NAME, T, MIN, MAX)                                     \
+  TK_SEARCH_DEFINE_MIN_MAX(, sse2, NAME, T, __m128i, 16, tk_sse2_load,         \
+                           tk_sse2_store, MIN, MAX)
+
+TK_SSE2_MIN_MAX(i8, int8_t, tk_sse2_min_i8, tk_sse2_max_i8)
+TK_SSE2_MIN_MAX(u8, uint8_t, _mm_min_epu8, _mm_max_epu8)
+TK_SSE2_MIN_MAX(i16, int16_t, _mm_min_epi16, _mm_max_epi16)
+TK_SSE2_MIN_MAX(u16, uint16_t, tk_sse2_min_u16, tk_sse2_max_u16)
+TK_SSE2_MIN_MAX(i32, int32_t, tk_sse2_min_i32, tk_sse2_max_i32)
+TK_SSE2_MIN_MAX(u32, uint32_t, tk_sse2_min_u32, tk_sse2_max_u32)
+TK_SEARCH_DEFINE_MIN_MAX(, sse2, f32, float, __m128, 16, tk_sse2_load_ps,
+                         tk_sse2_store_ps, _mm_min_ps, _mm_max_ps)
+TK_SEARCH_DEFINE_MIN_MAX(, sse2, f64, double, __m128d, 16, tk_sse2_load_pd,
+                         tk_sse2_store_pd, _mm_min_pd, _mm_max_pd)
+
+// 64-bit integers have no SSE2 compare; their min_max stays portable.
+static const tk_search_ops_t g_search_sse2[] = {
+    {1, tk_search_find_u8_sse2, tk_search_count_u8_sse2,
+     tk_search_min_max_i8_sse2},
+    {1, tk_search_find_u8_sse2, tk_search_count_u8_sse2,
+     tk_search_min_max_u8_sse2},
+    {2, tk_search_find_u16_sse2, tk_search_count_u16_sse2,
+     tk_search_min_max_i16_sse2},
+    {2, tk_search_find_u16_sse2, tk_search_count_u16_sse2,
+     tk_search_min_max_u16_sse2},
+    {4, tk_search_find_u32_sse2, tk_search_count_u32_sse2,
+     tk_search_min_max_i32_sse2},
+    {4, tk_search_find_u32_sse2, tk_search_count_u32_sse2,
+     tk_search_min_max_u32_sse2},
+    {8, tk_search_find_u64_sse2, tk_search_count_u64_sse2,
+     tk_search_min_max_i64},
+    {8, tk_search_find_u64_sse2, tk_search_count_u64_sse2,
+     tk_search_min_max_u64},
+    {4, tk_search_find_f32_sse2, tk_search_count_f32_sse2,
+     tk_search_min_max_f32_sse2},
+    {8, tk_search_find_f64_sse2, tk_search_count_f64_sse2,
+     tk_search_min_max_f64_sse2}};
+
+#endif // TK_SEARCH_SSE2
+
+// --- AVX2 Kernels ---
+
+#if defined(TK_SEARCH_AVX2)
+
+#define TK_AVX2 __attribute__((target("avx2")))
+
+static inline TK_AVX2 __m256i tk_avx2_splat(const void *value, size_t size) {
+  unsigned char bytes[32];
+  for (size_t i = 0; i < 32; i += size)
+    memcpy(bytes + i, value, size);
+  return _mm256_loadu_si256((const __m256i *)bytes);
+}
+
+static inline TK_AVX2 __m256i tk_avx2_load(const void *p) {
+  return _mm256_loadu_si256((const __m256i *)p);
+}
+
+static inline TK_AVX2 void tk_avx2_store(void *p, __m256i v) {
+  _mm256_storeu_si256((__m256i *)p, v);
+}
+
+static inline TK_AVX2 __m256 tk_avx2_load_ps(const void *p) {
+  return _mm256_loadu_ps((const float *)p);
+}
+
+static inline TK_AVX2 void tk_avx2_store_ps(void *p, __m256 v) {
+  _mm256_storeu_ps((float *)p, v);
+}
+
+static inline TK_AVX2 __m256d tk_avx2_load_pd(const void *p) {
+  return _mm256_loadu_pd((const double *)p);
+}
+
+static inline TK_AVX2 void tk_avx2_store_pd(void *p, __m256d v) {
+  _mm256_storeu_pd((double *)p, v);
+}
+
+static inline TK_AVX2 uint64_t tk_avx2_mask(__m256i eq) {
+  return (uint32_t)_mm256_movemask_epi8(eq);
+}
+
+static inline TK_AVX2 uint64_t tk_avx2_match8(const char *p, __m256i v) {
+  return tk_avx2_mask(_mm256_cmpeq_epi8(tk_avx2_load(p), v));
+}
+
+static inline TK_AVX2 uint64_t tk_avx2_match16(const char *p, __m256i v) {
+  return tk_avx2_mask(_mm256_cmpeq_epi16(tk_avx2_load(p), v));
+}
+
+static inline TK_AVX2 uint64_t tk_avx2_match32(const char *p, __m256i v) {
+  return tk_avx2_mask(_mm256_cmpeq_epi32(tk_avx2_load(p), v));
+}
+
+static inline TK_AVX2 uint64_t tk_avx2_match64(const char *p, __m256i v) {
+  return tk_avx2_mask(_mm256_cmpeq_epi64(tk_avx2_load(p), v));
+}
+
+static inline TK_AVX2 uint64_t tk_avx2_match_f32(const char *p, __m256i v) {
+  return tk_avx2_mask(_mm256_castps_si256(
+      _mm256_cmp_ps(tk_avx2_load_ps(p), _mm256_castsi256_ps(v), _CMP_EQ_OQ)));
+}
+
+static inline TK_AVX2 uint64_t tk_avx2_match_f64(const char *p, __m256i v) {
+  return tk_avx2_mask(_mm256_castpd_si256(
+      _mm256_cmp_pd(tk_avx2_load_pd(p), _mm256_castsi256_pd(v), _CMP_EQ_OQ)));
+}
+
+static inline TK_AVX2 __m256i tk_avx2_min_i64(__m256i a, __m256i b) {
+  return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(a, b));
+}
+
+static inline TK_AVX2 __m256i tk_avx2_max_i64(__m256i a, __m256i b) {
+  return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(b, a));
+}
+
+static inline TK_AVX2 __m256i tk_avx2_min_u64(__m256i a, __m256i b) {
+  __m256i bias = _mm256_set1_epi64x((long long)0x8000000000000000ull);
+  __m256i gt = _mm256_cmpgt_epi64(_mm256_xor_si256(a, bias),
+                                  _mm256_xor_si256(b, bias));
+  return _mm256_blendv_epi8(a, b, gt);
+}
+
+static inline TK_AVX2 __m256i tk_avx2_max_u64(__m256i a, __m256i b) {
+  __m256i bias = _mm256_set1_epi64x((long long)0x8000000000000000ull);
+  __m256i lt = _mm256_cmpgt_epi64(_mm256_xor_si256(b, bias),
+                                  _mm256_xor_si256(a, bias));
+  return _mm256_blendv_epi8(a, b, lt);
+}
+
+#define TK_AVX2_EQ(NAME, T, MATCH)                                             \
+  TK_SEARCH_DEFINE_EQ(TK_AVX2, avx2, NAME, T, __m256i, 32, tk_avx2_splat,      \
+                      MATCH, 1)
+
+TK_AVX2_EQ(u8, uint8_t, tk_avx2_match8)
+TK_AVX2_EQ(u16, uint16_t, tk_avx2_match16)
+TK_AVX2_EQ(u32, uint32_t, tk_avx2_match32)
+TK_AVX2_EQ(u64, uint64_t, tk_avx2_match64)
+TK_AVX2_EQ(f32, float, tk_avx2_match_f32)
+TK_AVX2_EQ(f64, double, tk_avx2_match_f64)
+
+#define TK_AVX2_MIN_MAX(NAME, T, MIN, MAX)                                     \
+  TK_SEARCH_DEFINE_MIN_MAX(TK_AVX2, avx2, NAME, T, __m256i, 32, tk_avx2_load,  \
+                           tk_avx2_store, MIN, MAX)
+
+TK_AVX2_MIN_MAX(i8, int8_t, _mm256_min_epi8, _mm256_max_epi8)
+TK_AVX2_MIN_MAX(u8, uint8_t, _mm256_min_epu8, _mm256_max_epu8)
+TK_AVX2_MIN_MAX(i16, int16_t, _mm256_min_epi16, _mm256_max_epi16)
+TK_AVX2_MIN_MAX(u16, uint16_t, _mm256_min_epu16, _mm256_max_epu16)
+TK_AVX2_MIN_MAX(i32, int32_t, _mm256_min_epi32, _mm256_max_epi32)
+TK_AVX2_MIN_MAX(u32, uint32_t, _mm256_min_epu32, _mm256_max_epu32)
+TK_AVX2_MIN_MAX(i64, int64_t, tk_avx2_min_i64, tk_avx2_max_i64)
+TK_AVX2_MIN_MAX(u64, uint64_t, tk_avx2_min_u64, tk_avx2_max_u64)
+TK_SEARCH_DEFINE_MIN_MAX(TK_AVX2, avx2, f32, float, __m256, 32,
+                         tk_avx2_load_ps, tk_avx2_store_ps, _mm256_min_ps,
+                         _mm256_max_ps)
+TK_SEARCH_DEFINE_MIN_MAX(TK_AVX2, avx2, f64, double, __m256d, 32,
+                         tk_avx2_load_pd, tk_avx2_store_pd, _mm256_min_pd,
+                         _mm256_max_pd)
+
+static const tk_search_ops_t g_search_avx2[] = {
+    {1, tk_search_find_u8_avx2, tk_search_count_u8_avx2,
+     tk_search_min_max_i8_avx2},
+    {1, tk_search_find_u8_avx2, tk_search_count_u8_avx2,
+     tk_search_min_max_u8_avx2},
+    {2, tk_search_find_u16_avx2, tk_search_count_u16_avx2,
+     tk_search_min_max_i16_avx2},
+    {2, tk_search_find_u16_avx2, tk_search_count_u16_avx2,
+     tk_search_min_max_u16_avx2},
+    {4, tk_search_find_u32_avx2, tk_search_count_u32_avx2,
+     tk_search_min_max_i32_avx2},
+    {4, tk_search_find_u32_avx2, tk_search_count_u32_avx2,
+     tk_search_min_max_u32_avx2},
+    {8, tk_search_find_u64_avx2, tk_search_count_u64_avx2,
+     tk_search_min_max_i64_avx2},
+    {8, tk_search_find_u64_avx2, tk_search_count_u64_avx2,
+     tk_search_min_max_u64_avx2},
+    {4, tk_search_find_f32_avx2, tk_search_count_f32_avx2,
+     tk_search_min_max_f32_avx2},
+    {8, tk_search_find_f64_avx2, tk_search_count_f64_avx2,
+     tk_search_min_max_f64_avx2}};
+
+#endif // TK_SEARCH_AVX2
+
+// --- NEON Kernels ---
+
+#if defined(TK_SEARCH_NEON)
+
+static inline uint8x16_t tk_neon_splat(const void *value, size_t size) {
+  unsigned char bytes[16];
+  for (size_t i = 0; i < 16; i += size)
+    memcpy(bytes + i, value, size);
+  return vld1q_u8(bytes);
+}
+
+static inline uint64_t tk_neon_mask(uint8x16_t eq) {
+  // Narrow each 0x00/0xFF byte to a nibble: four mask bits per byte.
+  uint8x8_t nibbles = vshrn_n_u16(vreinterpretq_u16_u8(eq), 4);
+  return vget_lane_u64(vreinterpret_u64_u8(nibbles), 0);
+}
+
+static inline uint64_t tk_neon_match8(const char *p, uint8x16_t v) {
+  return tk_neon_mask(vceqq_u8(vld1q_u8((const uint8_t *)p), v));
+}
+
+static inline uint64_t tk_neon_match16(const char *p, uint8x16_t v) {
+  return tk_neon_mask(vreinterpretq_u8_u16(
+      vceqq_u16(vld1q_u16((const uint16_t *)p), vreinterpretq_u16_u8(v))));
+}
+
+static inline uint64_t tk_neon_match32(const char *p, uint8x16_t v) {
+  return tk_neon_mask(vreinterpretq_u8_u32(
+      vceqq_u32(vld1q_u32((const uint32_t *)p), vreinterpretq_u32_u8(v))));
+}
+
+static inline uint64_t tk_neon_match_f32(const char *p, uint8x16_t v) {
+  return tk_neon_mask(vreinterpretq_u8_u32(
+      vceqq_f32(vld1q_f32((const float *)p), vreinterpretq_f32_u8(v))));
+}
+
+#define TK_NEON_EQ(NAME, T, MATCH)                                             \
+  TK_SEARCH_DEFINE_EQ(, neon, NAME, T, uint8x16_t, 16, tk_neon_splat, MATCH, 4)
+
+TK_NEON_EQ(u8, uint8_t, tk_neon_match8)
+TK_NEON_EQ(u16, uint16_t, tk_neon_match16)
+TK_NEON_EQ(u32, uint32_t, tk_neon_match32)
+TK_NEON_EQ(f32, float, tk_neon_match_f32)
+
+/**
+ * @brief Defines the load/store wrappers and the min_max kernel of one NEON
+ * vector type, whose intrinsics carry the type suffix SFX.
+ */
+#define TK_NEON_MIN_MAX(NAME, T, VEC, SFX)                                     \
+  static inline VEC tk_neon_load_##NAME(const void *p) {                       \
+    return vld1q_##SFX((const T *)p);                                          \
+  }                                                                            \
+  static inline void tk_neon_store_##NAME(void *p, VEC v) {                    \
+    vst1q_##SFX((T *)p, v);                                                    \
+  }                                                                            \
+  TK_SEARCH_DEFINE_MIN_MAX(, neon, NAME, T, VEC, 16, tk_neon_load_##NAME,      \
+                           tk_neon_store_##NAME, vminq_##SFX, vmaxq_##SFX)
+
+TK_NEON_MIN_MAX(i8, int8_t, int8x16_t, s8)
+TK_NEON_MIN_MAX(u8, uint8_t, uint8x16_t, u8)
+TK_NEON_MIN_MAX(i16, int16_t, int16x8_t, s16)
+TK_NEON_MIN_MAX(u16, uint16_t, uint16x8_t, u16)
+TK_NEON_MIN_MAX(i32, int32_t, int32x4_t, s32)
+TK_NEON_MIN_MAX(u32, uint32_t, uint32x4_t, u32)
+TK_NEON_MIN_MAX(f32, float, float32x4_t, f32)
+
+// 64-bit lanes are left to the portable kernels, which also keeps this
+// table valid on 32-bit ARM.
+static const tk_search_ops_t g_search_neon[] = {
+    {1, tk_search_find_u8_neon, tk_search_count_u8_neon,
+     tk_search_min_max_i8_neon},
+    {1, tk_search_find_u8_neon, tk_search_count_u8_neon,
+     tk_search_min_max_u8_neon},
+    {2, tk_search_find_u16_neon, tk_search_count_u16_neon,
+     tk_search_min_max_i16_neon},
+    {2, tk_search_find_u16_neon, tk_search_count_u16_neon,
+     tk_search_min_max_u16_neon},
+    {4, tk_search_find_u32_neon, tk_search_count_u32_neon,
+     tk_search_min_max_i32_neon},
+    {4, tk_search_find_u32_neon, tk_search_count_u32_neon,
+     tk_search_min_max_u32_neon},
+    {8, tk_search_find_u64, tk_search_count_u64, tk_search_min_max_i64},
+    {8, tk_search_find_u64, tk_search_count_u64, tk_search_min_max_u64},
+    {4, tk_search_find_f32_neon, tk_search_count_f32_neon,
+     tk_search_min_max_f32_neon},
+    {8, tk_search_find_f64, tk_search_count_f64, tk_search_min_max_f64}};
+
+#endif // TK_SEARCH_NEON
+
+// --- Dispatch ---
+
+/**
+ * @brief Returns the kernels of 'type' for the best ISA of this CPU.
+ */
+static const tk_search_ops_t *tk_search_ops(tk_scalar_t type) {
+#if defined(TK_SEARCH_AVX2)
+  if (__builtin_cpu_supports("avx2"))
+    return &g_search_avx2[type];
+#endif
+#if defined(TK_SEARCH_SSE2)
+  return &g_search_sse2[type];
+#elif defined(TK_SEARCH_NEON)
+  return &g_search_neon[type];
+#else
+  return &g_search_portable[type];
+#endif
+}
+
+/**
+ * @brief Extracts [begin, end) as a dense array of 'size'-byte elements.
+ * @return `true` if the range is contiguous with a stride of 'size'.
+ */
+static tk_bool tk_search_dense(const tk_iterator_t *begin,
+                               const tk_iterator_t *end, size_t size,
+                               const char **data, size_t *count) {
+  size_t stride;
+  const char *first = (const char *)tk_iter_contiguous(begin, &stride);
+  if (!first || stride != size)
+    return false;
+  const char *last = (const char *)tk_iter_contiguous(end, &stride);
+  *data = first;
+  *count = (size_t)(last - first) / size;
+  return true;
+}
+
+/**
+ * @brief Staging buffer for non-dense ranges: one block of elements, plus
+ * two slots for the running min and max.
+ */
+typedef union {
+  uint64_t align;
+  double align_f64;
+  char bytes[(TK_SEARCH_BLOCK + 2) * sizeof(uint64_t)];
+} tk_search_stage_t;
+
+/**
+ * @brief Copies up to TK_SEARCH_BLOCK elements of [*it, end) to 'out' and
+ * advances '*it' past them.
+ * @return The number of elements copied.
+ */
+static size_t tk_search_stage(tk_iterator_t *it, const tk_iterator_t *end,
+                              size_t size, char *out) {
+  void *ptrs[TK_SEARCH_BLOCK];
+  size_t n = tk_iter_next_block(it, end, ptrs, TK_SEARCH_BLOCK);
+  for (size_t i = 0; i < n; ++i)
+    memcpy(out + i * size, ptrs[i], size);
+  return n;
+}
+
+static void tk_search_check(const tk_iterator_t *begin,
+                            const tk_iterator_t *end, tk_scalar_t type) {
+  (void)begin;
+  (void)end;
+  (void)type;
+  TK_ASSERT(begin->vtable != NULL && begin->vtable == end->vtable &&
+            "tk_algo_search: 'begin' and 'end' must be of the same type.");
+  TK_ASSERT((unsigned)type <= TK_SCALAR_F64 &&
+            "tk_algo_search: unknown scalar type.");
+}
+
+// --- Public Functions ---
+
+tk_iterator_t tk_algo_find_value(tk_iterator_t begin, tk_iterator_t end,
+                                 tk_scalar_t type, const void *value) {
+  tk_search_check(&begin, &end, type);
+  TK_ASSERT(value != NULL);
+  if ((unsigned)type > TK_SCALAR_F64 || !value)
+    return end;
+  const tk_search_ops_t *ops = tk_search_ops(type);
+
+  const char *data;
+  size_t count;
+  if (tk_search_dense(&begin, &end, ops->size, &data, &count)) {
+    size_t index = ops->find(data, count, value);
+    if (index == count)
+      return end;
+    tk_iter_advance_n(&begin, (ptrdiff_t)index);
+    return begin;
+  }
+
+  tk_search_stage_t stage;
+  for (;;) {
+    tk_iterator_t block_start;
+    tk_iter_clone(&block_start, &begin);
+    size_t n = tk_search_stage(&begin, &end, ops->size, stage.bytes);
+    if (n == 0)
+      return end;
+    size_t index = ops->find(stage.bytes, n, value);
+    if (index < n) {
+      tk_iter_advance_n(&block_start, (ptrdiff_t)index);
+      return block_start;
+    }
+  }
+}
+
+size_t tk_algo_count_value(tk_iterator_t begin, tk_iterator_t end,
+                           tk_scalar_t type, const void *value) {
+  tk_search_check(&begin, &end, type);
+  TK_ASSERT(value != NULL);
+  if ((unsigned)type > TK_SCALAR_F64 || !value)
+    return 0;
+  const tk_search_ops_t *ops = tk_search_ops(type);
+
+  const char *data;
+  size_t count;
+  if (tk_search_dense(&begin, &end, ops->size, &data, &count))
+    return ops->count(data, count, value);
+
+  tk_search_stage_t stage;
+  size_t total = 0, n;
+  while ((n = tk_search_stage(&begin, &end, ops->size, stage.bytes)) > 0)
+    total += ops->count(stage.bytes, n, value);
+  return total;
+}
+
+tk_error_t tk_algo_min_max(tk_iterator_t begin, tk_iterator_t end,
+                           tk_scalar_t type, void *min, void *max) {
+  tk_search_check(&begin, &end, type);
+  if ((unsigned)type > TK_SCALAR_F64)
+    return TK_E_INVALID_ARG;
+  const tk_search_ops_t *ops = tk_search_ops(type);
+  size_t size = ops->size;
+  uint64_t lo, hi; // Big enough for any scalar
+
+  const char *data;
+  size_t count;
+  if (tk_search_dense(&begin, &end, size, &data, &count)) {
+    if (count == 0)
+      return TK_E_EMPTY;
+    ops->min_max(data, count, &lo, &hi);
+  } else {
+    // Every block after the first is reduced together with the running
+    // result, carried in the two slots in front of it.
+    tk_search_stage_t stage;
+    size_t n = tk_search_stage(&begin, &end, size, stage.bytes);
+    if (n == 0)
+      return TK_E_EMPTY;
+    ops->min_max(stage.bytes, n, &lo, &hi);
+    while ((n = tk_search_stage(&begin, &end, size,
+                                stage.bytes + 2 * size)) > 0) {
+      memcpy(stage.bytes, &lo, size);
+      memcpy(stage.bytes + size, &hi, size);
+      ops->min_max(stage.bytes, n + 2, &lo, &hi);
+    }
+  }
+
+  if (min)
+    memcpy(min, &lo, size);
+  if (max)
+    memcpy(max, &hi, size);
+  return TK_SUCCESS;
+}
@@ -0,0 +1,549 @@
+/**
+ * @file sort.c
+ * @brief Implements the sorting algorithms.
+ *
+ * @details
+ * The comparison sorts are written once, as the TK_SORT_DEFINE template, and
+ * instantiated for 4-, 8- and 16-byte elements plus a generic element size.
+ * In the sized instances the element size is a compile-time constant, so
+ * `tk_sort_swap` and every `memcpy` of an element collapse into a couple of
+ * register moves instead of a byte loop. Each instance is exposed through a
+ * `tk_sort_ops_t` table, selected once per call from the iterator stride.
+ *
+ * The parallel stable sort cuts the range into one chunk per thread, sorts
+ * the chunks concurrently, then merges adjacent runs in rounds. Every merge
+ * of a round is further split into equal output slices with a merge-path
+ * search, so the last rounds (few, long runs) still use every thread.
+ */
+
+#include <string.h>
+#include <tk/algo/sort.h>
+#include <tk/algo/parallel.h>
+#include <tk/core/allocator.h>
+#include <tk/core/macros.h>
+#include <tk/core/pool.h>
+
+/**
+ * @brief Partitions at most this long are finished with insertion sort.
+ */
+#define TK_SORT_INSERTION_THRESHOLD 16
+
+/**
+ * @brief Length of the insertion-sorted runs the merge sort starts from.
+ */
+#define TK_SORT_RUN 32
+
+/**
+ * @brief Minimum number of elements per chunk of the parallel sort.
+ */
+#define TK_SORT_PAR_MIN_CHUNK 8192
+
+/**
+ * @brief Upper bound on the number of chunks of the parallel sort.
+ */
+#define TK_SORT_PAR_MAX_CHUNKS 256
+
+/**
+ * @brief Swaps two elements. With a constant 'size' the switch folds away.
+ */
+static inline void tk_sort_swap(char *a, char *b, size_t size) {
+  switch (size) {
+  case 4: {
+    uint32_t t;
+    memcpy(&t, a, 4);
+    memcpy(a, b, 4);
+    memcpy(b, &t, 4);
+    return;
+  }
+  case 8: {
+    uint64_t t;
+    memcpy(&t, a, 8);
+    memcpy(a, b, 8);
+    memcpy(b, &t, 8);
+    return;
+  }
+  case 16: {
+    uint64_t t[2];
+    memcpy(t, a, 16);
+    memcpy(a, b, 16);
+    memcpy(b, t, 16);
+    return;
+  }
+  default: {
+    char t[64];
+    while (size > 0) {
+      size_t n = size < sizeof(t) ? size : sizeof(t);
+      memcpy(t, a, n);
+      memcpy(a, b, n);
+      memcpy(b, t, n);
+      a += n;
+      b += n;
+      size -= n;
+    }
+  }
+  }
+}
+
+/**
+ * @brief The sorting kernels of one element size.
+ */
+typedef struct {
+  // Introsort of 'n' elements in place.
+  void (*sort)(char *base, size_t n, size_t size, tk_compare_fn_t cmp);
+  // Stable merge sort of 'n' elements in place, 'buf' holding 'n' elements.
+  void (*stable)(char *base, char *buf, size_t n, size_t size,
+                 tk_compare_fn_t cmp);
+  // Stable merge of two sorted runs into 'out' (which overlaps neither).
+  void (*merge)(const char *a, size_t na, const char *b, size_t nb, char *out,
+                size_t size, tk_compare_fn_t cmp);
+} tk_sort_ops_t;
+
+/**
+ * @brief Instantiates the comparison sorts for elements of 'SIZE' bytes.
+ *
+ * 'SIZE' is either a constant or the 'size' parameter itself (for the
+ * generic instance). Defines NAME##_ops.
+ */
+#define TK_SORT_DEFINE(NAME, SIZE)                                             \
+  static void NAME##_insertion(char *base, size_t n, size_t size,              \
+                               tk_compare_fn_t cmp) {                          \
+    (void)size;                                                                \
+    for (size_t i = 1; i < n; ++i) {                                           \
+      for (char *p = base + i * (SIZE); p > base && cmp(p - (SIZE), p) > 0;    \
+           p -= (SIZE))                                                        \
+        tk_sort_swap(p - (SIZE), p, (SIZE));                                   \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  static void NAME##_sift_down(char *base, size_t root, size_t n,              \
+                               size_t size, tk_compare_fn_t cmp) {             \
+    (void)size;                                                                \
+    for (;;) {                                                                 \
+      size_t child = 2 * root + 1;                                             \
+      if (child >= n)                                                          \
+        return;                                                                \
+      if (child + 1 < n &&                                                     \
+          cmp(base + child * (SIZE), base + (child + 1) * (SIZE)) < 0)         \
+        ++child;                                                               \
+      if (cmp(base + root * (SIZE), base + child * (SIZE)) >= 0)               \
+        return;                                                                \
+      tk_sort_swap(base + root * (SIZE), base + child * (SIZE), (SIZE));       \
+      root = child;                                                            \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  static void NAME##_heapsort(char *base, size_t n, size_t size,               \
+                              tk_compare_fn_t cmp) {                           \
+    for (size_t i = n / 2; i-- > 0;)                                           \
+      NAME##_sift_down(base, i, n, size, cmp);                                 \
+    for (size_t last = n - 1; last > 0; --last) {                              \
+      tk_sort_swap(base, base + last * (SIZE), (SIZE));                        \
+      NAME##_sift_down(base, 0, last, size, cmp);                              \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  static void NAME##_introsort(char *base, size_t n, size_t size,              \
+                               tk_compare_fn_t cmp, unsigned depth) {          \
+    while (n > TK_SORT_INSERTION_THRESHOLD) {                                  \
+      if (depth == 0) {                                                        \
+        NAME##_heapsort(base, n, size, cmp);                                   \
+        return;                                                                \
+      }                                                                        \
+      --depth;                                                                 \
+                                                                               \
+      /* Median of three, then park the pivot at the front. */                 \
+      char *mid = base + (n / 2) * (SIZE);                                     \
+      char *last = base + (n - 1) * (SIZE);                                    \
+      if (cmp(mid, base) < 0)                                                  \
+        tk_sort_swap(mid, base, (SIZE));                                       \
+      if (cmp(last, mid) < 0) {                                                \
+        tk_sort_swap(last, mid, (SIZE));                                       \
+        if (cmp(mid, base) < 0)                                                \
+          tk_sort_swap(mid, base, (SIZE));                                     \
+      }                                                                        \
+      tk_sort_swap(base, mid, (SIZE));                                         \
+                                                                               \
+      /* Hoare partition; both scans stop on keys equal to the pivot, */       \
+      /* which keeps runs of duplicates balanced. */                           \
+      size_t i = 0, j = n;                                                     \
+      for (;;) {                                                               \
+        do                                                                     \
+          ++i;                                                                 \
+        while (i < n && cmp(base + i * (SIZE), base) < 0);                     \
+        do                                                                     \
+          --j;                                                                 \
+        while (cmp(base + j * (SIZE), base) > 0);                              \
+        if (i >= j)                                                            \
+          break;                                                               \
+        tk_sort_swap(base + i * (SIZE), base + j * (SIZE), (SIZE));            \
+      }                                                                        \
+      tk_sort_swap(base, base + j * (SIZE), (SIZE));                           \
+                                                                               \
+      /* Recurse into the smaller side, loop on the larger one. */             \
+      size_t left = j, right = n - j - 1;                                      \
+      if (left < right) {                                                      \
+        NAME##_introsort(base, left, size, cmp, depth);                        \
+        base += (j + 1) * (SIZE);                                              \
+        n = right;                                                             \
+      } else {                                                                 \
+        NAME##_introsort(base + (j + 1) * (SIZE), right, size, cmp, depth);    \
+        n = left;                                                              \
+      }                                                                        \
+    }                                                                          \
+    NAME##_insertion(base, n, size, cmp);                                      \
+  }                                                                            \
+                                                                               \
+  static void NAME##_sort(char *base, size_t n, size_t size,                   \
+                          tk_compare_fn_t cmp) {                               \
+    unsigned depth = 0;                                                        \
+    for (size_t m = n; m > 1; m >>= 1)                                         \
+      depth += 2;                                                              \
+    NAME##_introsort(base, n, size, cmp, depth);                               \
+  }                                                                            \
+                                                                               \
+  static void NAME##_merge(const char *a, size_t na, const char *b,            \
+                           size_t nb, char *out, size_t size,                  \
+                           tk_compare_fn_t cmp) {                              \
+    (void)size;                                                                \
+    while (na > 0 && nb > 0) {                                                 \
+      /* Ties go to 'a', which keeps the merge stable. */                      \
+      if (cmp(b, a) < 0) {                                                     \
+        memcpy(out, b, (SIZE));                                                \
+        b += (SIZE);                                                           \
+        --nb;                                                                  \
+      } else {                                                                 \
+        memcpy(out, a, (SIZE));                                                \
+        a += (SIZE);                                                           \
+        --na;                                                                  \
+      }                                                                        \
+      out += (SIZE);                                                           \
+    }                                                                          \
+    if (na > 0)                                                                \
+      memcpy(out, a, na * (SIZE));                                             \
+    if (nb > 0)                                                                \
+      memcpy(out, b, nb * (SIZE));                                             \
+  }                                                                            \
+                                                                               \
+  static void NAME##_stable(char *base, char *buf, size_t n, size_t size,      \
+                            tk_compare_fn_t cmp) {                             \
+    for (size_t i = 0; i < n; i += TK_SORT_RUN)                                \
+      NAME##_insertion(base + i * (SIZE),                                      \
+                       n - i < TK_SORT_RUN ? n - i : TK_SORT_RUN, size, cmp);  \
+                                                                               \
+    char *src = base, *dst = buf;                                              \
+    for (size_t width = TK_SORT_RUN; width < n; width *= 2) {                  \
+      for (size_t i = 0; i < n; i += 2 * width) {                              \
+        size_t mid = n - i < width ? n : i + width;                            \
+        size_t hi = n - mid < width ? n : mid + width;                         \
+        NAME##_merge(src + i * (SIZE), mid - i, src + mid * (SIZE), hi - mid,  \
+                     dst + i * (SIZE), size, cmp);                             \
+      }                                                                        \
+      char *t = src;                                                           \
+      src = dst;                                                               \
+      dst = t;                                                                 \
+    }                                                                          \
+    if (src != base)                                                           \
+      memcpy(base, src, n * (SIZE));                                           \
+  }                                                                            \
+                                                                               \
+  static const tk_sort_ops_t NAME##_ops = {NAME##_sort, NAME##_stable,         \
+                                           NAME##_merge};
+
+TK_SORT_DEFINE(tk_sort4, 4)
+TK_SORT_DEFINE(tk_sort8, 8)
+TK_SORT_DEFINE(tk_sort16, 16)
+TK_SORT_DEFINE(tk_sortn, size)
+
+/**
+ * @brief Picks the kernels for an element size.
+ */
+static const tk_sort_ops_t *tk_sort_select(size_t size) {
+  switch (size) {
+  case 4:
+    return &tk_sort4_ops;
+  case 8:
+    return &tk_sort8_ops;
+  case 16:
+    return &tk_sort16_ops;
+  default:
+    return &tk_sortn_ops;
+  }
+}
+
+/**
+ * @brief Extracts the contiguous span [begin, end).
+ * @return `true` if both iterators expose contiguous storage.
+ */
+static tk_bool tk_sort_span(const tk_iterator_t *begin,
+                            const tk_iterator_t *end, char **data,
+                            size_t *stride, size_t *count) {
+  TK_ASSERT(begin->vtable != NULL && begin->vtable == end->vtable &&
+            "tk_algo_sort: 'begin' and 'end' must be of the same type.");
+  if (begin->vtable->category != TK_ITER_RANDOM_ACCESS)
+    return false;
+
+  char *first = (char *)tk_iter_contiguous(begin, stride);
+  char *last = (char *)tk_iter_contiguous(end, stride);
+  if (!first || !last || *stride == 0)
+    return false;
+  *data = first;
+  *count = (size_t)(last - first) / *stride;
+  return true;
+}
+
+// --- Parallel Merge Sort ---
+
+/**
+ * @brief Shared state of one parallel sort phase.
+ */
+typedef struct {
+  const tk_sort_ops_t *ops;
+  tk_compare_fn_t cmp;
+  size_t size;
+  char *src;            // Runs to merge (or chunks to sort)
+  char *dst;            // Merge output (or chunk scratch space)
+  const size_t *bounds; // Run i is [bounds[i], bounds[i + 1])
+  size_t runs;          // Number of runs
+  size_t slices;        // Output slices per merged pair
+} tk_sort_par_t;
+
+static void tk_sort_par_chunks(size_t first, size_t last, void *ctx) {
+  const tk_sort_par_t *par = (const tk_sort_par_t *)ctx;
+  for (size_t c = first; c < last; ++c) {
+    size_t lo = par->bounds[c], n = par->bounds[c + 1] - lo;
+    par->ops->stable(par->src + lo * par->size, par->dst + lo * par->size, n,
+                     par->size, par->cmp);
+  }
+}
+
+/**
+ * @brief Returns how many elements of 'a' are among the first 'k' outputs
+ * of the stable merge of 'a' and 'b' (the merge-path co-rank).
+ */
+static size_t tk_sort_co_rank(const tk_sort_par_t *par, const char *a,
+                              size_t na, const char *b, size_t nb, size_t k) {
+  size_t lo = k > nb ? k - nb : 0;
+  size_t hi = k < na ? k : na;
+  while (lo < hi) {
+    size_t i = lo + (hi - lo) / 2;
+    // a[i] precedes b[k - i - 1] (ties go to 'a'): more of 'a' is needed.
+    if (par->cmp(a + i * par->size, b + (k - i - 1) * par->size) <= 0)
+      lo = i + 1;
+    else
+      hi = i;
+  }
+  return lo;
+}
+
+static void tk_sort_par_merge(size_t first, size_t last, void *ctx) {
+  const tk_sort_par_t *par = (const tk_sort_par_t *)ctx;
+  size_t size = par->size;
+  for (size_t t = first; t < last; ++t) {
+    size_t pair = t / par->slices, slice = t % par->slices;
+    size_t lo = par->bounds[2 * pair];
+    size_t mid = par->bounds[2 * pair + 1];
+    size_t hi = 2 * pair + 2 <= par->runs ? par->bounds[2 * pair + 2] : mid;
+    const char *a = par->src + lo * size, *b = par->src + mid * size;
+    size_t na = mid - lo, nb = hi - mid;
+
+    size_t k0 = (na + nb) * slice / par->slices;
+    size_t k1 = (na + nb) * (slice + 1) / par->slices;
+    size_t i0 = tk_sort_co_rank(par, a, na, b, nb, k0);
+    size_t i1 = tk_sort_co_rank(par, a, na, b, nb, k1);
+    par->ops->merge(a + i0 * size, i1 - i0, b + (k0 - i0) * size,
+                    (k1 - i1) - (k0 - i0), par->dst + (lo + k0) * size, size,
+                    par->cmp);
+  }
+}
+
+// --- Public Functions ---
+
+tk_error_t tk_algo_sort(tk_iterator_t begin, tk_iterator_t end,
+                        tk_compare_fn_t cmp) {
+  TK_ASSERT(cmp != NULL);
+  if (tk_iter_equal(&begin, &end))
+    return TK_SUCCESS;
+
+  char *data;
+  size_t size, count;
+  if (!tk_sort_span(&begin, &end, &data, &size, &count))
+    return TK_E_INVALID_ARG;
+  tk_sort_select(size)->sort(data, count, size, cmp);
+  return TK_SUCCESS;
+}
+
+tk_error_t tk_algo_stable_sort(tk_iterator_t begin, tk_iterator_t end,
+                               tk_compare_fn_t cmp) {
+  TK_ASSERT(cmp != NULL);
+  if (tk_iter_equal(&begin, &end))
+    return TK_SUCCESS;
+
+  char *data;
+  size_t size, count;
+  if (!tk_sort_span(&begin, &end, &data, &size, &count))
+    return TK_E_INVALID_ARG;
+
+  const tk_sort_ops_t *ops = tk_sort_select(size);
+  if (count <= TK_SORT_RUN) {
+    ops->stable(data, NULL, count, size, cmp); // No merge pass needed
+    return TK_SUCCESS;
+  }
+
+  const tk_allocator_t *allocator = tk_allocator_default();
+  char *buf = (char *)tk_allocator_alloc(allocator, count * size);
+  if (!buf)
+    return TK_E_NOMEM;
+  ops->stable(data, buf, count, size, cmp);
+  tk_allocator_free(allocator, buf, count * size);
+  return TK_SUCCESS;
+}
+
+tk_error_t tk_algo_radix_sort(tk_iterator_t begin, tk_iterator_t end,
+                              size_t key_offset, tk_radix_key_t key_type) {
+  if (tk_iter_equal(&begin, &end))
+    return TK_SUCCESS;
+
+  char *data;
+  size_t size, count;
+  if (!tk_sort_span(&begin, &end, &data, &size, &count))
+    return TK_E_INVALID_ARG;
+
+  size_t key_size =
+      key_type == TK_RADIX_U32 || key_type == TK_RADIX_I32 ? 4 : 8;
+  if (key_offset > size || size - key_offset < key_size)
+    return TK_E_INVALID_ARG;
+  // Flipping the sign bit maps two's-complement order onto unsigned order.
+  uint64_t flip = key_type == TK_RADIX_I32   ? (uint64_t)1 << 31
+                  : key_type == TK_RADIX_I64 ? (uint64_t)1 << 63
+                                             : 0;
+  if (count < 2)
+    return TK_SUCCESS;
+
+  const tk_allocator_t *allocator = tk_allocator_default();
+  char *buf = (char *)tk_allocator_alloc(allocator, count * size);
+  if (!buf)
+    return TK_E_NOMEM;
+
+  // One read pass builds the histograms of every key byte.
+  size_t counts[8][256];
+  memset(counts, 0, sizeof(counts));
+  for (size_t i = 0; i < count; ++i) {
+    uint64_t key = 0;
+    if (key_size == 4) {
+      uint32_t k32;
+      memcpy(&k32, data + i * size + key_offset, 4);
+      key = k32;
+    } else {
+      memcpy(&key, data + i * size + key_offset, 8);
+    }
+    key ^= flip;
+    for (size_t d = 0; d < key_size; ++d)
+      ++counts[d][(key >> (8 * d)) & 0xFF];
+  }
+
+  char *src = data, *dst = buf;
+  for (size_t d = 0; d < key_size; ++d) {
+    size_t *hist = counts[d];
+    // A byte shared by every key does not reorder anything.
+    tk_bool trivial = false;
+    for (size_t v = 0; v < 256; ++v) {
+      if (hist[v] == count)
+        trivial = true;
+      if (hist[v] != 0)
+        break;
+    }
+    if (trivial)
+      continue;
+
+    size_t offset = 0;
+    for (size_t v = 0; v < 256; ++v) {
+      size_t n = hist[v];
+      hist[v] = offset;
+      offset += n;
+    }
+    for (size_t i = 0; i < count; ++i) {
+      const char *element = src + i * size;
+      uint64_t key = 0;
+      if (key_size == 4) {
+        uint32_t k32;
+        memcpy(&k32, element + key_offset, 4);
+        key = k32;
+      } else {
+        memcpy(&key, element + key_offset, 8);
+      }
+      key ^= flip;
+      memcpy(dst + hist[(key >> (8 * d)) & 0xFF]++ * size, element, size);
+    }
+    char *t = src;
+    src = dst;
+    dst = t;
+  }
+
+  if (src != data)
+    memcpy(data, src, count * size);
+  tk_allocator_free(allocator, buf, count * size);
+  return TK_SUCCESS;
+}
+
+tk_error_t tk_algo_par_stable_sort(tk_iterator_t begin, tk_iterator_t end,
+                                   tk_compare_fn_t cmp, size_t num_threads) {
+  TK_ASSERT(cmp != NULL);
+  if (tk_iter_equal(&begin, &end))
+    return TK_SUCCESS;
+
+  char *data;
+  size_t size, count;
+  if (!tk_sort_span(&begin, &end, &data, &size, &count))
+    return TK_E_INVALID_ARG;
+
+  if (num_threads == 0)
+    num_threads = tk_algo_par_hardware_threads();
+  size_t chunks = count / TK_SORT_PAR_MIN_CHUNK;
+  if (chunks > num_threads)
+    chunks = num_threads;
+  if (chunks > TK_SORT_PAR_MAX_CHUNKS)
+    chunks = TK_SORT_PAR_MAX_CHUNKS;
+  tk_pool_t *pool = chunks > 1 ? tk_pool_default() : NULL;
+  if (!pool)
+    return tk_algo_stable_sort(begin, end, cmp);
+
+  const tk_allocator_t *allocator = tk_allocator_default();
+  char *buf = (char *)tk_allocator_alloc(allocator, count * size);
+  if (!buf)
+    return TK_E_NOMEM;
+
+  size_t bounds[TK_SORT_PAR_MAX_CHUNKS + 1];
+  for (size_t c = 0; c <= chunks; ++c)
+    bounds[c] = count * c / chunks;
+
+  tk_sort_par_t par = {.ops = tk_sort_select(size),
+                       .cmp = cmp,
+                       .size = size,
+                       .src = data,
+                       .dst = buf,
+                       .bounds = bounds,
+                       .runs = chunks};
+  tk_pool_parallel_for(pool, 0, chunks, 1, tk_sort_par_chunks, &par);
+
+  // Merge adjacent runs until one is left; an odd last run is merged with
+  // an empty one, which copies it across.
+  while (par.runs > 1) {
+    size_t pairs = (par.runs + 1) / 2;
+    par.slices = (num_threads + pairs - 1) / pairs;
+    tk_pool_parallel_for(pool, 0, pairs * par.slices, 1, tk_sort_par_merge,
+                         &par);
+
+    for (size_t p = 0; p < pairs; ++p)
+      bounds[p] = bounds[2 * p];
+    bounds[pairs] = count;
+    par.runs = pairs;
+    char *t = par.src;
+    par.src = par.dst;
+    par.dst = t;
+  }
+
+  if (par.src != data)
+    memcpy(data, par.src, count * size);
+  tk_allocator_free(allocator, buf, count * size);
+  return TK_SUCCESS;
+}
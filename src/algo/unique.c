@@ -0,0 +1,128 @@
+/**
+ * @file unique.c
+ * @brief Implements the duplicate removal algorithms.
+ *
+ * @details
+ * Both passes keep a write cursor 'out' that trails the read cursor. A kept
+ * element is copied down to 'out' (skipped while nothing has been dropped
+ * yet, when the two coincide), so every element is read once and written
+ * at most once, and only slots already read are ever overwritten.
+ */
+
+#include <string.h>
+#include <tk/algo/unique.h>
+#include <tk/core/macros.h>
+#include <tk/core/allocator.h>
+
+/**
+ * @brief Marks a free slot of tk_algo_dedup_hashed's index table.
+ */
+#define TK_UNIQUE_EMPTY SIZE_MAX
+
+/**
+ * @brief Extracts the contiguous span [begin, end).
+ * @return `true` if both iterators expose contiguous storage.
+ */
+static tk_bool tk_unique_span(const tk_iterator_t *begin,
+                              const tk_iterator_t *end, char **data,
+                              size_t *stride, size_t *count) {
+  TK_ASSERT(begin->vtable != NULL && begin->vtable == end->vtable &&
+            "tk_algo_unique: 'begin' and 'end' must be of the same type.");
+  if (begin->vtable->category != TK_ITER_RANDOM_ACCESS)
+    return false;
+
+  char *first = (char *)tk_iter_contiguous(begin, stride);
+  char *last = (char *)tk_iter_contiguous(end, stride);
+  if (!first || !last || *stride == 0)
+    return false;
+  *data = first;
+  *count = (size_t)(last - first) / *stride;
+  return true;
+}
+
+tk_error_t tk_algo_unique(tk_iterator_t begin, tk_iterator_t end,
+                          tk_compare_fn_t cmp, size_t *kept) {
+  TK_ASSERT(kept != NULL);
+  *kept = 0;
+  if (tk_iter_equal(&begin, &end))
+    return TK_SUCCESS;
+  char *data;
+  size_t stride, count;
+  if (!tk_unique_span(&begin, &end, &data, &stride, &count))
+    return TK_E_INVALID_ARG;
+
+  // 'out' is the last kept element; each element is compared against it.
+  char *out = data;
+  const char *last = data + count * stride;
+  for (const char *p = data + stride; p != last; p += stride) {
+    tk_bool same = cmp ? cmp(out, p) == 0 : memcmp(out, p, stride) == 0;
+    if (same)
+      continue;
+    out += stride;
+    if (out != p)
+      memcpy(out, p, stride);
+  }
+  *kept = (size_t)(out - data) / stride + 1;
+  return TK_SUCCESS;
+}
+
+tk_error_t tk_algo_dedup_hashed(tk_iterator_t begin, tk_iterator_t end,
+                                tk_hash_fn_t hash, tk_key_equal_fn_t equal,
+                                size_t *kept) {
+  TK_ASSERT(kept != NULL);
+  *kept = 0;
+  if (tk_iter_equal(&begin, &end))
+    return TK_SUCCESS;
+  char *data;
+  size_t stride, count;
+  if (!tk_unique_span(&begin, &end, &data, &stride, &count))
+    return TK_E_INVALID_ARG;
+  if (count == 1) {
+    *kept = 1;
+    return TK_SUCCESS;
+  }
+  if (!hash)
+    hash = tk_hash_bytes;
+  if (!equal)
+    equal = tk_key_equal_bytes;
+
+  // The seen set holds the indices of kept elements, which stay put once
+  // written since 'out' only moves forward. Sized once for the worst case
+  // (all distinct) at a load factor of at most 1/2, so the pass below never
+  // rehashes and cannot fail.
+  size_t slots = 2;
+  while (slots < count) {
+    if (slots > SIZE_MAX / 4 / sizeof(size_t))
+      return TK_E_NOMEM;
+    slots <<= 1;
+  }
+  slots <<= 1;
+  const tk_allocator_t *allocator = tk_allocator_default();
+  size_t *seen = (size_t *)tk_allocator_alloc(allocator,
+                                              slots * sizeof(size_t));
+  if (!seen)
+    return TK_E_NOMEM;
+  memset(seen, 0xff, slots * sizeof(size_t)); // Every slot TK_UNIQUE_EMPTY
+
+  const size_t mask = slots - 1;
+  size_t out = 0;
+  for (size_t i = 0; i < count; ++i) {
+    const char *p = data + i * stride;
+    size_t slot = hash(p, stride) & mask;
+    tk_bool duplicate = false;
+    for (; seen[slot] != TK_UNIQUE_EMPTY; slot = (slot + 1) & mask) {
+      if (equal(data + seen[slot] * stride, p, stride)) {
+        duplicate = true;
+        break;
+      }
+    }
+    if (duplicate)
+      continue;
+    if (out != i)
+      memcpy(data + out * stride, p, stride);
+    seen[slot] = out++;
+  }
+  tk_allocator_free(allocator, seen, slots * sizeof(size_t));
+  *kept = out;
+  return TK_SUCCESS;
+}
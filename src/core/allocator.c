@@ -0,0 +1,42 @@
+/**
+ * @file allocator.c
+ * @brief Implements the default, malloc-backed toolkit allocator.
+ *
+ * The default allocator simply forwards to the C standard library. Size
+ * arguments are accepted for interface compatibility and ignored.
+ */
+
+#include <stdlib.h>
+#include <tk/core/allocator.h>
+
+static void *tk_default_alloc(void *ctx, size_t size) {
+  (void)ctx;
+  return malloc(size);
+}
+
+static void *tk_default_realloc(void *ctx, void *ptr, size_t old_size,
+                                size_t new_size) {
+  (void)ctx;
+  (void)old_size;
+  return realloc(ptr, new_size);
+}
+
+static void tk_default_free(void *ctx, void *ptr, size_t size) {
+  (void)ctx;
+  (void)size;
+  free(ptr);
+}
+
+/**
+ * @brief The single, static default allocator instance.
+ */
+static const tk_allocator_t g_default_allocator = {
+    .alloc = tk_default_alloc,
+    .realloc = tk_default_realloc,
+    .free = tk_default_free,
+    .ctx = NULL,
+};
+
+const tk_allocator_t *tk_allocator_default(void) {
+  return &g_default_allocator;
+}
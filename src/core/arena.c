@@ -0,0 +1,240 @@
+/**
+ * @file arena.c
+ * @brief Implements the toolkit's linear (bump) arena allocator.
+ *
+ * @details
+ * Chunks form a singly-linked list. The arena bumps an offset through the
+ * current chunk ('cursor'); when it runs out, it moves on to the next chunk
+ * if that one is large enough (chunks kept by a reset/rewind), or allocates
+ * a new chunk and links it in right after the cursor. Rewinding therefore
+ * only has to restore (cursor, offset), which makes mark/rewind and reset
+ * O(1).
+ *
+ * Every chunk records 'base', the number of arena bytes before it, so the
+ * bytes-used figure is also O(1).
+ */
+
+#include <string.h>
+#include <tk/core/allocator.h>
+#include <tk/core/arena.h>
+#include <tk/core/macros.h>
+
+/**
+ * @brief Alignment of every block handed out by the arena.
+ */
+#define TK_ARENA_ALIGNMENT 16
+
+/**
+ * @brief Default usable chunk size used when the caller passes 0.
+ */
+#define TK_ARENA_DEFAULT_CHUNK_SIZE (64 * 1024)
+
+/**
+ * @brief Rounds 'n' up to a multiple of TK_ARENA_ALIGNMENT.
+ */
+#define TK_ARENA_ALIGN(n)                                                      \
+  (((n) + TK_ARENA_ALIGNMENT - 1) & ~(size_t)(TK_ARENA_ALIGNMENT - 1))
+
+/**
+ * @brief Header placed at the start of every chunk.
+ */
+typedef struct tk_arena_chunk_t {
+  struct tk_arena_chunk_t *next; // Next chunk in the list
+  size_t capacity;               // Usable bytes after the header
+  size_t base;                   // Arena bytes used before this chunk
+} tk_arena_chunk_t;
+
+/**
+ * @brief Header size rounded up so the first block is aligned.
+ */
+#define TK_ARENA_CHUNK_HEADER TK_ARENA_ALIGN(sizeof(tk_arena_chunk_t))
+
+/**
+ * @struct tk_arena_t
+ * @brief The opaque struct for the arena.
+ */
+struct tk_arena_t {
+  size_t chunk_size;        // Usable size of a regular chunk
+  tk_arena_chunk_t *head;   // First chunk, or NULL
+  tk_arena_chunk_t *cursor; // Chunk being bumped through, or NULL
+  size_t offset;            // Bump offset within 'cursor'
+  char *last;               // Most recent allocation, or NULL
+  tk_allocator_t allocator; // Backing allocator for chunks and this handle
+};
+
+// --- Helper Functions ---
+
+/**
+ * @brief Returns the first usable byte of a chunk.
+ */
+static char *tk_arena_chunk_data(tk_arena_chunk_t *chunk) {
+  return (char *)chunk + TK_ARENA_CHUNK_HEADER;
+}
+
+/**
+ * @brief Moves the cursor to a chunk that can hold 'size' bytes, reusing the
+ * next chunk when it is large enough and allocating a new one otherwise.
+ * @return `true` on success, `false` if a chunk could not be allocated.
+ */
+static tk_bool tk_arena_advance(tk_arena_t *arena, size_t size) {
+  size_t base = arena->cursor ? arena->cursor->base + arena->cursor->capacity
+                              : 0;
+  tk_arena_chunk_t *next = arena->cursor ? arena->cursor->next : arena->head;
+
+  if (!next || next->capacity < size) {
+    size_t capacity = size > arena->chunk_size ? size : arena->chunk_size;
+    tk_arena_chunk_t *chunk = (tk_arena_chunk_t *)tk_allocator_alloc(
+        &arena->allocator, TK_ARENA_CHUNK_HEADER + capacity);
+    if (!chunk)
+      return false;
+
+    chunk->capacity = capacity;
+    chunk->next = next;
+    if (arena->cursor)
+      arena->cursor->next = chunk;
+    else
+      arena->head = chunk;
+    next = chunk;
+  }
+
+  next->base = base;
+  arena->cursor = next;
+  arena->offset = 0;
+  return true;
+}
+
+// --- Lifecycle Functions ---
+
+tk_arena_t *tk_arena_create(size_t chunk_size,
+                            const tk_allocator_t *allocator) {
+  tk_allocator_validate(allocator);
+  if (!allocator)
+    return NULL;
+
+  tk_arena_t *arena =
+      (tk_arena_t *)tk_allocator_alloc(allocator, sizeof(tk_arena_t));
+  if (!arena)
+    return NULL;
+
+  arena->chunk_size =
+      TK_ARENA_ALIGN(chunk_size ? chunk_size : TK_ARENA_DEFAULT_CHUNK_SIZE);
+  arena->head = NULL;
+  arena->cursor = NULL;
+  arena->offset = 0;
+  arena->last = NULL;
+  arena->allocator = *allocator;
+  return arena;
+}
+
+void tk_arena_destroy(tk_arena_t *arena) {
+  if (!arena)
+    return;
+
+  tk_arena_chunk_t *chunk = arena->head;
+  while (chunk) {
+    tk_arena_chunk_t *next = chunk->next;
+    tk_allocator_free(&arena->allocator, chunk,
+                      TK_ARENA_CHUNK_HEADER + chunk->capacity);
+    chunk = next;
+  }
+
+  tk_allocator_t allocator = arena->allocator;
+  tk_allocator_free(&allocator, arena, sizeof(tk_arena_t));
+}
+
+// --- Allocation Functions ---
+
+void *tk_arena_alloc(tk_arena_t *arena, size_t size) {
+  TK_ASSERT(arena != NULL);
+  TK_ASSERT(size > 0);
+  size = TK_ARENA_ALIGN(size);
+
+  if (!arena->cursor || arena->cursor->capacity - arena->offset < size) {
+    if (!tk_arena_advance(arena, size))
+      return NULL;
+  }
+
+  char *block = tk_arena_chunk_data(arena->cursor) + arena->offset;
+  arena->offset += size;
+  arena->last = block;
+  return block;
+}
+
+tk_arena_mark_t tk_arena_mark(const tk_arena_t *arena) {
+  TK_ASSERT(arena != NULL);
+  tk_arena_mark_t mark = {.chunk = arena->cursor, .offset = arena->offset};
+  return mark;
+}
+
+void tk_arena_rewind(tk_arena_t *arena, tk_arena_mark_t mark) {
+  TK_ASSERT(arena != NULL);
+  if (!mark.chunk) {
+    // Taken before the first chunk existed.
+    tk_arena_reset(arena);
+    return;
+  }
+  arena->cursor = (tk_arena_chunk_t *)mark.chunk;
+  arena->offset = mark.offset;
+  arena->last = NULL;
+}
+
+void tk_arena_reset(tk_arena_t *arena) {
+  TK_ASSERT(arena != NULL);
+  // The head chunk is reused by the next allocation via tk_arena_advance.
+  arena->cursor = NULL;
+  arena->offset = 0;
+  arena->last = NULL;
+}
+
+size_t tk_arena_bytes_used(const tk_arena_t *arena) {
+  TK_ASSERT(arena != NULL);
+  return arena->cursor ? arena->cursor->base + arena->offset : 0;
+}
+
+// --- tk_allocator_t Adapter ---
+
+static void *tk_arena_allocator_alloc(void *ctx, size_t size) {
+  return tk_arena_alloc((tk_arena_t *)ctx, size);
+}
+
+static void *tk_arena_allocator_realloc(void *ctx, void *ptr, size_t old_size,
+                                        size_t new_size) {
+  tk_arena_t *arena = (tk_arena_t *)ctx;
+
+  // Grow (or shrink) the most recent allocation in place when it fits.
+  if ((char *)ptr == arena->last) {
+    size_t start = (size_t)(arena->last - tk_arena_chunk_data(arena->cursor));
+    size_t size = TK_ARENA_ALIGN(new_size);
+    if (arena->cursor->capacity - start >= size) {
+      arena->offset = start + size;
+      return ptr;
+    }
+  }
+
+  void *block = tk_arena_alloc(arena, new_size);
+  if (!block)
+    return NULL;
+  memcpy(block, ptr, old_size < new_size ? old_size : new_size);
+  return block;
+}
+
+static void tk_arena_allocator_free(void *ctx, void *ptr, size_t size) {
+  tk_arena_t *arena = (tk_arena_t *)ctx;
+  (void)size;
+
+  // Only the most recent allocation can be handed back; everything else is
+  // reclaimed by rewind/reset.
+  if ((char *)ptr == arena->last) {
+    arena->offset = (size_t)(arena->last - tk_arena_chunk_data(arena->cursor));
+    arena->last = NULL;
+  }
+}
+
+tk_allocator_t tk_arena_allocator(tk_arena_t *arena) {
+  TK_ASSERT(arena != NULL);
+  tk_allocator_t allocator = {.alloc = tk_arena_allocator_alloc,
+                              .realloc = tk_arena_allocator_realloc,
+                              .free = tk_arena_allocator_free,
+                              .ctx = arena};
+  return allocator;
+}
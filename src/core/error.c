@@ -46,6 +46,12 @@ const char *tk_strerror(tk_error_t err) {
     return "Container is empty";
   case TK_E_NOT_FOUND:
     return "Item not found";
+  case TK_E_FULL:
+    return "Container is full";
+
+  // --- System Errors ---
+  case TK_E_IO:
+    return "I/O error";
 
   // --- Default Case ---
   case TK_E_UNKNOWN:
@@ -0,0 +1,637 @@
+/**
+ * @file pool.c
+ * @brief Implements the toolkit's work-stealing thread pool.
+ *
+ * @details
+ * Worker deques follow "Correct and Efficient Work-Stealing for Weak Memory
+ * Models" (Lê, Pop, Cohen, Zappa Nardelli, PPoPP 2013): the owner pushes
+ * and takes at 'bottom', thieves CAS 'top', and a full deque is replaced by
+ * one twice the size. Replaced buffers may still be read by a thief, so
+ * they are retired to a list and only freed when the pool is destroyed.
+ *
+ * Sleeping uses one mutex/condvar pair. 'queued' counts tasks pushed but not
+ * yet taken; a submitter bumps it and then wakes a sleeper if 'sleepers' is
+ * non-zero, while a worker registers as a sleeper and then re-checks
+ * 'queued' under the mutex. Both sides use sequentially consistent
+ * operations, so at least one of them sees the other and no wake-up is lost.
+ *
+ * A thread in tk_pool_wait that finds no task sleeps on the same condvar,
+ * counted in both 'sleepers' (so new work wakes it to help) and 'waiters'.
+ * The task whose completion drains a wait group broadcasts if 'waiters' is
+ * non-zero, by the same register-then-recheck argument. Groups completed by
+ * hand with tk_wait_group_done bypass that broadcast, so the sleep is timed
+ * (TK_POOL_WAIT_POLL_MS) and the group re-checked.
+ */
+
+#define _POSIX_C_SOURCE 200809L // For sysconf and clock_gettime
+
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include <tk/core/atomic.h>
+#include <tk/core/macros.h>
+#include <tk/core/pool.h>
+
+/**
+ * @brief Initial number of slots in a worker deque (a power of two).
+ */
+#define TK_POOL_DEQUE_INITIAL 256
+
+/**
+ * @brief How often a blocked tk_pool_wait re-checks its group, in
+ * milliseconds, in case it was completed without a wake-up.
+ */
+#ifndef TK_POOL_WAIT_POLL_MS
+#define TK_POOL_WAIT_POLL_MS 10
+#endif
+
+typedef struct tk_pool_task_t tk_pool_task_t;
+typedef struct tk_pool_worker_t tk_pool_worker_t;
+
+/**
+ * @brief A queued unit of work: either a user task or a parallel_for range.
+ */
+struct tk_pool_task_t {
+  void (*run)(tk_pool_t *pool, tk_pool_task_t *task); // Executes the task
+  tk_task_fn_t fn;                                    // User task function
+  void *ctx;                                          // User task context
+  const struct tk_pool_range_t *range;                // parallel_for loop
+  size_t first;                                       // Sub-range start
+  size_t last;                                        // Sub-range end
+  tk_wait_group_t *wg;                                // Group to notify
+  tk_pool_task_t *next;                               // Injection queue link
+};
+
+/**
+ * @brief Shared description of one parallel_for loop.
+ */
+typedef struct tk_pool_range_t {
+  tk_range_fn_t fn;    // Loop body
+  void *ctx;           // Loop body context
+  size_t grain;        // Largest sub-range passed to 'fn'
+  tk_wait_group_t *wg; // Tracks every spawned sub-range
+} tk_pool_range_t;
+
+/**
+ * @brief The circular buffer of a Chase-Lev deque.
+ */
+typedef struct tk_pool_buffer_t {
+  size_t mask;                      // Slot count - 1
+  struct tk_pool_buffer_t *retired; // Older buffer replaced by this one
+  tk_pool_task_t *slots[];          // (atomic) Task pointers
+} tk_pool_buffer_t;
+
+/**
+ * @brief A Chase-Lev work-stealing deque.
+ */
+typedef struct {
+  int64_t top;              // (atomic) Next index to steal
+  int64_t bottom;           // (atomic) Next index to push
+  tk_pool_buffer_t *buffer; // (atomic) Current buffer
+} tk_pool_deque_t;
+
+/**
+ * @brief Per-thread worker state.
+ */
+struct tk_pool_worker_t {
+  tk_pool_deque_t deque;  // This worker's tasks
+  tk_pool_t *pool;        // Owning pool
+  pthread_t thread;       // The worker thread
+  unsigned long long rng; // Victim selection state (xorshift64)
+};
+
+/**
+ * @struct tk_pool_t
+ * @brief The opaque struct for the thread pool.
+ */
+struct tk_pool_t {
+  tk_pool_worker_t *workers;   // Worker array
+  size_t num_workers;          // Worker count
+  pthread_mutex_t lock;        // Guards the injection queue and sleeping
+  pthread_cond_t wake;         // Signaled when work arrives or on stop
+  tk_pool_task_t *inject_head; // Injection queue (FIFO), under 'lock'
+  tk_pool_task_t *inject_tail; // Injection queue tail, under 'lock'
+  size_t injected;             // (atomic) Tasks in the injection queue
+  size_t queued;               // (atomic) Tasks pushed but not yet taken
+  size_t sleepers;             // (atomic) Threads waiting on 'wake'
+  size_t waiters;              // (atomic) Of those, ones in tk_pool_wait
+  int stop;                    // (atomic) Set by tk_pool_destroy
+  tk_allocator_t allocator;    // Source of all pool memory
+};
+
+/**
+ * @brief The worker the current thread is, or NULL outside any pool.
+ */
+static TK_THREAD_LOCAL tk_pool_worker_t *tk_pool_self;
+
+/**
+ * @brief Victim selection state of threads that are not pool workers.
+ */
+static TK_THREAD_LOCAL unsigned long long tk_pool_outsider_rng =
+    0x2545F4914F6CDD1Dull;
+
+// --- Chase-Lev Deque ---
+
+static tk_pool_buffer_t *tk_pool_buffer_create(tk_pool_t *pool,
+                                               size_t slots) {
+  tk_pool_buffer_t *buffer = (tk_pool_buffer_t *)tk_allocator_alloc(
+      &pool->allocator,
+      sizeof(tk_pool_buffer_t) + slots * sizeof(tk_pool_task_t *));
+  if (buffer) {
+    buffer->mask = slots - 1;
+    buffer->retired = NULL;
+  }
+  return buffer;
+}
+
+static void tk_pool_buffer_destroy(tk_pool_t *pool, tk_pool_buffer_t *buffer) {
+  while (buffer) {
+    tk_pool_buffer_t *retired = buffer->retired;
+    tk_allocator_free(&pool->allocator, buffer,
+                      sizeof(tk_pool_buffer_t) +
+                          (buffer->mask + 1) * sizeof(tk_pool_task_t *));
+    buffer = retired;
+  }
+}
+
+/**
+ * @brief (Owner only) Pushes a task at the bottom.
+ * @return `false` if the deque was full and could not grow.
+ */
+static tk_bool tk_pool_deque_push(tk_pool_t *pool, tk_pool_deque_t *deque,
+                                  tk_pool_task_t *task) {
+  int64_t b = TK_ATOMIC_LOAD(&deque->bottom, TK_ATOMIC_RELAXED);
+  int64_t t = TK_ATOMIC_LOAD(&deque->top, TK_ATOMIC_ACQUIRE);
+  tk_pool_buffer_t *buffer = TK_ATOMIC_LOAD(&deque->buffer, TK_ATOMIC_RELAXED);
+
+  if ((size_t)(b - t) > buffer->mask) {
+    tk_pool_buffer_t *grown =
+        tk_pool_buffer_create(pool, 2 * (buffer->mask + 1));
+    if (!grown)
+      return false;
+    for (int64_t i = t; i < b; ++i) {
+      grown->slots[i & grown->mask] = TK_ATOMIC_LOAD(
+          &buffer->slots[i & buffer->mask], TK_ATOMIC_RELAXED);
+    }
+    grown->retired = buffer;
+    TK_ATOMIC_STORE(&deque->buffer, grown, TK_ATOMIC_RELEASE);
+    buffer = grown;
+  }
+
+  TK_ATOMIC_STORE(&buffer->slots[b & buffer->mask], task, TK_ATOMIC_RELAXED);
+  TK_ATOMIC_FENCE(TK_ATOMIC_RELEASE);
+  TK_ATOMIC_STORE(&deque->bottom, b + 1, TK_ATOMIC_RELAXED);
+  return true;
+}
+
+/**
+ * @brief (Owner only) Takes the most recently pushed task.
+ * @return The task, or NULL if the deque is empty.
+ */
+static tk_pool_task_t *tk_pool_deque_take(tk_pool_deque_t *deque) {
+  int64_t b = TK_ATOMIC_LOAD(&deque->bottom, TK_ATOMIC_RELAXED) - 1;
+  tk_pool_buffer_t *buffer = TK_ATOMIC_LOAD(&deque->buffer, TK_ATOMIC_RELAXED);
+  TK_ATOMIC_STORE(&deque->bottom, b, TK_ATOMIC_RELAXED);
+  TK_ATOMIC_FENCE(TK_ATOMIC_SEQ_CST);
+  int64_t t = TK_ATOMIC_LOAD(&deque->top, TK_ATOMIC_RELAXED);
+
+  if (t > b) {
+    // Empty.
+    TK_ATOMIC_STORE(&deque->bottom, b + 1, TK_ATOMIC_RELAXED);
+    return NULL;
+  }
+
+  tk_pool_task_t *task =
+      TK_ATOMIC_LOAD(&buffer->slots[b & buffer->mask], TK_ATOMIC_RELAXED);
+  if (t == b) {
+    // Last task: race the thieves for it.
+    if (!TK_ATOMIC_CAS(&deque->top, &t, t + 1, TK_ATOMIC_SEQ_CST,
+                       TK_ATOMIC_RELAXED))
+      task = NULL;
+    TK_ATOMIC_STORE(&deque->bottom, b + 1, TK_ATOMIC_RELAXED);
+  }
+  return task;
+}
+
+/**
+ * @brief (Any thread) Steals the oldest task.
+ * @return The task, or NULL if the deque is empty or the steal lost a race.
+ */
+static tk_pool_task_t *tk_pool_deque_steal(tk_pool_deque_t *deque) {
+  int64_t t = TK_ATOMIC_LOAD(&deque->top, TK_ATOMIC_ACQUIRE);
+  TK_ATOMIC_FENCE(TK_ATOMIC_SEQ_CST);
+  int64_t b = TK_ATOMIC_LOAD(&deque->bottom, TK_ATOMIC_ACQUIRE);
+  if (t >= b)
+    return NULL;
+
+  tk_pool_buffer_t *buffer = TK_ATOMIC_LOAD(&deque->buffer, TK_ATOMIC_ACQUIRE);
+  tk_pool_task_t *task =
+      TK_ATOMIC_LOAD(&buffer->slots[t & buffer->mask], TK_ATOMIC_RELAXED);
+  if (!TK_ATOMIC_CAS(&deque->top, &t, t + 1, TK_ATOMIC_SEQ_CST,
+                     TK_ATOMIC_RELAXED))
+    return NULL;
+  return task;
+}
+
+// --- Scheduling Helpers ---
+
+/**
+ * @brief Wakes one sleeping worker if there is any.
+ */
+static void tk_pool_notify(tk_pool_t *pool) {
+  if (TK_ATOMIC_LOAD(&pool->sleepers, TK_ATOMIC_SEQ_CST) == 0)
+    return;
+  pthread_mutex_lock(&pool->lock);
+  pthread_cond_signal(&pool->wake);
+  pthread_mutex_unlock(&pool->lock);
+}
+
+/**
+ * @brief Queues a task on the current worker's deque when called from one
+ * of this pool's workers, on the injection queue otherwise.
+ */
+static void tk_pool_enqueue(tk_pool_t *pool, tk_pool_task_t *task) {
+  tk_pool_worker_t *self = tk_pool_self;
+  TK_ATOMIC_FETCH_ADD(&pool->queued, 1, TK_ATOMIC_SEQ_CST);
+
+  if (!self || self->pool != pool ||
+      !tk_pool_deque_push(pool, &self->deque, task)) {
+    pthread_mutex_lock(&pool->lock);
+    task->next = NULL;
+    if (pool->inject_tail)
+      pool->inject_tail->next = task;
+    else
+      pool->inject_head = task;
+    pool->inject_tail = task;
+    TK_ATOMIC_FETCH_ADD(&pool->injected, 1, TK_ATOMIC_RELAXED);
+    pthread_mutex_unlock(&pool->lock);
+  }
+  tk_pool_notify(pool);
+}
+
+/**
+ * @brief Pops the oldest task of the injection queue.
+ */
+static tk_pool_task_t *tk_pool_pop_injected(tk_pool_t *pool) {
+  if (TK_ATOMIC_LOAD(&pool->injected, TK_ATOMIC_RELAXED) == 0)
+    return NULL;
+
+  pthread_mutex_lock(&pool->lock);
+  tk_pool_task_t *task = pool->inject_head;
+  if (task) {
+    pool->inject_head = task->next;
+    if (!pool->inject_head)
+      pool->inject_tail = NULL;
+    TK_ATOMIC_FETCH_SUB(&pool->injected, 1, TK_ATOMIC_RELAXED);
+  }
+  pthread_mutex_unlock(&pool->lock);
+  return task;
+}
+
+/**
+ * @brief Finds a task for 'self' (which may be NULL for a non-worker
+ * thread): own deque first, then the injection queue, then the other
+ * workers' deques.
+ */
+static tk_pool_task_t *tk_pool_find_task(tk_pool_t *pool,
+                                         tk_pool_worker_t *self) {
+  tk_pool_task_t *task = NULL;
+  if (self)
+    task = tk_pool_deque_take(&self->deque);
+  if (!task)
+    task = tk_pool_pop_injected(pool);
+
+  if (!task) {
+    unsigned long long *rng = self ? &self->rng : &tk_pool_outsider_rng;
+    unsigned long long x = *rng;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    *rng = x;
+
+    size_t start = (size_t)(x % pool->num_workers);
+    for (size_t i = 0; i < pool->num_workers && !task; ++i) {
+      tk_pool_worker_t *victim =
+          &pool->workers[(start + i) % pool->num_workers];
+      if (victim != self)
+        task = tk_pool_deque_steal(&victim->deque);
+    }
+  }
+
+  if (task)
+    TK_ATOMIC_FETCH_SUB(&pool->queued, 1, TK_ATOMIC_SEQ_CST);
+  return task;
+}
+
+/**
+ * @brief Runs a task, notifies its wait group and frees its record.
+ */
+static void tk_pool_execute(tk_pool_t *pool, tk_pool_task_t *task) {
+  tk_wait_group_t *wg = task->wg;
+  task->run(pool, task);
+  tk_allocator_free(&pool->allocator, task, sizeof(tk_pool_task_t));
+  if (!wg)
+    return;
+
+  // The group may be gone as soon as it drains, so it is not touched again.
+  if (TK_ATOMIC_FETCH_SUB(&wg->pending, 1, TK_ATOMIC_SEQ_CST) == 1 &&
+      TK_ATOMIC_LOAD(&pool->waiters, TK_ATOMIC_SEQ_CST) != 0) {
+    pthread_mutex_lock(&pool->lock);
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+  }
+}
+
+static tk_pool_task_t *tk_pool_task_create(tk_pool_t *pool) {
+  tk_pool_task_t *task = (tk_pool_task_t *)tk_allocator_alloc(
+      &pool->allocator, sizeof(tk_pool_task_t));
+  if (task) {
+    task->fn = NULL;
+    task->ctx = NULL;
+    task->range = NULL;
+    task->first = 0;
+    task->last = 0;
+    task->wg = NULL;
+    task->next = NULL;
+  }
+  return task;
+}
+
+static void tk_pool_run_user_task(tk_pool_t *pool, tk_pool_task_t *task) {
+  (void)pool;
+  task->fn(task->ctx);
+}
+
+static void tk_pool_run_range_task(tk_pool_t *pool, tk_pool_task_t *task);
+
+/**
+ * @brief Processes [first, last) of a parallel_for, splitting off the upper
+ * half as a stealable task while the range is larger than the grain.
+ */
+static void tk_pool_run_range(tk_pool_t *pool, const tk_pool_range_t *range,
+                              size_t first, size_t last) {
+  while (last - first > range->grain) {
+    tk_pool_task_t *task = tk_pool_task_create(pool);
+    if (!task)
+      break; // Out of memory: process the rest on this thread.
+
+    size_t mid = first + (last - first) / 2;
+    task->run = tk_pool_run_range_task;
+    task->range = range;
+    task->first = mid;
+    task->last = last;
+    task->wg = range->wg;
+    tk_wait_group_add(range->wg, 1);
+    tk_pool_enqueue(pool, task);
+    last = mid;
+  }
+  range->fn(first, last, range->ctx);
+}
+
+static void tk_pool_run_range_task(tk_pool_t *pool, tk_pool_task_t *task) {
+  tk_pool_run_range(pool, task->range, task->first, task->last);
+}
+
+/**
+ * @brief The main loop of a worker thread.
+ */
+static void *tk_pool_worker_main(void *arg) {
+  tk_pool_worker_t *self = (tk_pool_worker_t *)arg;
+  tk_pool_t *pool = self->pool;
+  tk_pool_self = self;
+
+  for (;;) {
+    tk_pool_task_t *task = tk_pool_find_task(pool, self);
+    if (task) {
+      tk_pool_execute(pool, task);
+      continue;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    TK_ATOMIC_FETCH_ADD(&pool->sleepers, 1, TK_ATOMIC_SEQ_CST);
+    while (TK_ATOMIC_LOAD(&pool->queued, TK_ATOMIC_SEQ_CST) == 0 &&
+           !TK_ATOMIC_LOAD(&pool->stop, TK_ATOMIC_SEQ_CST)) {
+      pthread_cond_wait(&pool->wake, &pool->lock);
+    }
+    TK_ATOMIC_FETCH_SUB(&pool->sleepers, 1, TK_ATOMIC_SEQ_CST);
+    tk_bool stop = TK_ATOMIC_LOAD(&pool->queued, TK_ATOMIC_SEQ_CST) == 0 &&
+                   TK_ATOMIC_LOAD(&pool->stop, TK_ATOMIC_SEQ_CST);
+    pthread_mutex_unlock(&pool->lock);
+    if (stop)
+      break;
+  }
+
+  tk_pool_self = NULL;
+  return NULL;
+}
+
+// --- Lifecycle Functions ---
+
+tk_pool_t *tk_pool_create(size_t num_threads) {
+  return tk_pool_create_with_allocator(num_threads, tk_allocator_default());
+}
+
+tk_pool_t *tk_pool_create_with_allocator(size_t num_threads,
+                                         const tk_allocator_t *allocator) {
+  tk_allocator_validate(allocator);
+  if (!allocator)
+    return NULL;
+  if (num_threads == 0) {
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    num_threads = cpus > 0 ? (size_t)cpus : 1;
+  }
+
+  tk_pool_t *pool =
+      (tk_pool_t *)tk_allocator_alloc(allocator, sizeof(tk_pool_t));
+  if (!pool)
+    return NULL;
+  pool->allocator = *allocator;
+  pool->num_workers = num_threads;
+  pool->inject_head = NULL;
+  pool->inject_tail = NULL;
+  pool->injected = 0;
+  pool->queued = 0;
+  pool->sleepers = 0;
+  pool->waiters = 0;
+  pool->stop = 0;
+
+  pool->workers = (tk_pool_worker_t *)tk_allocator_alloc(
+      allocator, num_threads * sizeof(tk_pool_worker_t));
+  if (!pool->workers) {
+    tk_allocator_free(allocator, pool, sizeof(tk_pool_t));
+    return NULL;
+  }
+
+  // Set up every deque before any thread can try to steal from it.
+  size_t ready = 0;
+  for (; ready < num_threads; ++ready) {
+    tk_pool_worker_t *worker = &pool->workers[ready];
+    worker->pool = pool;
+    worker->rng = 0x9E3779B97F4A7C15ull * (ready + 1);
+    worker->deque.top = 0;
+    worker->deque.bottom = 0;
+    worker->deque.buffer = tk_pool_buffer_create(pool, TK_POOL_DEQUE_INITIAL);
+    if (!worker->deque.buffer)
+      break;
+  }
+
+  pthread_mutex_init(&pool->lock, NULL);
+  pthread_cond_init(&pool->wake, NULL);
+
+  size_t started = 0;
+  if (ready == num_threads) {
+    for (; started < num_threads; ++started) {
+      tk_pool_worker_t *worker = &pool->workers[started];
+      if (pthread_create(&worker->thread, NULL, tk_pool_worker_main,
+                         worker) != 0)
+        break;
+    }
+  }
+
+  if (started < num_threads) {
+    // Tear down whatever was set up.
+    pool->num_workers = started;
+    ready = ready < num_threads ? ready : num_threads;
+    TK_ATOMIC_STORE(&pool->stop, 1, TK_ATOMIC_SEQ_CST);
+    pthread_mutex_lock(&pool->lock);
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+    for (size_t i = 0; i < started; ++i)
+      pthread_join(pool->workers[i].thread, NULL);
+    for (size_t i = 0; i < ready; ++i)
+      tk_pool_buffer_destroy(pool, pool->workers[i].deque.buffer);
+    pthread_cond_destroy(&pool->wake);
+    pthread_mutex_destroy(&pool->lock);
+    tk_allocator_free(allocator, pool->workers,
+                      num_threads * sizeof(tk_pool_worker_t));
+    tk_allocator_free(allocator, pool, sizeof(tk_pool_t));
+    return NULL;
+  }
+  return pool;
+}
+
+void tk_pool_destroy(tk_pool_t *pool) {
+  if (!pool)
+    return;
+  TK_ASSERT(!tk_pool_self || tk_pool_self->pool != pool);
+
+  TK_ATOMIC_STORE(&pool->stop, 1, TK_ATOMIC_SEQ_CST);
+  pthread_mutex_lock(&pool->lock);
+  pthread_cond_broadcast(&pool->wake);
+  pthread_mutex_unlock(&pool->lock);
+
+  for (size_t i = 0; i < pool->num_workers; ++i)
+    pthread_join(pool->workers[i].thread, NULL);
+  for (size_t i = 0; i < pool->num_workers; ++i)
+    tk_pool_buffer_destroy(pool, pool->workers[i].deque.buffer);
+
+  pthread_cond_destroy(&pool->wake);
+  pthread_mutex_destroy(&pool->lock);
+
+  tk_allocator_t allocator = pool->allocator;
+  tk_allocator_free(&allocator, pool->workers,
+                    pool->num_workers * sizeof(tk_pool_worker_t));
+  tk_allocator_free(&allocator, pool, sizeof(tk_pool_t));
+}
+
+static tk_pool_t *g_default_pool;
+static pthread_once_t g_default_pool_once = PTHREAD_ONCE_INIT;
+
+static void tk_pool_default_init(void) { g_default_pool = tk_pool_create(0); }
+
+tk_pool_t *tk_pool_default(void) {
+  pthread_once(&g_default_pool_once, tk_pool_default_init);
+  return g_default_pool;
+}
+
+size_t tk_pool_num_threads(const tk_pool_t *pool) {
+  TK_ASSERT(pool);
+  return pool->num_workers;
+}
+
+// --- Wait Groups ---
+
+void tk_wait_group_init(tk_wait_group_t *wg) {
+  TK_ASSERT(wg);
+  TK_ATOMIC_STORE(&wg->pending, 0, TK_ATOMIC_RELAXED);
+}
+
+void tk_wait_group_add(tk_wait_group_t *wg, size_t n) {
+  TK_ASSERT(wg);
+  TK_ATOMIC_FETCH_ADD(&wg->pending, n, TK_ATOMIC_RELAXED);
+}
+
+void tk_wait_group_done(tk_wait_group_t *wg) {
+  TK_ASSERT(wg);
+  TK_ATOMIC_FETCH_SUB(&wg->pending, 1, TK_ATOMIC_RELEASE);
+}
+
+void tk_pool_wait(tk_pool_t *pool, tk_wait_group_t *wg) {
+  TK_ASSERT(pool && wg);
+  tk_pool_worker_t *self =
+      tk_pool_self && tk_pool_self->pool == pool ? tk_pool_self : NULL;
+
+  while (TK_ATOMIC_LOAD(&wg->pending, TK_ATOMIC_ACQUIRE) != 0) {
+    tk_pool_task_t *task = tk_pool_find_task(pool, self);
+    if (task) {
+      tk_pool_execute(pool, task);
+      continue;
+    }
+
+    // Nothing to help with: block until work arrives or the group drains.
+    struct timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_nsec += TK_POOL_WAIT_POLL_MS * 1000000L;
+    if (deadline.tv_nsec >= 1000000000L) {
+      deadline.tv_sec += deadline.tv_nsec / 1000000000L;
+      deadline.tv_nsec %= 1000000000L;
+    }
+    pthread_mutex_lock(&pool->lock);
+    TK_ATOMIC_FETCH_ADD(&pool->sleepers, 1, TK_ATOMIC_SEQ_CST);
+    TK_ATOMIC_FETCH_ADD(&pool->waiters, 1, TK_ATOMIC_SEQ_CST);
+    int timed_out = 0;
+    while (!timed_out &&
+           TK_ATOMIC_LOAD(&pool->queued, TK_ATOMIC_SEQ_CST) == 0 &&
+           TK_ATOMIC_LOAD(&wg->pending, TK_ATOMIC_SEQ_CST) != 0) {
+      timed_out = pthread_cond_timedwait(&pool->wake, &pool->lock, &deadline);
+    }
+    TK_ATOMIC_FETCH_SUB(&pool->waiters, 1, TK_ATOMIC_SEQ_CST);
+    TK_ATOMIC_FETCH_SUB(&pool->sleepers, 1, TK_ATOMIC_SEQ_CST);
+    pthread_mutex_unlock(&pool->lock);
+  }
+}
+
+// --- Task Functions ---
+
+tk_error_t tk_pool_submit(tk_pool_t *pool, tk_task_fn_t fn, void *ctx,
+                          tk_wait_group_t *wg) {
+  TK_ASSERT(pool && fn);
+  if (!pool || !fn)
+    return TK_E_INVALID_ARG;
+
+  tk_pool_task_t *task = tk_pool_task_create(pool);
+  if (!task)
+    return TK_E_NOMEM;
+  task->run = tk_pool_run_user_task;
+  task->fn = fn;
+  task->ctx = ctx;
+  task->wg = wg;
+  if (wg)
+    tk_wait_group_add(wg, 1);
+  tk_pool_enqueue(pool, task);
+  return TK_SUCCESS;
+}
+
+void tk_pool_parallel_for(tk_pool_t *pool, size_t begin, size_t end,
+                          size_t grain, tk_range_fn_t fn, void *ctx) {
+  TK_ASSERT(pool && fn);
+  if (begin >= end)
+    return;
+
+  tk_wait_group_t wg;
+  tk_wait_group_init(&wg);
+  tk_pool_range_t range = {
+      .fn = fn, .ctx = ctx, .grain = grain ? grain : 1, .wg = &wg};
+  tk_pool_run_range(pool, &range, begin, end);
+  tk_pool_wait(pool, &wg);
+}
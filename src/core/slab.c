@@ -0,0 +1,207 @@
+/**
+ * @file slab.c
+ * @brief Implements the toolkit's fixed-size block (slab) pool.
+ *
+ * @details
+ * Chunks form a singly-linked list in allocation order. Allocation first pops
+ * the intrusive free list, then bumps a cursor through the current chunk,
+ * then moves on to the next already-allocated chunk (after a reset), and only
+ * then asks the allocator for a new chunk, which is appended at the tail.
+ * Carving blocks sequentially keeps consecutively allocated blocks adjacent
+ * in memory.
+ */
+
+#include <tk/core/allocator.h>
+#include <tk/core/macros.h>
+#include <tk/core/slab.h>
+
+/**
+ * @brief Alignment of every block handed out by the slab.
+ */
+#define TK_SLAB_ALIGNMENT 16
+
+/**
+ * @brief Target chunk size used when the caller passes blocks_per_chunk = 0.
+ */
+#define TK_SLAB_DEFAULT_CHUNK_BYTES 4096
+
+/**
+ * @brief Header placed at the start of every chunk.
+ */
+typedef struct tk_slab_chunk_t {
+  struct tk_slab_chunk_t *next; // Next chunk in allocation order
+} tk_slab_chunk_t;
+
+/**
+ * @brief Header size rounded up so the first block is aligned.
+ */
+#define TK_SLAB_CHUNK_HEADER                                                   \
+  ((sizeof(tk_slab_chunk_t) + TK_SLAB_ALIGNMENT - 1) &                         \
+   ~(size_t)(TK_SLAB_ALIGNMENT - 1))
+
+/**
+ * @brief A free block, reinterpreted as a link in the free list.
+ */
+typedef struct tk_slab_free_block_t {
+  struct tk_slab_free_block_t *next;
+} tk_slab_free_block_t;
+
+/**
+ * @struct tk_slab_t
+ * @brief The opaque struct for the slab pool.
+ */
+struct tk_slab_t {
+  size_t block_size;               // Rounded size of one block
+  size_t blocks_per_chunk;         // Number of blocks in one chunk
+  tk_slab_free_block_t *free_list; // Recycled blocks (LIFO)
+  tk_slab_chunk_t *head;           // First chunk, or NULL
+  tk_slab_chunk_t *tail;           // Last chunk, or NULL
+  tk_slab_chunk_t *cursor;         // Chunk currently being carved, or NULL
+  char *bump;                      // Next uncarved block in 'cursor'
+  char *bump_end;                  // One past the last block in 'cursor'
+  tk_allocator_t allocator;        // Source of chunks and of this handle
+};
+
+// --- Helper Functions ---
+
+/**
+ * @brief Returns the number of bytes of one chunk, header included.
+ */
+static size_t tk_slab_chunk_bytes(const tk_slab_t *slab) {
+  return TK_SLAB_CHUNK_HEADER + slab->block_size * slab->blocks_per_chunk;
+}
+
+/**
+ * @brief Makes 'chunk' the chunk being carved.
+ */
+static void tk_slab_carve_from(tk_slab_t *slab, tk_slab_chunk_t *chunk) {
+  slab->cursor = chunk;
+  slab->bump = (char *)chunk + TK_SLAB_CHUNK_HEADER;
+  slab->bump_end = slab->bump + slab->block_size * slab->blocks_per_chunk;
+}
+
+/**
+ * @brief Moves the cursor to the next chunk, allocating one if needed.
+ * @return `true` on success, `false` if a chunk could not be allocated.
+ */
+static tk_bool tk_slab_next_chunk(tk_slab_t *slab) {
+  if (slab->cursor && slab->cursor->next) {
+    // Reuse a chunk kept by tk_slab_reset.
+    tk_slab_carve_from(slab, slab->cursor->next);
+    return true;
+  }
+
+  tk_slab_chunk_t *chunk = (tk_slab_chunk_t *)tk_allocator_alloc(
+      &slab->allocator, tk_slab_chunk_bytes(slab));
+  if (!chunk)
+    return false;
+
+  chunk->next = NULL;
+  if (slab->tail)
+    slab->tail->next = chunk;
+  else
+    slab->head = chunk;
+  slab->tail = chunk;
+
+  tk_slab_carve_from(slab, chunk);
+  return true;
+}
+
+// --- Lifecycle Functions ---
+
+tk_slab_t *tk_slab_create(size_t block_size, size_t blocks_per_chunk,
+                          const tk_allocator_t *allocator) {
+  TK_ASSERT(block_size > 0);
+  tk_allocator_validate(allocator);
+  if (block_size == 0 || !allocator)
+    return NULL;
+
+  // Every block must be able to hold a free-list link.
+  if (block_size < sizeof(tk_slab_free_block_t))
+    block_size = sizeof(tk_slab_free_block_t);
+  block_size = (block_size + TK_SLAB_ALIGNMENT - 1) &
+               ~(size_t)(TK_SLAB_ALIGNMENT - 1);
+
+  if (blocks_per_chunk == 0) {
+    blocks_per_chunk =
+        (TK_SLAB_DEFAULT_CHUNK_BYTES - TK_SLAB_CHUNK_HEADER) / block_size;
+    if (blocks_per_chunk < 8)
+      blocks_per_chunk = 8;
+  }
+
+  tk_slab_t *slab =
+      (tk_slab_t *)tk_allocator_alloc(allocator, sizeof(tk_slab_t));
+  if (!slab)
+    return NULL;
+
+  slab->block_size = block_size;
+  slab->blocks_per_chunk = blocks_per_chunk;
+  slab->free_list = NULL;
+  slab->head = NULL;
+  slab->tail = NULL;
+  slab->cursor = NULL;
+  slab->bump = NULL;
+  slab->bump_end = NULL;
+  slab->allocator = *allocator;
+  return slab;
+}
+
+void tk_slab_destroy(tk_slab_t *slab) {
+  if (!slab)
+    return;
+
+  size_t chunk_bytes = tk_slab_chunk_bytes(slab);
+  tk_slab_chunk_t *chunk = slab->head;
+  while (chunk) {
+    tk_slab_chunk_t *next = chunk->next;
+    tk_allocator_free(&slab->allocator, chunk, chunk_bytes);
+    chunk = next;
+  }
+
+  tk_allocator_t allocator = slab->allocator;
+  tk_allocator_free(&allocator, slab, sizeof(tk_slab_t));
+}
+
+// --- Block Functions ---
+
+void *tk_slab_alloc(tk_slab_t *slab) {
+  TK_ASSERT(slab != NULL);
+
+  // 1. Recycle a freed block.
+  if (slab->free_list) {
+    tk_slab_free_block_t *block = slab->free_list;
+    slab->free_list = block->next;
+    return block;
+  }
+
+  // 2. Carve the next block from the current chunk (or a new one).
+  if (slab->bump == slab->bump_end && !tk_slab_next_chunk(slab))
+    return NULL;
+
+  void *block = slab->bump;
+  slab->bump += slab->block_size;
+  return block;
+}
+
+void tk_slab_free(tk_slab_t *slab, void *block) {
+  TK_ASSERT(slab != NULL);
+  if (!block)
+    return;
+
+  tk_slab_free_block_t *link = (tk_slab_free_block_t *)block;
+  link->next = slab->free_list;
+  slab->free_list = link;
+}
+
+void tk_slab_reset(tk_slab_t *slab) {
+  TK_ASSERT(slab != NULL);
+  slab->free_list = NULL;
+  if (slab->head) {
+    tk_slab_carve_from(slab, slab->head);
+  }
+}
+
+size_t tk_slab_block_size(const tk_slab_t *slab) {
+  TK_ASSERT(slab != NULL);
+  return slab->block_size;
+}
@@ -0,0 +1,217 @@
+/**
+ * @file stats.c
+ * @brief Implements the toolkit's opt-in container statistics.
+ *
+ * @details
+ * Each thread records into its own block of counters, found through a
+ * TK_THREAD_LOCAL pointer and created on the thread's first recording. Only
+ * the owning thread writes a block, so an update is a relaxed load and a
+ * relaxed store; the atomics exist so that a concurrent snapshot reads whole
+ * values. Blocks are linked into a global list under a mutex, which is only
+ * taken when a thread registers, exits or a snapshot is taken. A pthread key
+ * destructor folds an exiting thread's counters into the retired totals and
+ * frees its block.
+ *
+ * Blocks are allocated with calloc, not through any tk_allocator_t, so the
+ * instrumentation never shows up in its own counters.
+ */
+
+#define _POSIX_C_SOURCE 200809L // For pthread_once and the pthread keys
+
+#include <string.h>
+#include <tk/core/macros.h>
+#include <tk/core/stats.h>
+
+#if defined(TK_ENABLE_STATS)
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <tk/core/atomic.h>
+
+/**
+ * @brief One thread's counters.
+ */
+typedef struct tk_stats_block_t {
+  tk_stats_counters_t kinds[TK_STATS_KIND_COUNT]; // (atomic) Owner-written
+  struct tk_stats_block_t *next;                  // Registry link
+  struct tk_stats_block_t *prev;                  // Registry link
+} tk_stats_block_t;
+
+static pthread_mutex_t g_stats_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t g_stats_once = PTHREAD_ONCE_INIT;
+static pthread_key_t g_stats_key;
+static tk_stats_block_t *g_stats_blocks; // Live threads' blocks
+static tk_stats_t g_stats_retired;       // Totals of exited threads
+
+static TK_THREAD_LOCAL tk_stats_block_t *t_stats_block;
+
+// --- Registry ---
+
+/**
+ * @brief Adds every counter of `from` to `into`.
+ */
+static void tk_stats_accumulate(tk_stats_counters_t *into,
+                                const tk_stats_counters_t *from) {
+  into->allocs += TK_ATOMIC_LOAD(&from->allocs, TK_ATOMIC_RELAXED);
+  into->frees += TK_ATOMIC_LOAD(&from->frees, TK_ATOMIC_RELAXED);
+  into->reallocs += TK_ATOMIC_LOAD(&from->reallocs, TK_ATOMIC_RELAXED);
+  into->realloc_moves +=
+      TK_ATOMIC_LOAD(&from->realloc_moves, TK_ATOMIC_RELAXED);
+  into->element_copies +=
+      TK_ATOMIC_LOAD(&from->element_copies, TK_ATOMIC_RELAXED);
+  into->bytes_live += TK_ATOMIC_LOAD(&from->bytes_live, TK_ATOMIC_RELAXED);
+  into->peak_bytes += TK_ATOMIC_LOAD(&from->peak_bytes, TK_ATOMIC_RELAXED);
+}
+
+/**
+ * @brief Key destructor: retires an exiting thread's block.
+ */
+static void tk_stats_retire(void *arg) {
+  tk_stats_block_t *block = (tk_stats_block_t *)arg;
+  pthread_mutex_lock(&g_stats_lock);
+  for (int kind = 0; kind < TK_STATS_KIND_COUNT; ++kind)
+    tk_stats_accumulate(&g_stats_retired.kinds[kind], &block->kinds[kind]);
+  if (block->prev)
+    block->prev->next = block->next;
+  else
+    g_stats_blocks = block->next;
+  if (block->next)
+    block->next->prev = block->prev;
+  pthread_mutex_unlock(&g_stats_lock);
+  // A later destructor that allocates registers a fresh block.
+  t_stats_block = NULL;
+  free(block);
+}
+
+static void tk_stats_init_key(void) {
+  (void)pthread_key_create(&g_stats_key, tk_stats_retire);
+}
+
+/**
+ * @brief Returns the calling thread's block, registering it on first use.
+ * @return The block, or NULL if it could not be allocated (the event is
+ * then not counted).
+ */
+static tk_stats_block_t *tk_stats_block(void) {
+  tk_stats_block_t *block = t_stats_block;
+  if (block)
+    return block;
+
+  pthread_once(&g_stats_once, tk_stats_init_key);
+  block = (tk_stats_block_t *)calloc(1, sizeof(tk_stats_block_t));
+  if (!block)
+    return NULL;
+  pthread_mutex_lock(&g_stats_lock);
+  block->next = g_stats_blocks;
+  if (g_stats_blocks)
+    g_stats_blocks->prev = block;
+  g_stats_blocks = block;
+  pthread_mutex_unlock(&g_stats_lock);
+  (void)pthread_setspecific(g_stats_key, block);
+  t_stats_block = block;
+  return block;
+}
+
+// --- Recording ---
+
+// Owner-only update of one counter: no read-modify-write is needed.
+#define TK_STATS_BUMP(field, delta)                                            \
+  TK_ATOMIC_STORE(&(field), TK_ATOMIC_LOAD(&(field), TK_ATOMIC_RELAXED) +      \
+                                (delta),                                       \
+                  TK_ATOMIC_RELAXED)
+
+/**
+ * @brief Returns the calling thread's counters for `kind`, or NULL.
+ */
+static tk_stats_counters_t *tk_stats_counters(tk_stats_kind_t kind) {
+  TK_ASSERT((int)kind >= 0 && kind < TK_STATS_KIND_COUNT);
+  tk_stats_block_t *block = tk_stats_block();
+  return block ? &block->kinds[kind] : NULL;
+}
+
+/**
+ * @brief Adds `delta` to the live bytes and raises the peak if needed.
+ */
+static void tk_stats_add_live(tk_stats_counters_t *c, int64_t delta) {
+  int64_t live = TK_ATOMIC_LOAD(&c->bytes_live, TK_ATOMIC_RELAXED) + delta;
+  TK_ATOMIC_STORE(&c->bytes_live, live, TK_ATOMIC_RELAXED);
+  if (live > TK_ATOMIC_LOAD(&c->peak_bytes, TK_ATOMIC_RELAXED))
+    TK_ATOMIC_STORE(&c->peak_bytes, live, TK_ATOMIC_RELAXED);
+}
+
+void tk_stats_record_alloc(tk_stats_kind_t kind, size_t bytes) {
+  tk_stats_counters_t *c = tk_stats_counters(kind);
+  if (!c)
+    return;
+  TK_STATS_BUMP(c->allocs, 1);
+  tk_stats_add_live(c, (int64_t)bytes);
+}
+
+void tk_stats_record_free(tk_stats_kind_t kind, size_t count, size_t bytes) {
+  tk_stats_counters_t *c = tk_stats_counters(kind);
+  if (!c)
+    return;
+  TK_STATS_BUMP(c->frees, (uint64_t)count);
+  tk_stats_add_live(c, -(int64_t)bytes);
+}
+
+void tk_stats_record_realloc(tk_stats_kind_t kind, size_t old_bytes,
+                             size_t new_bytes, tk_bool moved) {
+  tk_stats_counters_t *c = tk_stats_counters(kind);
+  if (!c)
+    return;
+  TK_STATS_BUMP(c->reallocs, 1);
+  if (moved)
+    TK_STATS_BUMP(c->realloc_moves, 1);
+  tk_stats_add_live(c, (int64_t)new_bytes - (int64_t)old_bytes);
+}
+
+void tk_stats_record_copies(tk_stats_kind_t kind, size_t count) {
+  tk_stats_counters_t *c = tk_stats_counters(kind);
+  if (c)
+    TK_STATS_BUMP(c->element_copies, (uint64_t)count);
+}
+
+#endif // TK_ENABLE_STATS
+
+// --- Reading Statistics ---
+
+tk_bool tk_stats_enabled(void) {
+#if defined(TK_ENABLE_STATS)
+  return true;
+#else
+  return false;
+#endif
+}
+
+void tk_stats_snapshot(tk_stats_t *out) {
+  TK_ASSERT(out != NULL);
+  if (!out)
+    return;
+  memset(out, 0, sizeof(*out));
+#if defined(TK_ENABLE_STATS)
+  pthread_mutex_lock(&g_stats_lock);
+  *out = g_stats_retired;
+  for (tk_stats_block_t *block = g_stats_blocks; block; block = block->next)
+    for (int kind = 0; kind < TK_STATS_KIND_COUNT; ++kind)
+      tk_stats_accumulate(&out->kinds[kind], &block->kinds[kind]);
+  pthread_mutex_unlock(&g_stats_lock);
+#endif
+}
+
+const char *tk_stats_kind_name(tk_stats_kind_t kind) {
+  switch (kind) {
+  case TK_STATS_VEC:
+    return "vec";
+  case TK_STATS_LIST:
+    return "list";
+  case TK_STATS_DEQUE:
+    return "deque";
+  case TK_STATS_HASHMAP:
+    return "hashmap";
+  case TK_STATS_RING:
+    return "ring";
+  default:
+    return "unknown";
+  }
+}
@@ -0,0 +1,462 @@
+/**
+ * @file deque.c
+ * @brief Implements the toolkit's segmented deque.
+ *
+ * @details
+ * Elements live in blocks of 2^block_shift elements (about
+ * TK_DEQUE_BLOCK_BYTES each, and never fewer than TK_DEQUE_MIN_BLOCK
+ * elements). The block map is an array of block pointers; the elements
+ * occupy a run of "global" positions [start, start + size), where global
+ * position g is slot (g & block_mask) of block map[g >> block_shift]. Only
+ * the blocks covering that run are allocated.
+ *
+ * Pushing past either end of the map rebuilds the map with the used block
+ * pointers re-centred (in place if the map is at most half full, into a
+ * map twice the needed size otherwise). Only pointers move; the blocks, and
+ * therefore the elements, stay where they are.
+ *
+ * A block that becomes empty is kept as a single spare, so a push/pop
+ * sequence oscillating across a block boundary does not allocate on every
+ * step.
+ */
+
+#include <string.h>
+#include <tk/core/allocator.h>
+#include <tk/core/iterator.h>
+#include <tk/core/macros.h>
+#include <tk/core/stats.h>
+#include <tk/ds/deque.h>
+
+/**
+ * @brief Target size of one block, in bytes.
+ */
+#ifndef TK_DEQUE_BLOCK_BYTES
+#define TK_DEQUE_BLOCK_BYTES 4096
+#endif
+
+/**
+ * @brief The smallest number of elements per block (a power of two).
+ */
+#ifndef TK_DEQUE_MIN_BLOCK
+#define TK_DEQUE_MIN_BLOCK 16
+#endif
+
+/**
+ * @brief The smallest block map allocated.
+ */
+#define TK_DEQUE_MIN_MAP 8
+
+/**
+ * @struct tk_deque_t
+ * @brief The opaque struct for the deque.
+ */
+struct tk_deque_t {
+  char **map;               // Block pointers, valid for the used range only
+  size_t map_capacity;      // Number of entries in 'map'
+  size_t start;             // Global position of the first element
+  size_t size;              // Number of elements
+  size_t element_size;      // Size of one element
+  size_t block_shift;       // log2(elements per block)
+  size_t block_mask;        // Elements per block - 1
+  char *spare;              // One cached empty block, or NULL
+  tk_allocator_t allocator; // Source of every allocation
+};
+
+/**
+ * @brief State of a deque iterator. 'ptr' and 'block_end' cache the
+ * location of 'index' so that stepping within a block is a pointer bump.
+ */
+typedef struct {
+  tk_deque_t *deque;
+  size_t index;    // Position from the front (size for end)
+  char *ptr;       // Address of the element, or NULL past the end
+  char *block_end; // End of the block holding 'ptr'
+} tk_deque_iter_state_t;
+
+// --- Helper Functions ---
+
+static inline size_t tk_deque_block_bytes(const tk_deque_t *deque) {
+  return deque->element_size << deque->block_shift;
+}
+
+static inline char *tk_deque_slot(const tk_deque_t *deque, size_t g) {
+  return deque->map[g >> deque->block_shift] +
+         (g & deque->block_mask) * deque->element_size;
+}
+
+static char *tk_deque_acquire_block(tk_deque_t *deque) {
+  char *block = deque->spare;
+  if (block) {
+    deque->spare = NULL;
+    return block;
+  }
+  return (char *)tk_stats_alloc(TK_STATS_DEQUE, &deque->allocator,
+                                tk_deque_block_bytes(deque));
+}
+
+static void tk_deque_release_block(tk_deque_t *deque, char *block) {
+  if (!deque->spare)
+    deque->spare = block;
+  else
+    tk_stats_free(TK_STATS_DEQUE, &deque->allocator, block,
+                  tk_deque_block_bytes(deque));
+}
+
+/**
+ * @brief Rebuilds the block map with room for one more block at the front
+ * (at_front) or at the back, re-centring the used block pointers.
+ * @return TK_SUCCESS, or TK_E_NOMEM (the deque is unchanged).
+ */
+static tk_error_t tk_deque_grow_map(tk_deque_t *deque, tk_bool at_front) {
+  size_t first = deque->start >> deque->block_shift;
+  size_t blocks =
+      deque->size
+          ? ((deque->start + deque->size - 1) >> deque->block_shift) - first + 1
+          : 0;
+  size_t needed = blocks + 1;
+
+  char **map = deque->map;
+  size_t capacity = deque->map_capacity;
+  if (needed * 2 > capacity) {
+    capacity = needed * 2 < TK_DEQUE_MIN_MAP ? TK_DEQUE_MIN_MAP : needed * 2;
+    if (capacity > SIZE_MAX / sizeof(char *) ||
+        capacity > (SIZE_MAX >> deque->block_shift))
+      return TK_E_NOMEM;
+    map = (char **)tk_stats_alloc(TK_STATS_DEQUE, &deque->allocator,
+                                  capacity * sizeof(char *));
+    if (!map)
+      return TK_E_NOMEM;
+  }
+
+  // Leave the free map entries split evenly between both ends, the new
+  // block's own entry included on its side.
+  size_t new_first = (capacity - needed) / 2 + (at_front ? 1 : 0);
+  if (blocks > 0)
+    memmove(map + new_first, deque->map + first, blocks * sizeof(char *));
+  if (map != deque->map && deque->map)
+    tk_stats_free(TK_STATS_DEQUE, &deque->allocator, deque->map,
+                  deque->map_capacity * sizeof(char *));
+
+  deque->map = map;
+  deque->map_capacity = capacity;
+  deque->start = (new_first << deque->block_shift) |
+                 (deque->size ? deque->start & deque->block_mask : 0);
+  return TK_SUCCESS;
+}
+
+/**
+ * @brief Frees every block and empties the deque.
+ */
+static void tk_deque_release_all(tk_deque_t *deque) {
+  if (deque->size > 0) {
+    size_t first = deque->start >> deque->block_shift;
+    size_t last = (deque->start + deque->size - 1) >> deque->block_shift;
+    for (size_t b = first; b <= last; ++b)
+      tk_deque_release_block(deque, deque->map[b]);
+  }
+  deque->size = 0;
+  deque->start = (deque->map_capacity / 2) << deque->block_shift;
+}
+
+// --- Lifecycle Functions ---
+
+tk_deque_t *tk_deque_create(size_t element_size) {
+  return tk_deque_create_with_allocator(element_size, tk_allocator_default());
+}
+
+tk_deque_t *tk_deque_create_with_allocator(size_t element_size,
+                                           const tk_allocator_t *allocator) {
+  TK_ASSERT(element_size > 0);
+  tk_allocator_validate(allocator);
+  if (element_size == 0 || !allocator)
+    return NULL;
+
+  size_t shift = 0;
+  while (((size_t)2 << shift) * element_size <= TK_DEQUE_BLOCK_BYTES)
+    ++shift;
+  while (((size_t)1 << shift) < TK_DEQUE_MIN_BLOCK)
+    ++shift;
+  if (element_size > (SIZE_MAX >> shift))
+    return NULL;
+
+  tk_deque_t *deque =
+      (tk_deque_t *)tk_stats_alloc(TK_STATS_DEQUE, allocator,
+                                   sizeof(tk_deque_t));
+  if (!deque)
+    return NULL;
+
+  deque->map = NULL;
+  deque->map_capacity = 0;
+  deque->start = 0;
+  deque->size = 0;
+  deque->element_size = element_size;
+  deque->block_shift = shift;
+  deque->block_mask = ((size_t)1 << shift) - 1;
+  deque->spare = NULL;
+  deque->allocator = *allocator;
+  return deque;
+}
+
+void tk_deque_destroy(tk_deque_t *deque) { tk_deque_destroy_full(deque, NULL); }
+
+void tk_deque_destroy_full(tk_deque_t *deque,
+                           tk_element_destroyer_t destroyer) {
+  if (!deque)
+    return;
+  if (destroyer) {
+    for (size_t i = 0; i < deque->size; ++i)
+      destroyer(tk_deque_slot(deque, deque->start + i));
+  }
+
+  tk_deque_release_all(deque);
+  tk_allocator_t allocator = deque->allocator;
+  if (deque->spare)
+    tk_stats_free(TK_STATS_DEQUE, &allocator, deque->spare,
+                  tk_deque_block_bytes(deque));
+  if (deque->map)
+    tk_stats_free(TK_STATS_DEQUE, &allocator, deque->map,
+                  deque->map_capacity * sizeof(char *));
+  tk_stats_free(TK_STATS_DEQUE, &allocator, deque, sizeof(tk_deque_t));
+}
+
+// --- Capacity Functions ---
+
+size_t tk_deque_size(const tk_deque_t *deque) {
+  TK_ASSERT(deque);
+  return deque->size;
+}
+
+tk_bool tk_deque_is_empty(const tk_deque_t *deque) {
+  TK_ASSERT(deque);
+  return deque->size == 0;
+}
+
+// --- Element Access ---
+
+void *tk_deque_at(const tk_deque_t *deque, size_t index) {
+  TK_ASSERT(deque);
+  if (index >= deque->size)
+    return NULL;
+  return tk_deque_slot(deque, deque->start + index);
+}
+
+void *tk_deque_front(const tk_deque_t *deque) { return tk_deque_at(deque, 0); }
+
+void *tk_deque_back(const tk_deque_t *deque) {
+  TK_ASSERT(deque);
+  return deque->size ? tk_deque_at(deque, deque->size - 1) : NULL;
+}
+
+// --- Modifiers ---
+
+tk_error_t tk_deque_push_back(tk_deque_t *deque, const void *element) {
+  TK_ASSERT(deque && element);
+  size_t g = deque->start + deque->size;
+  if ((g >> deque->block_shift) >= deque->map_capacity) {
+    if (tk_deque_grow_map(deque, false) != TK_SUCCESS)
+      return TK_E_NOMEM;
+    g = deque->start + deque->size;
+  }
+
+  if (deque->size == 0 || (g & deque->block_mask) == 0) {
+    char *block = tk_deque_acquire_block(deque);
+    if (!block)
+      return TK_E_NOMEM;
+    deque->map[g >> deque->block_shift] = block;
+  }
+  memcpy(tk_deque_slot(deque, g), element, deque->element_size);
+  TK_STATS_COPY(TK_STATS_DEQUE, 1);
+  ++deque->size;
+  return TK_SUCCESS;
+}
+
+tk_error_t tk_deque_push_front(tk_deque_t *deque, const void *element) {
+  TK_ASSERT(deque && element);
+  if (deque->start == 0) {
+    if (tk_deque_grow_map(deque, true) != TK_SUCCESS)
+      return TK_E_NOMEM;
+  }
+
+  size_t g = deque->start - 1;
+  if (deque->size == 0 || (deque->start & deque->block_mask) == 0) {
+    char *block = tk_deque_acquire_block(deque);
+    if (!block)
+      return TK_E_NOMEM;
+    deque->map[g >> deque->block_shift] = block;
+  }
+  memcpy(tk_deque_slot(deque, g), element, deque->element_size);
+  TK_STATS_COPY(TK_STATS_DEQUE, 1);
+  deque->start = g;
+  ++deque->size;
+  return TK_SUCCESS;
+}
+
+void tk_deque_pop_back(tk_deque_t *deque) {
+  TK_ASSERT(deque);
+  if (deque->size == 0)
+    return;
+  if (deque->size == 1) {
+    tk_deque_release_all(deque);
+    return;
+  }
+  size_t g = deque->start + --deque->size;
+  if ((g & deque->block_mask) == 0)
+    tk_deque_release_block(deque, deque->map[g >> deque->block_shift]);
+}
+
+void tk_deque_pop_front(tk_deque_t *deque) {
+  TK_ASSERT(deque);
+  if (deque->size == 0)
+    return;
+  if (deque->size == 1) {
+    tk_deque_release_all(deque);
+    return;
+  }
+  size_t g = deque->start++;
+  --deque->size;
+  if ((deque->start & deque->block_mask) == 0)
+    tk_deque_release_block(deque, deque->map[g >> deque->block_shift]);
+}
+
+void tk_deque_clear(tk_deque_t *deque) {
+  TK_ASSERT(deque);
+  tk_deque_release_all(deque);
+}
+
+// --- Iterator Implementation ---
+
+/**
+ * @brief Recomputes the cached location of 'state->index'.
+ */
+static void tk_deque_iter_locate(tk_deque_iter_state_t *state) {
+  const tk_deque_t *deque = state->deque;
+  if (state->index >= deque->size) {
+    state->ptr = NULL;
+    state->block_end = NULL;
+    return;
+  }
+  size_t g = deque->start + state->index;
+  char *block = deque->map[g >> deque->block_shift];
+  state->ptr = block + (g & deque->block_mask) * deque->element_size;
+  state->block_end = block + tk_deque_block_bytes(deque);
+}
+
+static void tk_deque_iter_advance(tk_iterator_t *self) {
+  tk_deque_iter_state_t *state = (tk_deque_iter_state_t *)self->state.data;
+  TK_ASSERT(state->index < state->deque->size);
+  ++state->index;
+  state->ptr += state->deque->element_size;
+  if (state->ptr == state->block_end || state->index == state->deque->size)
+    tk_deque_iter_locate(state);
+}
+
+static void tk_deque_iter_retreat(tk_iterator_t *self) {
+  tk_deque_iter_state_t *state = (tk_deque_iter_state_t *)self->state.data;
+  TK_ASSERT(state->index > 0);
+  --state->index;
+  tk_deque_iter_locate(state);
+}
+
+static void tk_deque_iter_seek(tk_iterator_t *self, ptrdiff_t n) {
+  tk_deque_iter_state_t *state = (tk_deque_iter_state_t *)self->state.data;
+  state->index += (size_t)n;
+  TK_ASSERT(state->index <= state->deque->size);
+  tk_deque_iter_locate(state);
+}
+
+static ptrdiff_t tk_deque_iter_distance(const tk_iterator_t *from,
+                                        const tk_iterator_t *to) {
+  const tk_deque_iter_state_t *state1 =
+      (const tk_deque_iter_state_t *)from->state.data;
+  const tk_deque_iter_state_t *state2 =
+      (const tk_deque_iter_state_t *)to->state.data;
+  TK_ASSERT(state1->deque == state2->deque);
+  return (ptrdiff_t)(state2->index - state1->index);
+}
+
+static void *tk_deque_iter_at_offset(const tk_iterator_t *self,
+                                     ptrdiff_t n) {
+  const tk_deque_iter_state_t *state =
+      (const tk_deque_iter_state_t *)self->state.data;
+  size_t index = state->index + (size_t)n;
+  TK_ASSERT(index < state->deque->size &&
+            "tk_deque: iterator offset out of range.");
+  return tk_deque_slot(state->deque, state->deque->start + index);
+}
+
+static size_t tk_deque_iter_next_block(tk_iterator_t *self,
+                                       const tk_iterator_t *end, void **ptrs,
+                                       size_t max) {
+  tk_deque_iter_state_t *state = (tk_deque_iter_state_t *)self->state.data;
+  size_t last = ((const tk_deque_iter_state_t *)end->state.data)->index;
+  size_t n = 0;
+  while (n < max && state->index < last) {
+    // Bump through the current block, then relocate once per block.
+    size_t in_block =
+        (size_t)(state->block_end - state->ptr) / state->deque->element_size;
+    size_t take = last - state->index;
+    if (take > in_block)
+      take = in_block;
+    if (take > max - n)
+      take = max - n;
+    for (size_t i = 0; i < take; ++i, state->ptr += state->deque->element_size)
+      ptrs[n++] = state->ptr;
+    state->index += take;
+    if (state->ptr == state->block_end || state->index == state->deque->size)
+      tk_deque_iter_locate(state);
+  }
+  return n;
+}
+
+static void *tk_deque_iter_get(const tk_iterator_t *self) {
+  const tk_deque_iter_state_t *state =
+      (const tk_deque_iter_state_t *)self->state.data;
+  TK_ASSERT(state->ptr != NULL && "tk_deque: dereferencing the end iterator.");
+  return state->ptr;
+}
+
+static tk_bool tk_deque_iter_equal(const tk_iterator_t *iter1,
+                                   const tk_iterator_t *iter2) {
+  const tk_deque_iter_state_t *state1 =
+      (const tk_deque_iter_state_t *)iter1->state.data;
+  const tk_deque_iter_state_t *state2 =
+      (const tk_deque_iter_state_t *)iter2->state.data;
+  return state1->deque == state2->deque && state1->index == state2->index;
+}
+
+static void tk_deque_iter_clone(tk_iterator_t *dest,
+                                const tk_iterator_t *src) {
+  *dest = *src;
+}
+
+/**
+ * @brief The single, static vtable for all tk_deque_t iterators.
+ *
+ * Random access, but not built with TK_DEFINE_CONTIGUOUS_ITERATOR_VTABLE:
+ * the storage is contiguous only within a block, so there is no contiguous
+ * function.
+ */
+static const tk_iterator_vtable_t g_deque_vtable =
+    TK_DEFINE_BLOCK_RANDOM_ACCESS_ITERATOR_VTABLE(tk_deque_iter,
+                                                  "tk_deque_iterator");
+
+static tk_iterator_t tk_deque_iter_make(tk_deque_t *deque, size_t index) {
+  tk_iterator_t iter;
+  iter.vtable = &g_deque_vtable;
+  tk_deque_iter_state_t *state = (tk_deque_iter_state_t *)iter.state.data;
+  state->deque = deque;
+  state->index = index;
+  tk_deque_iter_locate(state);
+  return iter;
+}
+
+tk_iterator_t tk_deque_begin(tk_deque_t *deque) {
+  TK_ASSERT(deque);
+  tk_iterator_vtable_validate(&g_deque_vtable);
+  return tk_deque_iter_make(deque, 0);
+}
+
+tk_iterator_t tk_deque_end(tk_deque_t *deque) {
+  TK_ASSERT(deque);
+  return tk_deque_iter_make(deque, deque->size);
+}
@@ -0,0 +1,623 @@
+/**
+ * @file hashmap.c
+ * @brief Implements the toolkit's Swiss-table style hash map.
+ *
+ * @details
+ * The table is one allocation: `capacity` control bytes followed by
+ * `capacity` slots of `slot_size` bytes (key, padding, value, padding).
+ * The capacity is a power of two and a multiple of the group width (16), so
+ * groups are aligned and the probe sequence simply visits whole groups in
+ * triangular order, which reaches every group.
+ *
+ * A control byte is EMPTY (0x80), DELETED (0xFE), or the low 7 bits of the
+ * mixed hash (high bit clear) for a full slot. The remaining hash bits pick
+ * the first group. A lookup stops at the first group that contains an EMPTY
+ * byte. An erased slot only becomes EMPTY again if its group already has an
+ * EMPTY byte (so no probe sequence can have passed through that group);
+ * otherwise it becomes a DELETED tombstone.
+ *
+ * At most 7/8 of the slots (full + tombstones) are used. When that budget
+ * ('growth_left') is exhausted, the table is rebuilt: at the same capacity if
+ * tombstones make up most of the load, doubled otherwise.
+ */
+
+#include <string.h>
+#include <tk/core/allocator.h>
+#include <tk/core/iterator.h>
+#include <tk/core/macros.h>
+#include <tk/core/stats.h>
+#include <tk/ds/hashmap.h>
+
+#if defined(__SSE2__) || defined(_M_X64) ||                                    \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TK_HASHMAP_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define TK_HASHMAP_NEON
+#include <arm_neon.h>
+#endif
+
+/**
+ * @brief Number of control bytes examined per probe step.
+ */
+#define TK_HASHMAP_GROUP_WIDTH 16
+
+/**
+ * @brief Alignment of the value within a slot and of the slot stride.
+ */
+#define TK_HASHMAP_ALIGNMENT 8
+
+/**
+ * @brief Control byte values (a full slot stores 7 hash bits, 0..127).
+ */
+#define TK_CTRL_EMPTY ((tk_ctrl_t)-128)
+#define TK_CTRL_DELETED ((tk_ctrl_t)-2)
+
+/**
+ * @brief Slot index returned when a lookup fails.
+ */
+#define TK_HASHMAP_NPOS ((size_t)-1)
+
+/**
+ * @brief Rounds 'n' up to a multiple of TK_HASHMAP_ALIGNMENT.
+ */
+#define TK_HASHMAP_ALIGN(n)                                                    \
+  (((n) + TK_HASHMAP_ALIGNMENT - 1) & ~(size_t)(TK_HASHMAP_ALIGNMENT - 1))
+
+typedef int8_t tk_ctrl_t;
+
+/**
+ * @struct tk_hashmap_t
+ * @brief The opaque struct for the hash map.
+ */
+struct tk_hashmap_t {
+  tk_ctrl_t *ctrl;          // 'capacity' control bytes, then the slots
+  char *slots;              // Slot array, right after the control bytes
+  size_t capacity;          // Number of slots (power of two >= 16), or 0
+  size_t size;              // Number of full slots
+  size_t growth_left;       // Slots that may still leave EMPTY before rehash
+  size_t key_size;          // Size of one key
+  size_t value_size;        // Size of one value (may be 0)
+  size_t value_offset;      // Offset of the value within a slot
+  size_t slot_size;         // Stride between two slots
+  tk_hash_fn_t hash;        // Key hash function
+  tk_key_equal_fn_t equal;  // Key equality function
+  tk_allocator_t allocator; // Source of the table and of this handle
+};
+
+// --- Group Matching ---
+// A group mask has one "hit" per matching control byte; successive hits are
+// consumed with tk_group_mask_next. SSE2 and the portable path use one bit
+// per byte, NEON uses one bit per 4-bit nibble.
+
+#if defined(TK_HASHMAP_SSE2)
+
+typedef uint32_t tk_group_mask_t;
+#define TK_GROUP_MASK_SHIFT 0
+
+static tk_group_mask_t tk_group_match(const tk_ctrl_t *group, tk_ctrl_t h2) {
+  __m128i ctrl = _mm_loadu_si128((const __m128i *)group);
+  return (tk_group_mask_t)_mm_movemask_epi8(
+      _mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl));
+}
+
+static tk_group_mask_t tk_group_match_empty(const tk_ctrl_t *group) {
+  return tk_group_match(group, TK_CTRL_EMPTY);
+}
+
+static tk_group_mask_t tk_group_match_empty_or_deleted(const tk_ctrl_t *group) {
+  // Both special values have the high bit set; full slots do not.
+  __m128i ctrl = _mm_loadu_si128((const __m128i *)group);
+  return (tk_group_mask_t)_mm_movemask_epi8(ctrl);
+}
+
+#elif defined(TK_HASHMAP_NEON)
+
+typedef uint64_t tk_group_mask_t;
+#define TK_GROUP_MASK_SHIFT 2
+
+static tk_group_mask_t tk_group_neon_mask(uint8x16_t eq) {
+  // Narrow each 0x00/0xFF byte to a nibble, keep one bit per nibble.
+  uint8x8_t nibbles = vshrn_n_u16(vreinterpretq_u16_u8(eq), 4);
+  return vget_lane_u64(vreinterpret_u64_u8(nibbles), 0) &
+         0x8888888888888888ull;
+}
+
+static tk_group_mask_t tk_group_match(const tk_ctrl_t *group, tk_ctrl_t h2) {
+  int8x16_t ctrl = vld1q_s8(group);
+  return tk_group_neon_mask(vceqq_s8(ctrl, vdupq_n_s8(h2)));
+}
+
+static tk_group_mask_t tk_group_match_empty(const tk_ctrl_t *group) {
+  return tk_group_match(group, TK_CTRL_EMPTY);
+}
+
+static tk_group_mask_t tk_group_match_empty_or_deleted(const tk_ctrl_t *group) {
+  int8x16_t ctrl = vld1q_s8(group);
+  return tk_group_neon_mask(vcltq_s8(ctrl, vdupq_n_s8(0)));
+}
+
+#else
+
+typedef uint32_t tk_group_mask_t;
+#define TK_GROUP_MASK_SHIFT 0
+
+static tk_group_mask_t tk_group_match(const tk_ctrl_t *group, tk_ctrl_t h2) {
+  tk_group_mask_t mask = 0;
+  for (unsigned i = 0; i < TK_HASHMAP_GROUP_WIDTH; ++i)
+    mask |= (tk_group_mask_t)(group[i] == h2) << i;
+  return mask;
+}
+
+static tk_group_mask_t tk_group_match_empty(const tk_ctrl_t *group) {
+  return tk_group_match(group, TK_CTRL_EMPTY);
+}
+
+static tk_group_mask_t tk_group_match_empty_or_deleted(const tk_ctrl_t *group) {
+  tk_group_mask_t mask = 0;
+  for (unsigned i = 0; i < TK_HASHMAP_GROUP_WIDTH; ++i)
+    mask |= (tk_group_mask_t)(group[i] < 0) << i;
+  return mask;
+}
+
+#endif
+
+/**
+ * @brief Returns the byte index of the lowest hit and clears it.
+ */
+static size_t tk_group_mask_next(tk_group_mask_t *mask) {
+  size_t index = TK_CTZ64(*mask) >> TK_GROUP_MASK_SHIFT;
+  *mask &= *mask - 1;
+  return index;
+}
+
+// --- Helper Functions ---
+
+/**
+ * @brief Mixes a user hash so both the group index and the 7 control bits
+ * depend on every input bit (a 64-bit murmur3 finalizer).
+ */
+static uint64_t tk_hashmap_mix(size_t hash) {
+  uint64_t x = (uint64_t)hash;
+  x ^= x >> 33;
+  x *= 0xff51afd7ed558ccdull;
+  x ^= x >> 33;
+  x *= 0xc4ceb9fe1a85ec53ull;
+  x ^= x >> 33;
+  return x;
+}
+
+static uint64_t tk_hashmap_hash_key(const tk_hashmap_t *map, const void *key) {
+  return tk_hashmap_mix(map->hash(key, map->key_size));
+}
+
+static tk_ctrl_t tk_hashmap_h2(uint64_t hash) {
+  return (tk_ctrl_t)(hash & 0x7F);
+}
+
+static size_t tk_hashmap_h1(uint64_t hash) { return (size_t)(hash >> 7); }
+
+static char *tk_hashmap_slot(const tk_hashmap_t *map, size_t index) {
+  return map->slots + index * map->slot_size;
+}
+
+/**
+ * @brief Returns how many slots may be filled before the table must grow.
+ */
+static size_t tk_hashmap_max_load(size_t capacity) {
+  return capacity - capacity / 8;
+}
+
+/**
+ * @brief Returns the byte size of a table of 'capacity' slots, or 0 on
+ * overflow.
+ */
+static size_t tk_hashmap_table_bytes(const tk_hashmap_t *map,
+                                     size_t capacity) {
+  if (capacity > (SIZE_MAX - capacity) / map->slot_size)
+    return 0;
+  return capacity + capacity * map->slot_size;
+}
+
+/**
+ * @brief Finds the first EMPTY or DELETED slot on the probe sequence of
+ * 'hash'. The table must have at least one such slot.
+ */
+static size_t tk_hashmap_find_free(const tk_ctrl_t *ctrl, size_t capacity,
+                                   uint64_t hash) {
+  size_t group_mask = capacity / TK_HASHMAP_GROUP_WIDTH - 1;
+  size_t group = tk_hashmap_h1(hash) & group_mask;
+
+  for (size_t step = 1;; ++step) {
+    const tk_ctrl_t *base = ctrl + group * TK_HASHMAP_GROUP_WIDTH;
+    tk_group_mask_t free_mask = tk_group_match_empty_or_deleted(base);
+    if (free_mask)
+      return group * TK_HASHMAP_GROUP_WIDTH + tk_group_mask_next(&free_mask);
+    group = (group + step) & group_mask;
+  }
+}
+
+/**
+ * @brief Finds the slot holding 'key'.
+ * @return The slot index, or TK_HASHMAP_NPOS if the key is absent.
+ */
+static size_t tk_hashmap_find(const tk_hashmap_t *map, const void *key,
+                              uint64_t hash) {
+  if (map->capacity == 0)
+    return TK_HASHMAP_NPOS;
+
+  size_t group_mask = map->capacity / TK_HASHMAP_GROUP_WIDTH - 1;
+  size_t group = tk_hashmap_h1(hash) & group_mask;
+  tk_ctrl_t h2 = tk_hashmap_h2(hash);
+
+  for (size_t step = 1;; ++step) {
+    const tk_ctrl_t *base = map->ctrl + group * TK_HASHMAP_GROUP_WIDTH;
+    tk_group_mask_t match = tk_group_match(base, h2);
+    while (match) {
+      size_t index =
+          group * TK_HASHMAP_GROUP_WIDTH + tk_group_mask_next(&match);
+      if (map->equal(tk_hashmap_slot(map, index), key, map->key_size))
+        return index;
+    }
+    if (tk_group_match_empty(base))
+      return TK_HASHMAP_NPOS;
+    group = (group + step) & group_mask;
+  }
+}
+
+/**
+ * @brief Rebuilds the table with 'capacity' slots, dropping tombstones.
+ * @return TK_SUCCESS, or TK_E_NOMEM (the map is left unchanged).
+ */
+static tk_error_t tk_hashmap_rehash(tk_hashmap_t *map, size_t capacity) {
+  TK_ASSERT(capacity >= TK_HASHMAP_GROUP_WIDTH);
+  TK_ASSERT((capacity & (capacity - 1)) == 0);
+  TK_ASSERT(tk_hashmap_max_load(capacity) >= map->size);
+
+  size_t bytes = tk_hashmap_table_bytes(map, capacity);
+  if (bytes == 0)
+    return TK_E_NOMEM;
+  tk_ctrl_t *ctrl = (tk_ctrl_t *)tk_stats_alloc(TK_STATS_HASHMAP,
+                                                &map->allocator, bytes);
+  if (!ctrl)
+    return TK_E_NOMEM;
+  char *slots = (char *)ctrl + capacity;
+  memset(ctrl, (unsigned char)TK_CTRL_EMPTY, capacity);
+
+  for (size_t i = 0; i < map->capacity; ++i) {
+    if (map->ctrl[i] < 0)
+      continue;
+    char *slot = tk_hashmap_slot(map, i);
+    uint64_t hash = tk_hashmap_hash_key(map, slot);
+    size_t index = tk_hashmap_find_free(ctrl, capacity, hash);
+    ctrl[index] = tk_hashmap_h2(hash);
+    memcpy(slots + index * map->slot_size, slot, map->slot_size);
+  }
+  TK_STATS_COPY(TK_STATS_HASHMAP, map->size);
+
+  if (map->ctrl)
+    tk_stats_free(TK_STATS_HASHMAP, &map->allocator, map->ctrl,
+                  tk_hashmap_table_bytes(map, map->capacity));
+  map->ctrl = ctrl;
+  map->slots = slots;
+  map->capacity = capacity;
+  map->growth_left = tk_hashmap_max_load(capacity) - map->size;
+  return TK_SUCCESS;
+}
+
+/**
+ * @brief Makes room for one more entry once 'growth_left' is exhausted.
+ * @return TK_SUCCESS, or TK_E_NOMEM.
+ */
+static tk_error_t tk_hashmap_grow(tk_hashmap_t *map) {
+  size_t capacity = map->capacity;
+  if (capacity == 0) {
+    capacity = TK_HASHMAP_GROUP_WIDTH;
+  } else if (map->size > tk_hashmap_max_load(capacity) / 2) {
+    // Mostly live entries: double. Otherwise just sweep the tombstones.
+    if (capacity > SIZE_MAX / 2)
+      return TK_E_NOMEM;
+    capacity *= 2;
+  }
+  return tk_hashmap_rehash(map, capacity);
+}
+
+// --- Default Hashing ---
+
+size_t tk_hash_bytes(const void *key, size_t key_size) {
+  const unsigned char *bytes = (const unsigned char *)key;
+  uint64_t hash = 0xcbf29ce484222325ull;
+  for (size_t i = 0; i < key_size; ++i) {
+    hash ^= bytes[i];
+    hash *= 0x100000001b3ull;
+  }
+  return (size_t)hash;
+}
+
+tk_bool tk_key_equal_bytes(const void *key1, const void *key2,
+                           size_t key_size) {
+  return memcmp(key1, key2, key_size) == 0;
+}
+
+// --- Lifecycle Functions ---
+
+tk_hashmap_t *tk_hashmap_create(size_t key_size, size_t value_size,
+                                tk_hash_fn_t hash, tk_key_equal_fn_t equal) {
+  return tk_hashmap_create_with_allocator(key_size, value_size, hash, equal,
+                                          tk_allocator_default());
+}
+
+tk_hashmap_t *tk_hashmap_create_with_allocator(
+    size_t key_size, size_t value_size, tk_hash_fn_t hash,
+    tk_key_equal_fn_t equal, const tk_allocator_t *allocator) {
+  TK_ASSERT(key_size > 0);
+  tk_allocator_validate(allocator);
+  if (key_size == 0 || !allocator)
+    return NULL;
+
+  tk_hashmap_t *map =
+      (tk_hashmap_t *)tk_stats_alloc(TK_STATS_HASHMAP, allocator,
+                                     sizeof(tk_hashmap_t));
+  if (!map)
+    return NULL;
+
+  map->ctrl = NULL;
+  map->slots = NULL;
+  map->capacity = 0;
+  map->size = 0;
+  map->growth_left = 0;
+  map->key_size = key_size;
+  map->value_size = value_size;
+  map->value_offset = value_size ? TK_HASHMAP_ALIGN(key_size) : key_size;
+  map->slot_size = TK_HASHMAP_ALIGN(map->value_offset + value_size);
+  map->hash = hash ? hash : tk_hash_bytes;
+  map->equal = equal ? equal : tk_key_equal_bytes;
+  map->allocator = *allocator;
+  return map;
+}
+
+void tk_hashmap_destroy(tk_hashmap_t *map) {
+  if (!map)
+    return;
+  if (map->ctrl)
+    tk_stats_free(TK_STATS_HASHMAP, &map->allocator, map->ctrl,
+                  tk_hashmap_table_bytes(map, map->capacity));
+  tk_allocator_t allocator = map->allocator;
+  tk_stats_free(TK_STATS_HASHMAP, &allocator, map, sizeof(tk_hashmap_t));
+}
+
+// --- Capacity Functions ---
+
+size_t tk_hashmap_size(const tk_hashmap_t *map) {
+  TK_ASSERT(map);
+  return map ? map->size : 0;
+}
+
+tk_bool tk_hashmap_is_empty(const tk_hashmap_t *map) {
+  TK_ASSERT(map);
+  return map ? map->size == 0 : true;
+}
+
+size_t tk_hashmap_capacity(const tk_hashmap_t *map) {
+  TK_ASSERT(map);
+  return map ? map->capacity : 0;
+}
+
+tk_error_t tk_hashmap_reserve(tk_hashmap_t *map, size_t n) {
+  TK_ASSERT(map);
+  if (!map)
+    return TK_E_INVALID_ARG;
+
+  size_t capacity = TK_HASHMAP_GROUP_WIDTH;
+  while (tk_hashmap_max_load(capacity) < n) {
+    if (capacity > SIZE_MAX / 2)
+      return TK_E_NOMEM;
+    capacity *= 2;
+  }
+  if (capacity <= map->capacity)
+    return TK_SUCCESS;
+  return tk_hashmap_rehash(map, capacity);
+}
+
+// --- Lookup & Modifiers ---
+
+/**
+ * @brief Shared body of insert and try_insert: one probe decides between
+ * updating the existing entry (if `overwrite`) and claiming a slot.
+ */
+static tk_error_t tk_hashmap_put(tk_hashmap_t *map, const void *key,
+                                 const void *value, tk_bool overwrite,
+                                 tk_bool *inserted) {
+  uint64_t hash = tk_hashmap_hash_key(map, key);
+  size_t index = tk_hashmap_find(map, key, hash);
+  if (inserted)
+    *inserted = index == TK_HASHMAP_NPOS;
+  if (index != TK_HASHMAP_NPOS) {
+    if (overwrite && map->value_size) {
+      memcpy(tk_hashmap_slot(map, index) + map->value_offset, value,
+             map->value_size);
+      TK_STATS_COPY(TK_STATS_HASHMAP, 1);
+    }
+    return TK_SUCCESS;
+  }
+
+  // Reusing a tombstone does not consume growth; taking an EMPTY slot does.
+  if (map->capacity)
+    index = tk_hashmap_find_free(map->ctrl, map->capacity, hash);
+  if (map->capacity == 0 ||
+      (map->growth_left == 0 && map->ctrl[index] != TK_CTRL_DELETED)) {
+    tk_error_t err = tk_hashmap_grow(map);
+    if (err != TK_SUCCESS) {
+      if (inserted)
+        *inserted = false;
+      return err;
+    }
+    index = tk_hashmap_find_free(map->ctrl, map->capacity, hash);
+  }
+
+  if (map->ctrl[index] == TK_CTRL_EMPTY)
+    map->growth_left--;
+  map->ctrl[index] = tk_hashmap_h2(hash);
+  char *slot = tk_hashmap_slot(map, index);
+  memcpy(slot, key, map->key_size);
+  if (map->value_size)
+    memcpy(slot + map->value_offset, value, map->value_size);
+  TK_STATS_COPY(TK_STATS_HASHMAP, 1);
+  map->size++;
+  return TK_SUCCESS;
+}
+
+tk_error_t tk_hashmap_insert(tk_hashmap_t *map, const void *key,
+                             const void *value) {
+  TK_ASSERT(map && key && (value || map->value_size == 0));
+  if (!map || !key || (!value && map->value_size != 0))
+    return TK_E_INVALID_ARG;
+  return tk_hashmap_put(map, key, value, true, NULL);
+}
+
+tk_error_t tk_hashmap_try_insert(tk_hashmap_t *map, const void *key,
+                                 const void *value, tk_bool *inserted) {
+  TK_ASSERT(map && key && (value || map->value_size == 0));
+  if (!map || !key || (!value && map->value_size != 0))
+    return TK_E_INVALID_ARG;
+  return tk_hashmap_put(map, key, value, false, inserted);
+}
+
+void *tk_hashmap_get(const tk_hashmap_t *map, const void *key) {
+  TK_ASSERT(map && key);
+  if (!map || !key)
+    return NULL;
+
+  size_t index = tk_hashmap_find(map, key, tk_hashmap_hash_key(map, key));
+  if (index == TK_HASHMAP_NPOS)
+    return NULL;
+  return tk_hashmap_slot(map, index) + map->value_offset;
+}
+
+tk_bool tk_hashmap_contains(const tk_hashmap_t *map, const void *key) {
+  return tk_hashmap_get(map, key) != NULL;
+}
+
+tk_error_t tk_hashmap_erase(tk_hashmap_t *map, const void *key) {
+  TK_ASSERT(map && key);
+  if (!map || !key)
+    return TK_E_INVALID_ARG;
+
+  size_t index = tk_hashmap_find(map, key, tk_hashmap_hash_key(map, key));
+  if (index == TK_HASHMAP_NPOS)
+    return TK_E_NOT_FOUND;
+
+  // See the file comment for why a group with an EMPTY byte can take
+  // another one.
+  const tk_ctrl_t *group =
+      map->ctrl + index / TK_HASHMAP_GROUP_WIDTH * TK_HASHMAP_GROUP_WIDTH;
+  if (tk_group_match_empty(group)) {
+    map->ctrl[index] = TK_CTRL_EMPTY;
+    map->growth_left++;
+  } else {
+    map->ctrl[index] = TK_CTRL_DELETED;
+  }
+  map->size--;
+  return TK_SUCCESS;
+}
+
+void tk_hashmap_clear(tk_hashmap_t *map) {
+  TK_ASSERT(map);
+  if (!map || map->capacity == 0)
+    return;
+  memset(map->ctrl, (unsigned char)TK_CTRL_EMPTY, map->capacity);
+  map->size = 0;
+  map->growth_left = tk_hashmap_max_load(map->capacity);
+}
+
+// --- Iterator Implementation ---
+
+/**
+ * @brief Private state for a tk_hashmap_t iterator.
+ */
+typedef struct {
+  tk_hashmap_t *map; // The map being iterated
+  size_t index;      // Current slot, or 'capacity' for the end iterator
+} tk_hashmap_iter_state_t;
+
+/**
+ * @brief Returns the first full slot at or after 'index', or 'capacity'.
+ */
+static size_t tk_hashmap_skip_free(const tk_hashmap_t *map, size_t index) {
+  while (index < map->capacity && map->ctrl[index] < 0)
+    index++;
+  return index;
+}
+
+static void tk_hashmap_iter_advance(tk_iterator_t *self) {
+  tk_hashmap_iter_state_t *state = (tk_hashmap_iter_state_t *)self->state.data;
+  state->index = tk_hashmap_skip_free(state->map, state->index + 1);
+}
+
+static void *tk_hashmap_iter_get(const tk_iterator_t *self) {
+  const tk_hashmap_iter_state_t *state =
+      (const tk_hashmap_iter_state_t *)self->state.data;
+  TK_ASSERT(state->index < state->map->capacity);
+  return tk_hashmap_slot(state->map, state->index);
+}
+
+static tk_bool tk_hashmap_iter_equal(const tk_iterator_t *iter1,
+                                     const tk_iterator_t *iter2) {
+  const tk_hashmap_iter_state_t *state1 =
+      (const tk_hashmap_iter_state_t *)iter1->state.data;
+  const tk_hashmap_iter_state_t *state2 =
+      (const tk_hashmap_iter_state_t *)iter2->state.data;
+  return state1->map == state2->map && state1->index == state2->index;
+}
+
+static void tk_hashmap_iter_clone(tk_iterator_t *dest,
+                                  const tk_iterator_t *src) {
+  *dest = *src;
+}
+
+/**
+ * @brief The single, static vtable for all tk_hashmap_t iterators.
+ *
+ * Spelled out rather than built with TK_DEFINE_ITERATOR_VTABLE because a
+ * forward iterator has no 'retreat' function to name.
+ */
+static const tk_iterator_vtable_t g_hashmap_vtable = {
+    .category = TK_ITER_FORWARD,
+    .type_name = "tk_hashmap_iterator",
+    .advance = tk_hashmap_iter_advance,
+    .get = tk_hashmap_iter_get,
+    .equal = tk_hashmap_iter_equal,
+    .clone = tk_hashmap_iter_clone,
+    .retreat = NULL};
+
+static tk_iterator_t tk_hashmap_iter_make(tk_hashmap_t *map, size_t index) {
+  tk_iterator_t iter;
+  iter.vtable = &g_hashmap_vtable;
+  tk_hashmap_iter_state_t *state = (tk_hashmap_iter_state_t *)iter.state.data;
+  state->map = map;
+  state->index = index;
+  return iter;
+}
+
+tk_iterator_t tk_hashmap_begin(tk_hashmap_t *map) {
+  TK_ASSERT(map);
+  tk_iterator_vtable_validate(&g_hashmap_vtable);
+  return tk_hashmap_iter_make(map, tk_hashmap_skip_free(map, 0));
+}
+
+tk_iterator_t tk_hashmap_end(tk_hashmap_t *map) {
+  TK_ASSERT(map);
+  return tk_hashmap_iter_make(map, map->capacity);
+}
+
+const void *tk_hashmap_iter_key(const tk_iterator_t *iter) {
+  TK_ASSERT(iter && iter->vtable == &g_hashmap_vtable);
+  return tk_hashmap_iter_get(iter);
+}
+
+void *tk_hashmap_iter_value(const tk_iterator_t *iter) {
+  TK_ASSERT(iter && iter->vtable == &g_hashmap_vtable);
+  const tk_hashmap_iter_state_t *state =
+      (const tk_hashmap_iter_state_t *)iter->state.data;
+  return (char *)tk_hashmap_iter_get(iter) + state->map->value_offset;
+}
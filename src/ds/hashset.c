@@ -0,0 +1,86 @@
+/**
+ * @file hashset.c
+ * @brief Implements the toolkit's hash set on top of tk_hashmap_t.
+ *
+ * @details
+ * There is no separate set structure: a tk_hashset_t handle is the handle of
+ * a tk_hashmap_t created with a value size of 0, so the set costs no extra
+ * allocation or indirection. The struct tk_hashset_t is never defined; the
+ * distinct type only keeps sets and maps from being mixed up by callers.
+ */
+
+#include <tk/ds/hashmap.h>
+#include <tk/ds/hashset.h>
+
+/**
+ * @brief Returns the map behind a set.
+ */
+static inline tk_hashmap_t *tk_hashset_map(const tk_hashset_t *set) {
+  return (tk_hashmap_t *)set;
+}
+
+// --- Lifecycle Functions ---
+
+tk_hashset_t *tk_hashset_create(size_t key_size, tk_hash_fn_t hash,
+                                tk_key_equal_fn_t equal) {
+  return tk_hashset_create_with_allocator(key_size, hash, equal,
+                                          tk_allocator_default());
+}
+
+tk_hashset_t *tk_hashset_create_with_allocator(
+    size_t key_size, tk_hash_fn_t hash, tk_key_equal_fn_t equal,
+    const tk_allocator_t *allocator) {
+  return (tk_hashset_t *)tk_hashmap_create_with_allocator(key_size, 0, hash,
+                                                          equal, allocator);
+}
+
+void tk_hashset_destroy(tk_hashset_t *set) {
+  tk_hashmap_destroy(tk_hashset_map(set));
+}
+
+// --- Capacity Functions ---
+
+size_t tk_hashset_size(const tk_hashset_t *set) {
+  return tk_hashmap_size(tk_hashset_map(set));
+}
+
+tk_bool tk_hashset_is_empty(const tk_hashset_t *set) {
+  return tk_hashmap_is_empty(tk_hashset_map(set));
+}
+
+size_t tk_hashset_capacity(const tk_hashset_t *set) {
+  return tk_hashmap_capacity(tk_hashset_map(set));
+}
+
+tk_error_t tk_hashset_reserve(tk_hashset_t *set, size_t n) {
+  return tk_hashmap_reserve(tk_hashset_map(set), n);
+}
+
+// --- Lookup & Modifiers ---
+
+tk_error_t tk_hashset_insert(tk_hashset_t *set, const void *key,
+                             tk_bool *inserted) {
+  return tk_hashmap_try_insert(tk_hashset_map(set), key, NULL, inserted);
+}
+
+tk_bool tk_hashset_contains(const tk_hashset_t *set, const void *key) {
+  return tk_hashmap_contains(tk_hashset_map(set), key);
+}
+
+tk_error_t tk_hashset_erase(tk_hashset_t *set, const void *key) {
+  return tk_hashmap_erase(tk_hashset_map(set), key);
+}
+
+void tk_hashset_clear(tk_hashset_t *set) {
+  tk_hashmap_clear(tk_hashset_map(set));
+}
+
+// --- Iterator Functions ---
+
+tk_iterator_t tk_hashset_begin(tk_hashset_t *set) {
+  return tk_hashmap_begin(tk_hashset_map(set));
+}
+
+tk_iterator_t tk_hashset_end(tk_hashset_t *set) {
+  return tk_hashmap_end(tk_hashset_map(set));
+}
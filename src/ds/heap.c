@@ -0,0 +1,388 @@
+/**
+ * @file heap.c
+ * @brief Implements the toolkit's d-ary heap priority queue.
+ *
+ * @details
+ * Three vectors hold the state. 'elements' is the implicit tree: the
+ * children of position i are at (i << shift) + 1 through (i << shift) +
+ * arity. 'handles' runs parallel to it and names the handle of each
+ * position. 'slots' is indexed by handle and holds the handle's position, so
+ * every move of an element writes the new position back.
+ *
+ * A handle h is live exactly when slots[h] < size and handles[slots[h]] ==
+ * h. Free handles reuse their slot as the link of a free list; whatever
+ * position that link happens to name holds another handle, so the test
+ * needs no separate flag.
+ *
+ * Sifting moves a hole instead of swapping: the element being placed waits
+ * in 'scratch' (allocated behind the handle) while the elements it passes
+ * are shifted by one level, and it is written once at its final position.
+ */
+
+#include <string.h>
+#include <tk/core/allocator.h>
+#include <tk/core/macros.h>
+#include <tk/ds/heap.h>
+#include <tk/ds/vec.h>
+
+/**
+ * @brief The internal structure of the heap.
+ */
+struct tk_heap_t {
+  tk_vec_t *elements;           // The values, in heap order
+  tk_vec_t *handles;            // handles[i]: the handle at position i
+  tk_vec_t *slots;              // slots[h]: position or free-list link
+  tk_heap_handle_t free_handle; // Head of the free list
+  tk_compare_fn_t compare;      // The ordering; lowest on top
+  size_t element_size;          // Size of one element
+  unsigned shift;               // log2 of the arity
+  char *scratch;                // One element, behind the handle
+  tk_allocator_t allocator;     // Source of the handle
+};
+
+/**
+ * @brief Returns a pointer to the element at position `pos`.
+ */
+static inline char *tk_heap_at(const tk_heap_t *heap, size_t pos) {
+  return (char *)tk_vec_data(heap->elements) + pos * heap->element_size;
+}
+
+/**
+ * @brief Writes the scratch element, with handle `h`, at position `pos`.
+ */
+static void tk_heap_place(tk_heap_t *heap, size_t pos, tk_heap_handle_t h) {
+  memcpy(tk_heap_at(heap, pos), heap->scratch, heap->element_size);
+  ((tk_heap_handle_t *)tk_vec_data(heap->handles))[pos] = h;
+  ((size_t *)tk_vec_data(heap->slots))[h] = pos;
+}
+
+/**
+ * @brief Moves the element at `from` (one level away) into the hole at `to`.
+ */
+static void tk_heap_shift(tk_heap_t *heap, size_t to, size_t from) {
+  tk_heap_handle_t *handles = (tk_heap_handle_t *)tk_vec_data(heap->handles);
+  size_t *slots = (size_t *)tk_vec_data(heap->slots);
+  memcpy(tk_heap_at(heap, to), tk_heap_at(heap, from), heap->element_size);
+  handles[to] = handles[from];
+  slots[handles[to]] = to;
+}
+
+/**
+ * @brief Places the scratch element, with handle `h`, starting from the
+ * hole at `pos` and moving up while it beats its parent.
+ */
+static void tk_heap_sift_up(tk_heap_t *heap, size_t pos, tk_heap_handle_t h) {
+  while (pos > 0) {
+    size_t parent = (pos - 1) >> heap->shift;
+    if (heap->compare(heap->scratch, tk_heap_at(heap, parent)) >= 0)
+      break;
+    tk_heap_shift(heap, pos, parent);
+    pos = parent;
+  }
+  tk_heap_place(heap, pos, h);
+}
+
+/**
+ * @brief Places the scratch element, with handle `h`, starting from the
+ * hole at `pos` and moving down while a child beats it. Only the first `n`
+ * positions are part of the heap.
+ */
+static void tk_heap_sift_down(tk_heap_t *heap, size_t pos, tk_heap_handle_t h,
+                              size_t n) {
+  size_t arity = (size_t)1 << heap->shift;
+  // Positions past the last parent have no children.
+  while (n >= 2 && pos <= (n - 2) >> heap->shift) {
+    size_t first = (pos << heap->shift) + 1;
+    size_t last = first + arity < n ? first + arity : n;
+    size_t best = first;
+    for (size_t child = first + 1; child < last; ++child) {
+      if (heap->compare(tk_heap_at(heap, child), tk_heap_at(heap, best)) < 0)
+        best = child;
+    }
+    if (heap->compare(tk_heap_at(heap, best), heap->scratch) >= 0)
+      break;
+    tk_heap_shift(heap, pos, best);
+    pos = best;
+  }
+  tk_heap_place(heap, pos, h);
+}
+
+/**
+ * @brief Places the scratch element at `pos` in whichever direction the
+ * order requires.
+ */
+static void tk_heap_fix(tk_heap_t *heap, size_t pos, tk_heap_handle_t h) {
+  if (pos > 0 && heap->compare(heap->scratch,
+                               tk_heap_at(heap, (pos - 1) >> heap->shift)) < 0)
+    tk_heap_sift_up(heap, pos, h);
+  else
+    tk_heap_sift_down(heap, pos, h, tk_vec_size(heap->elements));
+}
+
+/**
+ * @brief Returns the position of a live handle, or SIZE_MAX.
+ */
+static size_t tk_heap_position(const tk_heap_t *heap, tk_heap_handle_t h) {
+  if (h >= tk_vec_size(heap->slots))
+    return SIZE_MAX;
+  size_t pos = ((const size_t *)tk_vec_data(heap->slots))[h];
+  if (pos >= tk_vec_size(heap->elements) ||
+      ((const tk_heap_handle_t *)tk_vec_data(heap->handles))[pos] != h)
+    return SIZE_MAX;
+  return pos;
+}
+
+/**
+ * @brief Puts a handle on the free list.
+ */
+static void tk_heap_release_handle(tk_heap_t *heap, tk_heap_handle_t h) {
+  ((size_t *)tk_vec_data(heap->slots))[h] = heap->free_handle;
+  heap->free_handle = h;
+}
+
+/**
+ * @brief Removes the element at `pos` (handle `h`) and fills the hole with
+ * the last element.
+ */
+static void tk_heap_remove_at(tk_heap_t *heap, size_t pos, tk_heap_handle_t h,
+                              void *out) {
+  if (out)
+    memcpy(out, tk_heap_at(heap, pos), heap->element_size);
+  tk_heap_release_handle(heap, h);
+
+  size_t last = tk_vec_size(heap->elements) - 1;
+  if (pos != last) {
+    memcpy(heap->scratch, tk_heap_at(heap, last), heap->element_size);
+    tk_heap_handle_t moved =
+        ((tk_heap_handle_t *)tk_vec_data(heap->handles))[last];
+    tk_vec_pop_back(heap->elements);
+    tk_vec_pop_back(heap->handles);
+    tk_heap_fix(heap, pos, moved);
+  } else {
+    tk_vec_pop_back(heap->elements);
+    tk_vec_pop_back(heap->handles);
+  }
+}
+
+// --- Lifecycle Functions ---
+
+tk_heap_t *tk_heap_create(size_t element_size, tk_compare_fn_t compare,
+                          size_t arity) {
+  return tk_heap_create_with_allocator(element_size, compare, arity,
+                                       tk_allocator_default());
+}
+
+tk_heap_t *tk_heap_create_with_allocator(size_t element_size,
+                                         tk_compare_fn_t compare, size_t arity,
+                                         const tk_allocator_t *allocator) {
+  TK_ASSERT(element_size > 0 && compare);
+  tk_allocator_validate(allocator);
+  if (arity == 0)
+    arity = TK_HEAP_DEFAULT_ARITY;
+  if (element_size == 0 || !compare || !allocator || arity < 2 ||
+      arity > 16 || (arity & (arity - 1)) != 0 ||
+      element_size > SIZE_MAX - sizeof(tk_heap_t))
+    return NULL;
+
+  tk_heap_t *heap = (tk_heap_t *)tk_allocator_alloc(
+      allocator, sizeof(tk_heap_t) + element_size);
+  if (!heap)
+    return NULL;
+
+  heap->elements = tk_vec_create_with_allocator(element_size, allocator);
+  heap->handles =
+      tk_vec_create_with_allocator(sizeof(tk_heap_handle_t), allocator);
+  heap->slots = tk_vec_create_with_allocator(sizeof(size_t), allocator);
+  heap->free_handle = TK_HEAP_NO_HANDLE;
+  heap->compare = compare;
+  heap->element_size = element_size;
+  heap->shift = 0;
+  while (((size_t)1 << heap->shift) < arity)
+    ++heap->shift;
+  heap->scratch = (char *)(heap + 1);
+  heap->allocator = *allocator;
+  if (!heap->elements || !heap->handles || !heap->slots) {
+    tk_heap_destroy(heap);
+    return NULL;
+  }
+  return heap;
+}
+
+void tk_heap_destroy(tk_heap_t *heap) {
+  if (!heap)
+    return;
+  tk_vec_destroy(heap->elements);
+  tk_vec_destroy(heap->handles);
+  tk_vec_destroy(heap->slots);
+  // Free through a copy, since the handle that holds the allocator is
+  // being released.
+  tk_allocator_t allocator = heap->allocator;
+  tk_allocator_free(&allocator, heap, sizeof(tk_heap_t) + heap->element_size);
+}
+
+// --- Capacity Functions ---
+
+size_t tk_heap_size(const tk_heap_t *heap) {
+  TK_ASSERT(heap);
+  return tk_vec_size(heap->elements);
+}
+
+tk_bool tk_heap_is_empty(const tk_heap_t *heap) {
+  TK_ASSERT(heap);
+  return tk_vec_is_empty(heap->elements);
+}
+
+size_t tk_heap_arity(const tk_heap_t *heap) {
+  TK_ASSERT(heap);
+  return (size_t)1 << heap->shift;
+}
+
+tk_error_t tk_heap_reserve(tk_heap_t *heap, size_t n) {
+  TK_ASSERT(heap);
+  tk_error_t err = tk_vec_reserve(heap->elements, n);
+  if (err == TK_SUCCESS)
+    err = tk_vec_reserve(heap->handles, n);
+  if (err == TK_SUCCESS)
+    err = tk_vec_reserve(heap->slots, n);
+  return err;
+}
+
+// --- Element Access Functions ---
+
+const void *tk_heap_top(const tk_heap_t *heap) {
+  TK_ASSERT(heap);
+  return tk_vec_front(heap->elements);
+}
+
+tk_heap_handle_t tk_heap_top_handle(const tk_heap_t *heap) {
+  TK_ASSERT(heap);
+  if (tk_vec_is_empty(heap->handles))
+    return TK_HEAP_NO_HANDLE;
+  return *(const tk_heap_handle_t *)tk_vec_front(heap->handles);
+}
+
+const void *tk_heap_get(const tk_heap_t *heap, tk_heap_handle_t handle) {
+  TK_ASSERT(heap);
+  size_t pos = tk_heap_position(heap, handle);
+  return pos == SIZE_MAX ? NULL : tk_heap_at(heap, pos);
+}
+
+tk_bool tk_heap_contains(const tk_heap_t *heap, tk_heap_handle_t handle) {
+  TK_ASSERT(heap);
+  return tk_heap_position(heap, handle) != SIZE_MAX;
+}
+
+// --- Modifiers ---
+
+tk_error_t tk_heap_push(tk_heap_t *heap, const void *element,
+                        tk_heap_handle_t *handle) {
+  TK_ASSERT(heap && element);
+  size_t n = tk_vec_size(heap->elements);
+  // Claim the new slots through the vectors' geometric growth, so pushes
+  // stay O(1) amortized; a failure gives back the slots already claimed.
+  if (!tk_vec_emplace_back(heap->elements))
+    return TK_E_NOMEM;
+  if (!tk_vec_emplace_back(heap->handles)) {
+    tk_vec_pop_back(heap->elements);
+    return TK_E_NOMEM;
+  }
+
+  tk_heap_handle_t h = heap->free_handle;
+  if (h != TK_HEAP_NO_HANDLE) {
+    heap->free_handle = ((size_t *)tk_vec_data(heap->slots))[h];
+  } else {
+    h = tk_vec_size(heap->slots);
+    if (!tk_vec_emplace_back(heap->slots)) {
+      tk_vec_pop_back(heap->elements);
+      tk_vec_pop_back(heap->handles);
+      return TK_E_NOMEM;
+    }
+  }
+  memcpy(heap->scratch, element, heap->element_size);
+  tk_heap_sift_up(heap, n, h);
+  if (handle)
+    *handle = h;
+  return TK_SUCCESS;
+}
+
+tk_error_t tk_heap_pop(tk_heap_t *heap, void *out) {
+  TK_ASSERT(heap);
+  if (tk_vec_is_empty(heap->elements))
+    return TK_E_EMPTY;
+  tk_heap_handle_t h = *(tk_heap_handle_t *)tk_vec_front(heap->handles);
+  tk_heap_remove_at(heap, 0, h, out);
+  return TK_SUCCESS;
+}
+
+tk_error_t tk_heap_assign(tk_heap_t *heap, const void *elements, size_t n,
+                          tk_heap_handle_t *handles) {
+  TK_ASSERT(heap && (elements || n == 0));
+  tk_error_t err = tk_heap_reserve(heap, n);
+  if (err != TK_SUCCESS)
+    return err;
+
+  // Start over with handles 0..n-1; every earlier handle dies.
+  (void)tk_vec_assign(heap->elements, elements, n);
+  (void)tk_vec_resize(heap->handles, n, NULL);
+  (void)tk_vec_resize(heap->slots, n, NULL);
+  heap->free_handle = TK_HEAP_NO_HANDLE;
+  tk_heap_handle_t *position_handles =
+      (tk_heap_handle_t *)tk_vec_data(heap->handles);
+  size_t *slots = (size_t *)tk_vec_data(heap->slots);
+  for (size_t i = 0; i < n; ++i) {
+    position_handles[i] = i;
+    slots[i] = i;
+    if (handles)
+      handles[i] = i;
+  }
+
+  // Floyd's construction: sift down every parent, the deepest first.
+  if (n >= 2) {
+    for (size_t pos = ((n - 2) >> heap->shift) + 1; pos-- > 0;) {
+      memcpy(heap->scratch, tk_heap_at(heap, pos), heap->element_size);
+      tk_heap_sift_down(heap, pos, position_handles[pos], n);
+    }
+  }
+  return TK_SUCCESS;
+}
+
+tk_error_t tk_heap_update(tk_heap_t *heap, tk_heap_handle_t handle,
+                          const void *element) {
+  TK_ASSERT(heap && element);
+  size_t pos = tk_heap_position(heap, handle);
+  if (pos == SIZE_MAX)
+    return TK_E_NOT_FOUND;
+  memcpy(heap->scratch, element, heap->element_size);
+  tk_heap_fix(heap, pos, handle);
+  return TK_SUCCESS;
+}
+
+tk_error_t tk_heap_decrease_key(tk_heap_t *heap, tk_heap_handle_t handle,
+                                const void *element) {
+  TK_ASSERT(heap && element);
+  size_t pos = tk_heap_position(heap, handle);
+  if (pos == SIZE_MAX)
+    return TK_E_NOT_FOUND;
+  if (heap->compare(element, tk_heap_at(heap, pos)) > 0)
+    return TK_E_INVALID_ARG;
+  memcpy(heap->scratch, element, heap->element_size);
+  tk_heap_sift_up(heap, pos, handle);
+  return TK_SUCCESS;
+}
+
+tk_error_t tk_heap_erase(tk_heap_t *heap, tk_heap_handle_t handle, void *out) {
+  TK_ASSERT(heap);
+  size_t pos = tk_heap_position(heap, handle);
+  if (pos == SIZE_MAX)
+    return TK_E_NOT_FOUND;
+  tk_heap_remove_at(heap, pos, handle, out);
+  return TK_SUCCESS;
+}
+
+void tk_heap_clear(tk_heap_t *heap) {
+  TK_ASSERT(heap);
+  tk_vec_clear(heap->elements);
+  tk_vec_clear(heap->handles);
+  tk_vec_clear(heap->slots);
+  heap->free_handle = TK_HEAP_NO_HANDLE;
+}
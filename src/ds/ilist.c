@@ -0,0 +1,237 @@
+/**
+ * @file ilist.c
+ * @brief Implements the toolkit's intrusive doubly-linked list.
+ *
+ * @details
+ * The list is circular around the sentinel embedded in tk_ilist_t: an empty
+ * list has sentinel.next == sentinel.prev == &sentinel, and the end
+ * iterator points at the sentinel. Every link operation is therefore
+ * branch-free, with no special cases for the first or last node. Unlinked
+ * nodes have NULL links, which is what `tk_ilist_node_is_linked` checks.
+ */
+
+#include <tk/core/iterator.h>
+#include <tk/core/macros.h>
+#include <tk/ds/ilist.h>
+
+/**
+ * @brief Private state for a tk_ilist_t iterator.
+ */
+typedef struct {
+  tk_ilist_node_t *node; // Current node, or &list->sentinel for end
+  tk_ilist_t *list;      // The list (for the node offset and end checks)
+} tk_ilist_iter_state_t;
+
+// --- Helper Functions ---
+
+static inline void *tk_ilist_object(const tk_ilist_t *list,
+                                    const tk_ilist_node_t *node) {
+  return (char *)node - list->node_offset;
+}
+
+static inline void tk_ilist_link(tk_ilist_t *list, tk_ilist_node_t *prev,
+                                 tk_ilist_node_t *node) {
+  TK_ASSERT(node->next == NULL && "tk_ilist: node is already linked.");
+  tk_ilist_node_t *next = prev->next;
+  node->prev = prev;
+  node->next = next;
+  prev->next = node;
+  next->prev = node;
+  ++list->size;
+}
+
+// --- Lifecycle Functions ---
+
+void tk_ilist_init(tk_ilist_t *list, size_t node_offset) {
+  TK_ASSERT(list);
+  list->sentinel.prev = &list->sentinel;
+  list->sentinel.next = &list->sentinel;
+  list->size = 0;
+  list->node_offset = node_offset;
+}
+
+void tk_ilist_node_init(tk_ilist_node_t *node) {
+  TK_ASSERT(node);
+  node->prev = NULL;
+  node->next = NULL;
+}
+
+tk_bool tk_ilist_node_is_linked(const tk_ilist_node_t *node) {
+  TK_ASSERT(node);
+  return node->next != NULL;
+}
+
+// --- Size/Query Functions ---
+
+size_t tk_ilist_size(const tk_ilist_t *list) {
+  TK_ASSERT(list);
+  return list->size;
+}
+
+tk_bool tk_ilist_is_empty(const tk_ilist_t *list) {
+  TK_ASSERT(list);
+  return list->size == 0;
+}
+
+// --- Element Access Functions ---
+
+void *tk_ilist_front(const tk_ilist_t *list) {
+  TK_ASSERT(list);
+  return list->size ? tk_ilist_object(list, list->sentinel.next) : NULL;
+}
+
+void *tk_ilist_back(const tk_ilist_t *list) {
+  TK_ASSERT(list);
+  return list->size ? tk_ilist_object(list, list->sentinel.prev) : NULL;
+}
+
+// --- Modifiers ---
+
+void tk_ilist_push_back(tk_ilist_t *list, tk_ilist_node_t *node) {
+  TK_ASSERT(list && node);
+  tk_ilist_link(list, list->sentinel.prev, node);
+}
+
+void tk_ilist_push_front(tk_ilist_t *list, tk_ilist_node_t *node) {
+  TK_ASSERT(list && node);
+  tk_ilist_link(list, &list->sentinel, node);
+}
+
+void tk_ilist_insert_before(tk_ilist_t *list, tk_ilist_node_t *position,
+                            tk_ilist_node_t *node) {
+  TK_ASSERT(list && position && node);
+  TK_ASSERT(position->prev != NULL && "tk_ilist: position is not linked.");
+  tk_ilist_link(list, position->prev, node);
+}
+
+void tk_ilist_insert_at(tk_ilist_t *list, tk_iterator_t iter,
+                        tk_ilist_node_t *node) {
+  tk_ilist_insert_before(list, tk_ilist_iter_node(&iter), node);
+}
+
+void tk_ilist_remove(tk_ilist_t *list, tk_ilist_node_t *node) {
+  TK_ASSERT(list && node && node != &list->sentinel);
+  TK_ASSERT(node->next != NULL && "tk_ilist: node is not linked.");
+  TK_ASSERT(list->size > 0);
+  node->prev->next = node->next;
+  node->next->prev = node->prev;
+  node->prev = NULL;
+  node->next = NULL;
+  --list->size;
+}
+
+tk_ilist_node_t *tk_ilist_pop_front(tk_ilist_t *list) {
+  TK_ASSERT(list);
+  if (list->size == 0)
+    return NULL;
+  tk_ilist_node_t *node = list->sentinel.next;
+  tk_ilist_remove(list, node);
+  return node;
+}
+
+tk_ilist_node_t *tk_ilist_pop_back(tk_ilist_t *list) {
+  TK_ASSERT(list);
+  if (list->size == 0)
+    return NULL;
+  tk_ilist_node_t *node = list->sentinel.prev;
+  tk_ilist_remove(list, node);
+  return node;
+}
+
+void tk_ilist_clear(tk_ilist_t *list) {
+  TK_ASSERT(list);
+  tk_ilist_node_t *node = list->sentinel.next;
+  while (node != &list->sentinel) {
+    tk_ilist_node_t *next = node->next;
+    node->prev = NULL;
+    node->next = NULL;
+    node = next;
+  }
+  tk_ilist_init(list, list->node_offset);
+}
+
+// --- Iterator Implementation ---
+
+static void tk_ilist_iter_advance(tk_iterator_t *self) {
+  tk_ilist_iter_state_t *state = (tk_ilist_iter_state_t *)self->state.data;
+  TK_ASSERT(state->node != &state->list->sentinel &&
+            "tk_ilist: advancing past the end.");
+  state->node = state->node->next;
+}
+
+static void tk_ilist_iter_retreat(tk_iterator_t *self) {
+  tk_ilist_iter_state_t *state = (tk_ilist_iter_state_t *)self->state.data;
+  TK_ASSERT(state->node->prev != &state->list->sentinel &&
+            "tk_ilist: retreating before the beginning.");
+  state->node = state->node->prev;
+}
+
+static size_t tk_ilist_iter_next_block(tk_iterator_t *self,
+                                       const tk_iterator_t *end, void **ptrs,
+                                       size_t max) {
+  tk_ilist_iter_state_t *state = (tk_ilist_iter_state_t *)self->state.data;
+  const tk_ilist_node_t *last =
+      ((const tk_ilist_iter_state_t *)end->state.data)->node;
+  size_t n = 0;
+  tk_ilist_node_t *node = state->node;
+  for (; n < max && node != last; node = node->next)
+    ptrs[n++] = tk_ilist_object(state->list, node);
+  state->node = node;
+  return n;
+}
+
+static void *tk_ilist_iter_get(const tk_iterator_t *self) {
+  const tk_ilist_iter_state_t *state =
+      (const tk_ilist_iter_state_t *)self->state.data;
+  TK_ASSERT(state->node != &state->list->sentinel &&
+            "tk_ilist: dereferencing the end iterator.");
+  return tk_ilist_object(state->list, state->node);
+}
+
+static tk_bool tk_ilist_iter_equal(const tk_iterator_t *iter1,
+                                   const tk_iterator_t *iter2) {
+  const tk_ilist_iter_state_t *state1 =
+      (const tk_ilist_iter_state_t *)iter1->state.data;
+  const tk_ilist_iter_state_t *state2 =
+      (const tk_ilist_iter_state_t *)iter2->state.data;
+  return state1->node == state2->node;
+}
+
+static void tk_ilist_iter_clone(tk_iterator_t *dest,
+                                const tk_iterator_t *src) {
+  *dest = *src;
+}
+
+/**
+ * @brief The single, static vtable for all tk_ilist_t iterators.
+ */
+static const tk_iterator_vtable_t g_ilist_vtable =
+    TK_DEFINE_BLOCK_ITERATOR_VTABLE(tk_ilist_iter,         /* Prefix */
+                                    TK_ITER_BIDIRECTIONAL, /* Category */
+                                    "tk_ilist_iterator");  /* Type Name */
+
+static tk_iterator_t tk_ilist_iter_make(tk_ilist_t *list,
+                                        tk_ilist_node_t *node) {
+  tk_iterator_t iter;
+  iter.vtable = &g_ilist_vtable;
+  tk_ilist_iter_state_t *state = (tk_ilist_iter_state_t *)iter.state.data;
+  state->node = node;
+  state->list = list;
+  return iter;
+}
+
+tk_iterator_t tk_ilist_begin(tk_ilist_t *list) {
+  TK_ASSERT(list);
+  tk_iterator_vtable_validate(&g_ilist_vtable);
+  return tk_ilist_iter_make(list, list->sentinel.next);
+}
+
+tk_iterator_t tk_ilist_end(tk_ilist_t *list) {
+  TK_ASSERT(list);
+  return tk_ilist_iter_make(list, &list->sentinel);
+}
+
+tk_ilist_node_t *tk_ilist_iter_node(const tk_iterator_t *iter) {
+  TK_ASSERT(iter && iter->vtable == &g_ilist_vtable);
+  return ((const tk_ilist_iter_state_t *)iter->state.data)->node;
+}
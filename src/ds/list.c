@@ -6,25 +6,39 @@
  * @details
  * This implementation provides a non-intrusive, generic doubly-linked list
  * that stores copies of user data, similar in semantics to tk_vec_t.
- * It manages node allocation internally and uses malloc/memcpy for element
- * data. It provides bidirectional iterators.
+ * It manages node allocation internally: each node is a single allocation
+ * holding the links followed by the element bytes, so a push costs one
+ * allocation and the payload shares a cache line with prev/next. All memory
+ * (nodes and the list handle) is obtained from the list's tk_allocator_t.
+ * A pooled list instead carves its nodes out of a private tk_slab_t, so
+ * push/pop churn recycles nodes without touching the allocator and
+ * consecutively pushed nodes sit next to each other in memory.
+ * It provides bidirectional iterators.
  */
 
-#include <stdlib.h>           // For malloc, free
-#include <string.h>           // For memcpy
-#include <tk/core/error.h>    // Error codes
-#include <tk/core/iterator.h> // Iterator definitions
-#include <tk/core/macros.h>   // TK_ASSERT
-#include <tk/core/types.h>    // tk_bool, size_t
-#include <tk/ds/list.h>       // Our public header
+#include <string.h>            // For memcpy
+#include <tk/core/allocator.h> // tk_allocator_t
+#include <tk/core/error.h>     // Error codes
+#include <tk/core/iterator.h>  // Iterator definitions
+#include <tk/core/macros.h>    // TK_ASSERT
+#include <tk/core/slab.h>      // tk_slab_t node pool
+#include <tk/core/stats.h>     // Allocation counters
+#include <tk/core/types.h>     // tk_bool, size_t
+#include <tk/ds/list.h>        // Our public header
 
 /**
  * @brief Internal node structure for the doubly-linked list.
+ *
+ * @details
+ * The element bytes are stored inline in a flexible array member directly
+ * after the links. A node is allocated as `sizeof(tk_list_node_t) +
+ * element_size` bytes; on 64-bit targets `data` starts at offset 16, so it
+ * keeps the alignment guarantee of the allocator.
  */
 typedef struct tk_list_node_t {
   struct tk_list_node_t *prev;
   struct tk_list_node_t *next;
-  void *data; // Pointer to the allocated copy of the element's data
+  unsigned char data[]; // Inline copy of the element's data
 } tk_list_node_t;
 
 /**
@@ -32,10 +46,12 @@ typedef struct tk_list_node_t {
  * @brief The opaque struct for the doubly-linked list container.
  */
 struct tk_list_t {
-  tk_list_node_t *head; // Pointer to the first node, or NULL if empty
-  tk_list_node_t *tail; // Pointer to the last node, or NULL if empty
-  size_t size;          // Number of elements in the list
-  size_t element_size;  // Size of each element in bytes
+  tk_list_node_t *head;     // Pointer to the first node, or NULL if empty
+  tk_list_node_t *tail;     // Pointer to the last node, or NULL if empty
+  size_t size;              // Number of elements in the list
+  size_t element_size;      // Size of each element in bytes
+  tk_allocator_t allocator; // Source of all node and handle memory
+  tk_slab_t *pool;          // Node pool for pooled lists, NULL otherwise
 };
 
 // --- Iterator Implementation ---
@@ -51,40 +67,52 @@ typedef struct {
 
 // --- Helper Functions ---
 
+/**
+ * @brief Returns the allocation size of one node of `list`.
+ */
+static size_t tk_list_node_bytes(const tk_list_t *list) {
+  return sizeof(tk_list_node_t) + list->element_size;
+}
+
 /**
  * @brief Allocates and initializes a new list node, including copying element
  * data.
- * @param element Pointer to the user data to copy.
- * @param element_size Size of the element data.
+ * @param list The list whose allocator and element size are used.
+ * @param element Pointer to the user data to copy, or NULL to leave the
+ * payload uninitialized (for the emplace functions).
  * @return Pointer to the new node, or NULL on allocation failure.
  */
-static tk_list_node_t *tk_list_node_create(const void *element,
-                                           size_t element_size) {
-  tk_list_node_t *node = (tk_list_node_t *)malloc(sizeof(tk_list_node_t));
+static tk_list_node_t *tk_list_node_create(tk_list_t *list,
+                                           const void *element) {
+  // One allocation for the links and the inline payload.
+  tk_list_node_t *node =
+      list->pool ? (tk_list_node_t *)tk_slab_alloc(list->pool)
+                 : (tk_list_node_t *)tk_allocator_alloc(
+                       &list->allocator, tk_list_node_bytes(list));
   if (!node) {
     return NULL; // Node allocation failed
   }
-
-  node->data = malloc(element_size);
-  if (!node->data) {
-    free(node); // Data allocation failed, free the node
-    return NULL;
-  }
+  // Counted for pooled nodes too: the list owns the node either way.
+  TK_STATS_ALLOC(TK_STATS_LIST, tk_list_node_bytes(list));
 
   // Store a copy
-  memcpy(node->data, element, element_size);
+  if (element) {
+    memcpy(node->data, element, list->element_size);
+    TK_STATS_COPY(TK_STATS_LIST, 1);
+  }
   node->prev = NULL;
   node->next = NULL;
   return node;
 }
 
 /**
- * @brief Frees a list node and its associated data copy.
+ * @brief Frees a list node together with its inline data copy.
+ * @param list The list the node belongs to.
  * @param node The node to free.
  * @param destroyer Optional function to free element data resources. It
  * receives the pointer to the element data itself (node->data).
  */
-static void tk_list_node_destroy(tk_list_node_t *node,
+static void tk_list_node_destroy(tk_list_t *list, tk_list_node_t *node,
                                  tk_element_destroyer_t destroyer) {
   if (!node)
     return;
@@ -93,19 +121,31 @@ static void tk_list_node_destroy(tk_list_node_t *node,
     // Pass the pointer to the copied data directly to the destroyer
     destroyer(node->data);
   }
-  free(node->data); // Free the copied data
-  free(node);       // Free the node itself
+  // Frees the links and the inline data in one call
+  TK_STATS_FREE(TK_STATS_LIST, tk_list_node_bytes(list));
+  if (list->pool) {
+    tk_slab_free(list->pool, node);
+  } else {
+    tk_allocator_free(&list->allocator, node, tk_list_node_bytes(list));
+  }
 }
 
 // --- Lifecycle Functions ---
 
 tk_list_t *tk_list_create(size_t element_size) {
+  return tk_list_create_with_allocator(element_size, tk_allocator_default());
+}
+
+tk_list_t *tk_list_create_with_allocator(size_t element_size,
+                                         const tk_allocator_t *allocator) {
   TK_ASSERT(element_size > 0);
-  if (element_size == 0) {
+  tk_allocator_validate(allocator);
+  if (element_size == 0 || !allocator) {
     return NULL; // Invalid argument
   }
 
-  tk_list_t *list = (tk_list_t *)malloc(sizeof(tk_list_t));
+  tk_list_t *list =
+      (tk_list_t *)tk_stats_alloc(TK_STATS_LIST, allocator, sizeof(tk_list_t));
   if (!list) {
     return NULL; // Allocation failed
   }
@@ -114,21 +154,57 @@ tk_list_t *tk_list_create(size_t element_size) {
   list->tail = NULL;
   list->size = 0;
   list->element_size = element_size;
+  list->allocator = *allocator;
+  list->pool = NULL;
+  return list;
+}
+
+tk_list_t *tk_list_create_pooled(size_t element_size,
+                                 size_t nodes_per_chunk) {
+  tk_list_t *list = tk_list_create(element_size);
+  if (!list) {
+    return NULL;
+  }
+
+  list->pool = tk_slab_create(tk_list_node_bytes(list), nodes_per_chunk,
+                              &list->allocator);
+  if (!list->pool) {
+    tk_list_destroy(list);
+    return NULL;
+  }
   return list;
 }
 
+/**
+ * @brief Frees the node pool (if any) and the list handle.
+ */
+static void tk_list_release(tk_list_t *list) {
+  tk_slab_destroy(list->pool); // Releases every pooled node, chunk by chunk
+  // Free the list structure itself, through a copy of the allocator since the
+  // handle that holds it is being released.
+  tk_allocator_t allocator = list->allocator;
+  tk_stats_free(TK_STATS_LIST, &allocator, list, sizeof(tk_list_t));
+}
+
 void tk_list_clear(tk_list_t *list) {
   TK_ASSERT(list != NULL);
   if (!list)
     return;
 
-  tk_list_node_t *current = list->head;
-  tk_list_node_t *next;
-  while (current != NULL) {
-    next = current->next;
-    // Use NULL destroyer for shallow clear
-    tk_list_node_destroy(current, NULL);
-    current = next;
+  if (list->pool) {
+    // Shallow clear of a pooled list: recycle every node at once.
+    TK_STATS_FREE_N(TK_STATS_LIST, list->size,
+                    list->size * tk_list_node_bytes(list));
+    tk_slab_reset(list->pool);
+  } else {
+    tk_list_node_t *current = list->head;
+    tk_list_node_t *next;
+    while (current != NULL) {
+      next = current->next;
+      // Use NULL destroyer for shallow clear
+      tk_list_node_destroy(list, current, NULL);
+      current = next;
+    }
   }
   list->head = NULL;
   list->tail = NULL;
@@ -139,8 +215,14 @@ void tk_list_destroy(tk_list_t *list) {
   if (!list) {
     return;
   }
-  tk_list_clear(list); // Free all nodes and their data copies
-  free(list);          // Free the list structure itself
+  if (!list->pool) {
+    tk_list_clear(list); // Free all nodes and their data copies
+  } else {
+    // The nodes go with the pool.
+    TK_STATS_FREE_N(TK_STATS_LIST, list->size,
+                    list->size * tk_list_node_bytes(list));
+  }
+  tk_list_release(list);
 }
 
 void tk_list_destroy_full(tk_list_t *list, tk_element_destroyer_t destroyer) {
@@ -153,12 +235,12 @@ void tk_list_destroy_full(tk_list_t *list, tk_element_destroyer_t destroyer) {
   while (current != NULL) {
     next = current->next;
     // Pass the user's destroyer function
-    tk_list_node_destroy(current, destroyer);
+    tk_list_node_destroy(list, current, destroyer);
     current = next;
   }
   // No need to reset head/tail/size as the list struct is freed immediately
   // after
-  free(list);
+  tk_list_release(list);
 }
 
 // --- Size/Query Functions ---
@@ -202,7 +284,7 @@ tk_error_t tk_list_push_back(tk_list_t *list, const void *element) {
   if (!list || !element)
     return TK_E_INVALID_ARG;
 
-  tk_list_node_t *new_node = tk_list_node_create(element, list->element_size);
+  tk_list_node_t *new_node = tk_list_node_create(list, element);
   if (!new_node) {
     return TK_E_NOMEM;
   }
@@ -234,7 +316,7 @@ void tk_list_pop_back(tk_list_t *list) {
     list->head = NULL;
   }
 
-  tk_list_node_destroy(node_to_remove, NULL);
+  tk_list_node_destroy(list, node_to_remove, NULL);
   list->size--;
 }
 
@@ -243,7 +325,7 @@ tk_error_t tk_list_push_front(tk_list_t *list, const void *element) {
   if (!list || !element)
     return TK_E_INVALID_ARG;
 
-  tk_list_node_t *new_node = tk_list_node_create(element, list->element_size);
+  tk_list_node_t *new_node = tk_list_node_create(list, element);
   if (!new_node) {
     return TK_E_NOMEM;
   }
@@ -275,7 +357,7 @@ void tk_list_pop_front(tk_list_t *list) {
     list->tail = NULL;
   }
 
-  tk_list_node_destroy(node_to_remove, NULL);
+  tk_list_node_destroy(list, node_to_remove, NULL);
   list->size--;
 }
 
@@ -318,7 +400,7 @@ tk_error_t tk_list_insert_before(tk_list_t *list, tk_iterator_t before_iter,
   }
 
   // Insert in the middle (before before_node)
-  tk_list_node_t *new_node = tk_list_node_create(element, list->element_size);
+  tk_list_node_t *new_node = tk_list_node_create(list, element);
   if (!new_node) {
     return TK_E_NOMEM;
   }
@@ -382,12 +464,238 @@ tk_iterator_t tk_list_erase_at(tk_list_t *list, tk_iterator_t iter) {
     list->tail = node_to_remove->prev;
   }
 
-  tk_list_node_destroy(node_to_remove, NULL);
+  tk_list_node_destroy(list, node_to_remove, NULL);
   list->size--;
 
   return next_iter;
 }
 
+// --- Bulk Modifiers ---
+
+/**
+ * @brief Checks whether nodes of `src` may be relinked into `dst` as they
+ * are: pooled nodes belong to their own list's slab, and heap nodes must be
+ * freed through the allocator that allocated them.
+ */
+static tk_bool tk_list_can_share_nodes(const tk_list_t *dst,
+                                       const tk_list_t *src) {
+  return !dst->pool && !src->pool &&
+         dst->allocator.alloc == src->allocator.alloc &&
+         dst->allocator.free == src->allocator.free &&
+         dst->allocator.ctx == src->allocator.ctx;
+}
+
+/**
+ * @brief Links the chain head..tail (`count` nodes) before `before`, or at
+ * the end if `before` is NULL.
+ */
+static void tk_list_link_chain(tk_list_t *list, tk_list_node_t *before,
+                               tk_list_node_t *head, tk_list_node_t *tail,
+                               size_t count) {
+  tk_list_node_t *prev = before ? before->prev : list->tail;
+  head->prev = prev;
+  tail->next = before;
+  if (prev) {
+    prev->next = head;
+  } else {
+    list->head = head;
+  }
+  if (before) {
+    before->prev = tail;
+  } else {
+    list->tail = tail;
+  }
+  list->size += count;
+}
+
+/**
+ * @brief Unlinks the non-empty range [first, last) (`count` nodes) into a
+ * detached chain.
+ * @return The last node of the chain.
+ */
+static tk_list_node_t *tk_list_unlink_range(tk_list_t *list,
+                                            tk_list_node_t *first,
+                                            tk_list_node_t *last,
+                                            size_t count) {
+  tk_list_node_t *tail = last ? last->prev : list->tail;
+  if (first->prev) {
+    first->prev->next = last;
+  } else {
+    list->head = last;
+  }
+  if (last) {
+    last->prev = first->prev;
+  } else {
+    list->tail = first->prev;
+  }
+  first->prev = NULL;
+  tail->next = NULL;
+  list->size -= count;
+  return tail;
+}
+
+/**
+ * @brief Frees a detached chain of nodes (without a destroyer).
+ */
+static void tk_list_free_chain(tk_list_t *list, tk_list_node_t *head) {
+  while (head) {
+    tk_list_node_t *next = head->next;
+    tk_list_node_destroy(list, head, NULL);
+    head = next;
+  }
+}
+
+/**
+ * @brief Appends a new node holding a copy of `element` to the detached
+ * chain *head..*tail.
+ * @return `false` if the node could not be allocated.
+ */
+static tk_bool tk_list_chain_push(tk_list_t *list, tk_list_node_t **head,
+                                  tk_list_node_t **tail, const void *element) {
+  tk_list_node_t *node = tk_list_node_create(list, element);
+  if (!node) {
+    return false;
+  }
+  node->prev = *tail;
+  if (*tail) {
+    (*tail)->next = node;
+  } else {
+    *head = node;
+  }
+  *tail = node;
+  return true;
+}
+
+tk_error_t tk_list_push_back_n(tk_list_t *list, const void *elements,
+                               size_t n) {
+  TK_ASSERT(list != NULL && (elements != NULL || n == 0));
+  if (!list || (!elements && n > 0))
+    return TK_E_INVALID_ARG;
+  if (n == 0)
+    return TK_SUCCESS;
+
+  // Build the whole chain off-list, then link it in one step.
+  tk_list_node_t *head = NULL, *tail = NULL;
+  const unsigned char *element = (const unsigned char *)elements;
+  for (size_t i = 0; i < n; ++i, element += list->element_size) {
+    if (!tk_list_chain_push(list, &head, &tail, element)) {
+      tk_list_free_chain(list, head);
+      return TK_E_NOMEM;
+    }
+  }
+  tk_list_link_chain(list, NULL, head, tail, n);
+  return TK_SUCCESS;
+}
+
+tk_error_t tk_list_splice(tk_list_t *dst, tk_iterator_t pos, tk_list_t *src,
+                          tk_iterator_t first, tk_iterator_t last) {
+  TK_ASSERT(dst != NULL && src != NULL);
+  if (!dst || !src || dst->element_size != src->element_size)
+    return TK_E_INVALID_ARG;
+
+  tk_list_node_t *before = tk_list_get_node_from_iter(dst, pos);
+  tk_list_node_t *first_node = tk_list_get_node_from_iter(src, first);
+  tk_list_node_t *last_node = tk_list_get_node_from_iter(src, last);
+  if (before == (tk_list_node_t *)0xFFFFFFFF ||
+      first_node == (tk_list_node_t *)0xFFFFFFFF ||
+      last_node == (tk_list_node_t *)0xFFFFFFFF) {
+    return TK_E_INVALID_ARG;
+  }
+  if (first_node == last_node)
+    return TK_SUCCESS; // Empty range
+  if (!first_node)
+    return TK_E_INVALID_ARG; // 'first' is end() but 'last' is not
+
+  // Within one list the size does not change: pure O(1) relink.
+  if (dst == src) {
+    if (before == last_node)
+      return TK_SUCCESS; // Already in place
+    tk_list_node_t *tail = tk_list_unlink_range(src, first_node, last_node, 0);
+    tk_list_link_chain(dst, before, first_node, tail, 0);
+    return TK_SUCCESS;
+  }
+
+  if (!tk_list_can_share_nodes(dst, src)) {
+    // Copy into a chain of dst nodes first, so failure changes nothing.
+    tk_list_node_t *head = NULL, *tail = NULL;
+    size_t count = 0;
+    for (tk_list_node_t *node = first_node; node != last_node;
+         node = node->next, ++count) {
+      if (!tk_list_chain_push(dst, &head, &tail, node->data)) {
+        tk_list_free_chain(dst, head);
+        return TK_E_NOMEM;
+      }
+    }
+    tk_list_unlink_range(src, first_node, last_node, count);
+    tk_list_free_chain(src, first_node);
+    tk_list_link_chain(dst, before, head, tail, count);
+    return TK_SUCCESS;
+  }
+
+  // The whole list moves in O(1); a sub-range is counted to keep sizes exact.
+  size_t count = src->size;
+  if (first_node != src->head || last_node != NULL) {
+    count = 0;
+    for (tk_list_node_t *node = first_node; node != last_node;
+         node = node->next)
+      ++count;
+  }
+  tk_list_node_t *tail =
+      tk_list_unlink_range(src, first_node, last_node, count);
+  tk_list_link_chain(dst, before, first_node, tail, count);
+  return TK_SUCCESS;
+}
+
+tk_error_t tk_list_append_list(tk_list_t *dst, tk_list_t *src) {
+  TK_ASSERT(dst != NULL && src != NULL && dst != src);
+  if (!dst || !src || dst == src)
+    return TK_E_INVALID_ARG;
+  return tk_list_splice(dst, tk_list_end(dst), src, tk_list_begin(src),
+                        tk_list_end(src));
+}
+
+// --- In-place Construction ---
+
+/**
+ * @brief Links a node with an uninitialized payload before `before` (NULL
+ * for the end).
+ * @return The payload, or NULL if the node could not be allocated.
+ */
+static void *tk_list_emplace_node(tk_list_t *list, tk_list_node_t *before) {
+  tk_list_node_t *node = tk_list_node_create(list, NULL);
+  if (!node) {
+    return NULL;
+  }
+  tk_list_link_chain(list, before, node, node, 1);
+  return node->data;
+}
+
+void *tk_list_emplace_back(tk_list_t *list) {
+  TK_ASSERT(list != NULL);
+  if (!list)
+    return NULL;
+  return tk_list_emplace_node(list, NULL);
+}
+
+void *tk_list_emplace_front(tk_list_t *list) {
+  TK_ASSERT(list != NULL);
+  if (!list)
+    return NULL;
+  return tk_list_emplace_node(list, list->head);
+}
+
+void *tk_list_emplace_before(tk_list_t *list, tk_iterator_t before_iter) {
+  TK_ASSERT(list != NULL);
+  if (!list)
+    return NULL;
+
+  tk_list_node_t *before_node = tk_list_get_node_from_iter(list, before_iter);
+  if (before_node == (tk_list_node_t *)0xFFFFFFFF) {
+    return NULL;
+  }
+  return tk_list_emplace_node(list, before_node);
+}
+
 // --- vtable function implementations ---
 
 /**
@@ -455,14 +763,32 @@ static void tk_list_iter_clone(tk_iterator_t *dest, const tk_iterator_t *src) {
   *dest = *src;
 }
 
+/**
+ * @brief (vtable) Hands out the data pointers of the next nodes, up to
+ * 'end', walking the links directly.
+ */
+static size_t tk_list_iter_next_block(tk_iterator_t *self,
+                                      const tk_iterator_t *end, void **ptrs,
+                                      size_t max) {
+  tk_list_iter_state_t *state = (tk_list_iter_state_t *)self->state.data;
+  const tk_list_node_t *last =
+      ((const tk_list_iter_state_t *)end->state.data)->node;
+  size_t n = 0;
+  tk_list_node_t *node = state->node;
+  for (; n < max && node != last; node = node->next)
+    ptrs[n++] = node->data;
+  state->node = node;
+  return n;
+}
+
 /**
  * @brief The single, static vtable for all tk_list_t iterators.
- * Uses the updated TK_DEFINE_ITERATOR_VTABLE macro.
+ * Uses TK_DEFINE_BLOCK_ITERATOR_VTABLE, for the batched node walk.
  */
 static const tk_iterator_vtable_t g_list_vtable =
-    TK_DEFINE_ITERATOR_VTABLE(tk_list_iter,          /* Function Prefix */
-                              TK_ITER_BIDIRECTIONAL, /* Category */
-                              "tk_list_iterator");   /* Type Name */
+    TK_DEFINE_BLOCK_ITERATOR_VTABLE(tk_list_iter,          /* Prefix */
+                                    TK_ITER_BIDIRECTIONAL, /* Category */
+                                    "tk_list_iterator");   /* Type Name */
 
 // --- Public iterator function implementations ---
 
@@ -0,0 +1,470 @@
+/**
+ * @file mmvec.c
+ * @brief Implements the file-backed, memory-mapped vector.
+ *
+ * @details
+ * The whole file is mapped, header included, so the element count lives in
+ * the mapping and every push updates it in place; there is nothing to write
+ * back on close. The mapping length always equals the file length, and the
+ * capacity is the number of whole records after the header.
+ *
+ * Growth extends the file first and maps the new length before unmapping the
+ * old one, so a failed remap leaves the vector exactly as it was. Shrinking
+ * maps the new length first and cuts the file second, for the same reason.
+ */
+
+#define _POSIX_C_SOURCE 200809L // For ftruncate, fstat, mmap and msync
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <tk/core/allocator.h>
+#include <tk/core/macros.h>
+#include <tk/ds/mmvec.h>
+#include <unistd.h>
+
+/**
+ * @brief The smallest number of bytes a growth adds to the file, so that
+ * small records do not remap on every few pushes.
+ */
+#ifndef TK_MMVEC_MIN_GROWTH_BYTES
+#define TK_MMVEC_MIN_GROWTH_BYTES 4096
+#endif
+
+/**
+ * @brief Identifies a tk_mmvec_t file (and its format version).
+ */
+static const char g_mmvec_magic[8] = {'T', 'K', 'M', 'M', 'V', 'E', 'C', '1'};
+
+/**
+ * @brief The file header. 64 bytes, so records start cache-line aligned.
+ */
+typedef struct {
+  char magic[8];         // g_mmvec_magic
+  uint64_t element_size; // Size of one record
+  uint64_t size;         // Number of records in use
+  uint64_t reserved[5];  // Zero
+} tk_mmvec_header_t;
+
+/**
+ * @brief The internal structure of the memory-mapped vector.
+ */
+struct tk_mmvec_t {
+  tk_mmvec_header_t *header; // Start of the mapping
+  char *data;                // First record, right after the header
+  size_t map_bytes;          // Length of the mapping (= file length)
+  size_t capacity;           // Whole records the file has room for
+  size_t element_size;       // Size of one record
+  int fd;                    // The open file
+  tk_bool read_only;         // Opened with TK_MMVEC_READ_ONLY
+};
+
+/**
+ * @brief Private state for a tk_mmvec_t iterator.
+ */
+typedef struct {
+  char *ptr;           // Pointer to the current element
+  size_t element_size; // Size of one element
+} tk_mmvec_iter_state_t;
+
+// --- Helper Functions ---
+
+/**
+ * @brief Maps `bytes` of the file with the vector's protection.
+ * @return The mapping, or NULL on failure.
+ */
+static tk_mmvec_header_t *tk_mmvec_map(const tk_mmvec_t *vec, size_t bytes) {
+  int prot = vec->read_only ? PROT_READ : PROT_READ | PROT_WRITE;
+  void *map = mmap(NULL, bytes, prot, MAP_SHARED, vec->fd, 0);
+  return map == MAP_FAILED ? NULL : (tk_mmvec_header_t *)map;
+}
+
+/**
+ * @brief Installs a mapping of `bytes` bytes.
+ */
+static void tk_mmvec_adopt(tk_mmvec_t *vec, tk_mmvec_header_t *map,
+                           size_t bytes) {
+  vec->header = map;
+  vec->data = (char *)map + sizeof(tk_mmvec_header_t);
+  vec->map_bytes = bytes;
+  vec->capacity = (bytes - sizeof(tk_mmvec_header_t)) / vec->element_size;
+}
+
+/**
+ * @brief Resizes the file to hold exactly `capacity` records and remaps it.
+ * @return TK_SUCCESS, or TK_E_IO / TK_E_NOMEM (the vector is unchanged).
+ */
+static tk_error_t tk_mmvec_set_capacity(tk_mmvec_t *vec, size_t capacity) {
+  TK_ASSERT(capacity >= vec->header->size);
+  if (capacity > (SIZE_MAX - sizeof(tk_mmvec_header_t)) / vec->element_size)
+    return TK_E_NOMEM;
+  size_t bytes = sizeof(tk_mmvec_header_t) + capacity * vec->element_size;
+  if ((off_t)bytes < 0 || (size_t)(off_t)bytes != bytes)
+    return TK_E_NOMEM;
+
+  if (bytes < vec->map_bytes) {
+    // Shrinking: the pages past the new end must not stay mapped. The
+    // smaller mapping is made first and only installed once the file has
+    // been cut, so either failure leaves the old mapping and file in place.
+    tk_mmvec_header_t *map = tk_mmvec_map(vec, bytes);
+    if (!map)
+      return TK_E_NOMEM;
+    if (ftruncate(vec->fd, (off_t)bytes) != 0) {
+      munmap(map, bytes);
+      return TK_E_IO;
+    }
+    munmap(vec->header, vec->map_bytes);
+    tk_mmvec_adopt(vec, map, bytes);
+    return TK_SUCCESS;
+  }
+
+  if (ftruncate(vec->fd, (off_t)bytes) != 0)
+    return TK_E_IO;
+  tk_mmvec_header_t *map = tk_mmvec_map(vec, bytes);
+  if (!map) {
+    (void)ftruncate(vec->fd, (off_t)vec->map_bytes); // Best effort
+    return TK_E_NOMEM;
+  }
+  munmap(vec->header, vec->map_bytes);
+  tk_mmvec_adopt(vec, map, bytes);
+  return TK_SUCCESS;
+}
+
+/**
+ * @brief Ensures room for `extra` more records with a single geometric
+ * growth of at least TK_MMVEC_MIN_GROWTH_BYTES.
+ */
+static tk_error_t tk_mmvec_grow_for(tk_mmvec_t *vec, size_t extra) {
+  size_t size = (size_t)vec->header->size;
+  if (extra > SIZE_MAX - size)
+    return TK_E_NOMEM;
+  size_t needed = size + extra;
+  if (needed <= vec->capacity)
+    return TK_SUCCESS;
+
+  size_t capacity = vec->capacity <= SIZE_MAX / 2 ? vec->capacity * 2 : needed;
+  size_t min = (TK_MMVEC_MIN_GROWTH_BYTES + vec->element_size - 1) /
+               vec->element_size;
+  if (capacity < vec->capacity + min)
+    capacity = vec->capacity + min;
+  if (capacity < needed)
+    capacity = needed;
+  return tk_mmvec_set_capacity(vec, capacity);
+}
+
+/**
+ * @brief Checks that the mapped header describes a valid vector of this
+ * element size.
+ */
+static tk_bool tk_mmvec_header_is_valid(const tk_mmvec_t *vec) {
+  const tk_mmvec_header_t *header = vec->header;
+  return memcmp(header->magic, g_mmvec_magic, sizeof(g_mmvec_magic)) == 0 &&
+         header->element_size == vec->element_size &&
+         header->size <= vec->capacity;
+}
+
+/**
+ * @brief Closes the file of a half-opened vector and frees the handle,
+ * preserving `errno` for the caller.
+ * @return NULL, for `return tk_mmvec_abandon(vec);`.
+ */
+static tk_mmvec_t *tk_mmvec_abandon(tk_mmvec_t *vec) {
+  int saved = errno;
+  close(vec->fd);
+  tk_allocator_free(tk_allocator_default(), vec, sizeof(tk_mmvec_t));
+  errno = saved;
+  return NULL;
+}
+
+// --- Lifecycle Functions ---
+
+tk_mmvec_t *tk_mmvec_open(const char *path, size_t element_size,
+                          unsigned flags) {
+  TK_ASSERT(path && element_size > 0);
+  tk_bool read_only = (flags & TK_MMVEC_READ_ONLY) != 0;
+  if (!path || element_size == 0 ||
+      (read_only && (flags & (TK_MMVEC_CREATE | TK_MMVEC_TRUNCATE)))) {
+    errno = EINVAL;
+    return NULL;
+  }
+
+  int oflags = read_only ? O_RDONLY : O_RDWR;
+  if (flags & TK_MMVEC_CREATE)
+    oflags |= O_CREAT;
+  if (flags & TK_MMVEC_TRUNCATE)
+    oflags |= O_TRUNC;
+  int fd = open(path, oflags | O_CLOEXEC, 0666);
+  if (fd < 0)
+    return NULL;
+
+  tk_mmvec_t *vec = (tk_mmvec_t *)tk_allocator_alloc(tk_allocator_default(),
+                                                     sizeof(tk_mmvec_t));
+  if (!vec) {
+    close(fd);
+    errno = ENOMEM;
+    return NULL;
+  }
+  vec->fd = fd;
+  vec->element_size = element_size;
+  vec->read_only = read_only;
+
+  struct stat st;
+  if (fstat(fd, &st) != 0)
+    return tk_mmvec_abandon(vec);
+  size_t bytes = (size_t)st.st_size;
+  tk_bool fresh = bytes == 0 && !read_only;
+  if (fresh) {
+    // A new (or truncated) file: write an empty header.
+    bytes = sizeof(tk_mmvec_header_t);
+    if (ftruncate(fd, (off_t)bytes) != 0)
+      return tk_mmvec_abandon(vec);
+  } else if (bytes < sizeof(tk_mmvec_header_t)) {
+    errno = EINVAL;
+    return tk_mmvec_abandon(vec);
+  }
+
+  tk_mmvec_header_t *map = tk_mmvec_map(vec, bytes);
+  if (!map)
+    return tk_mmvec_abandon(vec);
+  tk_mmvec_adopt(vec, map, bytes);
+  if (fresh) {
+    memset(map, 0, sizeof(*map));
+    memcpy(map->magic, g_mmvec_magic, sizeof(g_mmvec_magic));
+    map->element_size = element_size;
+  } else if (!tk_mmvec_header_is_valid(vec)) {
+    munmap(map, bytes);
+    errno = EINVAL;
+    return tk_mmvec_abandon(vec);
+  }
+  return vec;
+}
+
+void tk_mmvec_close(tk_mmvec_t *vec) {
+  if (!vec)
+    return;
+  munmap(vec->header, vec->map_bytes);
+  close(vec->fd);
+  tk_allocator_free(tk_allocator_default(), vec, sizeof(tk_mmvec_t));
+}
+
+tk_error_t tk_mmvec_sync(tk_mmvec_t *vec) {
+  TK_ASSERT(vec);
+  return msync(vec->header, vec->map_bytes, MS_SYNC) == 0 ? TK_SUCCESS
+                                                          : TK_E_IO;
+}
+
+// --- Capacity Functions ---
+
+size_t tk_mmvec_size(const tk_mmvec_t *vec) {
+  TK_ASSERT(vec);
+  return (size_t)vec->header->size;
+}
+
+tk_bool tk_mmvec_is_empty(const tk_mmvec_t *vec) {
+  TK_ASSERT(vec);
+  return vec->header->size == 0;
+}
+
+size_t tk_mmvec_capacity(const tk_mmvec_t *vec) {
+  TK_ASSERT(vec);
+  return vec->capacity;
+}
+
+tk_bool tk_mmvec_is_read_only(const tk_mmvec_t *vec) {
+  TK_ASSERT(vec);
+  return vec->read_only;
+}
+
+tk_error_t tk_mmvec_reserve(tk_mmvec_t *vec, size_t n) {
+  TK_ASSERT(vec);
+  if (vec->read_only)
+    return TK_E_INVALID_ARG;
+  if (n <= vec->capacity)
+    return TK_SUCCESS;
+  return tk_mmvec_set_capacity(vec, n);
+}
+
+tk_error_t tk_mmvec_shrink_to_fit(tk_mmvec_t *vec) {
+  TK_ASSERT(vec);
+  if (vec->read_only)
+    return TK_E_INVALID_ARG;
+  if (vec->header->size == vec->capacity &&
+      vec->map_bytes == sizeof(tk_mmvec_header_t) +
+                            vec->capacity * vec->element_size)
+    return TK_SUCCESS;
+  return tk_mmvec_set_capacity(vec, (size_t)vec->header->size);
+}
+
+// --- Element Access Functions ---
+
+void *tk_mmvec_at(const tk_mmvec_t *vec, size_t index) {
+  TK_ASSERT(vec);
+  if (index >= vec->header->size)
+    return NULL;
+  return vec->data + index * vec->element_size;
+}
+
+void *tk_mmvec_front(const tk_mmvec_t *vec) { return tk_mmvec_at(vec, 0); }
+
+void *tk_mmvec_back(const tk_mmvec_t *vec) {
+  TK_ASSERT(vec);
+  size_t size = (size_t)vec->header->size;
+  return size ? vec->data + (size - 1) * vec->element_size : NULL;
+}
+
+void *tk_mmvec_data(const tk_mmvec_t *vec) {
+  TK_ASSERT(vec);
+  return vec->data;
+}
+
+// --- Modifiers ---
+
+tk_error_t tk_mmvec_push_back(tk_mmvec_t *vec, const void *element) {
+  TK_ASSERT(vec && element);
+  return tk_mmvec_push_back_n(vec, element, 1);
+}
+
+tk_error_t tk_mmvec_push_back_n(tk_mmvec_t *vec, const void *elements,
+                                size_t n) {
+  TK_ASSERT(vec && (elements || n == 0));
+  if (vec->read_only)
+    return TK_E_INVALID_ARG;
+  tk_error_t err = tk_mmvec_grow_for(vec, n);
+  if (err != TK_SUCCESS)
+    return err;
+  if (n) {
+    // Records first, then the count, so a crash never exposes garbage.
+    memcpy(vec->data + vec->header->size * vec->element_size, elements,
+           n * vec->element_size);
+    vec->header->size += n;
+  }
+  return TK_SUCCESS;
+}
+
+void *tk_mmvec_emplace_back(tk_mmvec_t *vec) {
+  TK_ASSERT(vec);
+  if (vec->read_only || tk_mmvec_grow_for(vec, 1) != TK_SUCCESS)
+    return NULL;
+  // The count is published before the caller writes the record, so clear the
+  // slot first: a crash in between exposes zeroes, never a popped record.
+  char *slot = vec->data + vec->header->size * vec->element_size;
+  memset(slot, 0, vec->element_size);
+  vec->header->size++;
+  return slot;
+}
+
+tk_error_t tk_mmvec_pop_back(tk_mmvec_t *vec) {
+  TK_ASSERT(vec);
+  if (vec->read_only)
+    return TK_E_INVALID_ARG;
+  if (vec->header->size > 0)
+    vec->header->size--;
+  return TK_SUCCESS;
+}
+
+tk_error_t tk_mmvec_clear(tk_mmvec_t *vec) {
+  TK_ASSERT(vec);
+  if (vec->read_only)
+    return TK_E_INVALID_ARG;
+  vec->header->size = 0;
+  return TK_SUCCESS;
+}
+
+// --- Iterator Implementation ---
+
+static void tk_mmvec_iter_advance(tk_iterator_t *self) {
+  tk_mmvec_iter_state_t *state = (tk_mmvec_iter_state_t *)self->state.data;
+  state->ptr += state->element_size;
+}
+
+static void tk_mmvec_iter_retreat(tk_iterator_t *self) {
+  tk_mmvec_iter_state_t *state = (tk_mmvec_iter_state_t *)self->state.data;
+  state->ptr -= state->element_size;
+}
+
+static void *tk_mmvec_iter_get(const tk_iterator_t *self) {
+  return ((const tk_mmvec_iter_state_t *)self->state.data)->ptr;
+}
+
+static tk_bool tk_mmvec_iter_equal(const tk_iterator_t *iter1,
+                                   const tk_iterator_t *iter2) {
+  return ((const tk_mmvec_iter_state_t *)iter1->state.data)->ptr ==
+         ((const tk_mmvec_iter_state_t *)iter2->state.data)->ptr;
+}
+
+static void tk_mmvec_iter_clone(tk_iterator_t *dest,
+                                const tk_iterator_t *src) {
+  *dest = *src;
+}
+
+static void *tk_mmvec_iter_contiguous(const tk_iterator_t *self,
+                                      size_t *stride) {
+  const tk_mmvec_iter_state_t *state =
+      (const tk_mmvec_iter_state_t *)self->state.data;
+  *stride = state->element_size;
+  return state->ptr;
+}
+
+static void tk_mmvec_iter_seek(tk_iterator_t *self, ptrdiff_t n) {
+  tk_mmvec_iter_state_t *state = (tk_mmvec_iter_state_t *)self->state.data;
+  state->ptr += n * (ptrdiff_t)state->element_size;
+}
+
+static ptrdiff_t tk_mmvec_iter_distance(const tk_iterator_t *from,
+                                        const tk_iterator_t *to) {
+  const tk_mmvec_iter_state_t *state1 =
+      (const tk_mmvec_iter_state_t *)from->state.data;
+  const tk_mmvec_iter_state_t *state2 =
+      (const tk_mmvec_iter_state_t *)to->state.data;
+  return (state2->ptr - state1->ptr) / (ptrdiff_t)state1->element_size;
+}
+
+static void *tk_mmvec_iter_at_offset(const tk_iterator_t *self,
+                                     ptrdiff_t n) {
+  const tk_mmvec_iter_state_t *state =
+      (const tk_mmvec_iter_state_t *)self->state.data;
+  return state->ptr + n * (ptrdiff_t)state->element_size;
+}
+
+static size_t tk_mmvec_iter_next_block(tk_iterator_t *self,
+                                       const tk_iterator_t *end, void **ptrs,
+                                       size_t max) {
+  tk_mmvec_iter_state_t *state = (tk_mmvec_iter_state_t *)self->state.data;
+  const tk_mmvec_iter_state_t *last =
+      (const tk_mmvec_iter_state_t *)end->state.data;
+  size_t left = (size_t)(last->ptr - state->ptr) / state->element_size;
+  size_t n = left < max ? left : max;
+  for (size_t i = 0; i < n; ++i, state->ptr += state->element_size)
+    ptrs[i] = state->ptr;
+  return n;
+}
+
+/**
+ * @brief The single, static vtable for all tk_mmvec_t iterators.
+ */
+static const tk_iterator_vtable_t g_mmvec_vtable =
+    TK_DEFINE_BLOCK_CONTIGUOUS_ITERATOR_VTABLE(tk_mmvec_iter,
+                                               "tk_mmvec_iterator");
+
+static tk_iterator_t tk_mmvec_iter_make(const tk_mmvec_t *vec, size_t index) {
+  tk_iterator_t iter;
+  iter.vtable = &g_mmvec_vtable;
+  tk_mmvec_iter_state_t *state = (tk_mmvec_iter_state_t *)iter.state.data;
+  state->ptr = vec->data + index * vec->element_size;
+  state->element_size = vec->element_size;
+  return iter;
+}
+
+tk_iterator_t tk_mmvec_begin(tk_mmvec_t *vec) {
+  TK_ASSERT(vec);
+  tk_iterator_vtable_validate(&g_mmvec_vtable);
+  return tk_mmvec_iter_make(vec, 0);
+}
+
+tk_iterator_t tk_mmvec_end(tk_mmvec_t *vec) {
+  TK_ASSERT(vec);
+  return tk_mmvec_iter_make(vec, (size_t)vec->header->size);
+}
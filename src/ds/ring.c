@@ -0,0 +1,423 @@
+/**
+ * @file ring.c
+ * @brief Implements the toolkit's bounded lock-free ring buffer.
+ *
+ * @details
+ * Positions ('head' for the consumer side, 'tail' for the producer side) are
+ * free-running counters; the slot of position p is p & mask. They only grow,
+ * so 'tail - head' is the number of claimed slots even across wrap-around.
+ *
+ * SPSC: the producer writes the slots, then publishes them with a release
+ * store of 'tail'; the consumer observes them with an acquire load of 'tail',
+ * reads them, then frees them with a release store of 'head'. Each side
+ * keeps a private cached copy of the other side's index and only reloads it
+ * when the cached view says there is no room (or nothing to read).
+ *
+ * MPMC: slot i carries a sequence number seq[i]. For position p mapping to
+ * slot i, seq[i] == p means "free for the producer of p" and seq[i] == p + 1
+ * means "filled, ready for the consumer of p"; the consumer hands the slot
+ * to the next lap by storing p + capacity. A batch is claimed by checking
+ * the sequence numbers of consecutive positions, then advancing the shared
+ * index past the ready ones with one compare-and-swap.
+ */
+
+#include <string.h>
+#include <tk/core/allocator.h>
+#include <tk/core/atomic.h>
+#include <tk/core/macros.h>
+#include <tk/core/stats.h>
+#include <tk/ds/ring.h>
+
+/**
+ * @brief Assumed cache line size, used to keep the two indices apart.
+ */
+#define TK_RING_CACHE_LINE 64
+
+/**
+ * @struct tk_ring_t
+ * @brief The opaque struct for the ring buffer.
+ */
+struct tk_ring_t {
+  // Read-only after creation.
+  char *data;               // 'capacity' slots of 'element_size' bytes
+  size_t *seq;              // Per-slot sequence numbers (MPMC), or NULL
+  size_t capacity;          // Number of slots (power of two)
+  size_t mask;              // capacity - 1
+  size_t element_size;      // Size of one element
+  tk_ring_mode_t mode;      // Concurrency mode
+  tk_allocator_t allocator; // Used by create and destroy only
+  char pad0[TK_RING_CACHE_LINE];
+
+  // Producer side.
+  size_t tail;        // (atomic) Next position to push
+  size_t cached_head; // Producer's last view of 'head' (SPSC)
+  char pad1[TK_RING_CACHE_LINE - 2 * sizeof(size_t)];
+
+  // Consumer side.
+  size_t head;        // (atomic) Next position to pop
+  size_t cached_tail; // Consumer's last view of 'tail' (SPSC)
+  char pad2[TK_RING_CACHE_LINE - 2 * sizeof(size_t)];
+};
+
+/**
+ * @brief State of a ring iterator: a position between 'head' and 'tail'.
+ */
+typedef struct {
+  tk_ring_t *ring;
+  size_t pos;
+} tk_ring_iter_state_t;
+
+// --- Internal Helpers ---
+
+static inline char *tk_ring_slot(const tk_ring_t *ring, size_t pos) {
+  return ring->data + (pos & ring->mask) * ring->element_size;
+}
+
+/**
+ * @brief Copies 'count' packed elements into the slots from position 'pos',
+ * in at most two runs (before and after the wrap).
+ */
+static void tk_ring_copy_in(tk_ring_t *ring, size_t pos, const char *src,
+                            size_t count) {
+  size_t first = ring->capacity - (pos & ring->mask);
+  if (first > count)
+    first = count;
+  memcpy(tk_ring_slot(ring, pos), src, first * ring->element_size);
+  memcpy(ring->data, src + first * ring->element_size,
+         (count - first) * ring->element_size);
+  TK_STATS_COPY(TK_STATS_RING, count);
+}
+
+/**
+ * @brief Copies 'count' elements from the slots at position 'pos' out to
+ * 'dst' (if not NULL).
+ */
+static void tk_ring_copy_out(const tk_ring_t *ring, size_t pos, char *dst,
+                             size_t count) {
+  if (!dst)
+    return;
+  size_t first = ring->capacity - (pos & ring->mask);
+  if (first > count)
+    first = count;
+  memcpy(dst, tk_ring_slot(ring, pos), first * ring->element_size);
+  memcpy(dst + first * ring->element_size, ring->data,
+         (count - first) * ring->element_size);
+  TK_STATS_COPY(TK_STATS_RING, count);
+}
+
+// --- SPSC ---
+
+static size_t tk_ring_spsc_push(tk_ring_t *ring, const char *src,
+                                size_t count) {
+  size_t tail = TK_ATOMIC_LOAD(&ring->tail, TK_ATOMIC_RELAXED);
+  size_t free_slots = ring->capacity - (tail - ring->cached_head);
+  if (free_slots < count) {
+    ring->cached_head = TK_ATOMIC_LOAD(&ring->head, TK_ATOMIC_ACQUIRE);
+    free_slots = ring->capacity - (tail - ring->cached_head);
+  }
+  if (count > free_slots)
+    count = free_slots;
+  if (count == 0)
+    return 0;
+
+  tk_ring_copy_in(ring, tail, src, count);
+  TK_ATOMIC_STORE(&ring->tail, tail + count, TK_ATOMIC_RELEASE);
+  return count;
+}
+
+static size_t tk_ring_spsc_pop(tk_ring_t *ring, char *dst, size_t count) {
+  size_t head = TK_ATOMIC_LOAD(&ring->head, TK_ATOMIC_RELAXED);
+  size_t ready = ring->cached_tail - head;
+  if (ready < count) {
+    ring->cached_tail = TK_ATOMIC_LOAD(&ring->tail, TK_ATOMIC_ACQUIRE);
+    ready = ring->cached_tail - head;
+  }
+  if (count > ready)
+    count = ready;
+  if (count == 0)
+    return 0;
+
+  tk_ring_copy_out(ring, head, dst, count);
+  TK_ATOMIC_STORE(&ring->head, head + count, TK_ATOMIC_RELEASE);
+  return count;
+}
+
+// --- MPMC ---
+
+/**
+ * @brief Claims up to 'count' consecutive positions of 'index' whose slots
+ * are in state 'pos + ready_offset' (0 for producers, 1 for consumers).
+ * @return The number of positions claimed; the first is stored in '*first'.
+ */
+static size_t tk_ring_mpmc_claim(tk_ring_t *ring, size_t *index,
+                                 size_t ready_offset, size_t count,
+                                 size_t *first) {
+  size_t pos = TK_ATOMIC_LOAD(index, TK_ATOMIC_RELAXED);
+  for (;;) {
+    size_t claimable = 0;
+    size_t seq = 0;
+    while (claimable < count) {
+      size_t p = pos + claimable;
+      seq = TK_ATOMIC_LOAD(&ring->seq[p & ring->mask], TK_ATOMIC_ACQUIRE);
+      if (seq != p + ready_offset)
+        break;
+      ++claimable;
+    }
+
+    if (claimable == 0) {
+      // Lagging a lap behind: full (producer) or empty (consumer).
+      if ((ptrdiff_t)(seq - (pos + ready_offset)) < 0)
+        return 0;
+      // Another thread claimed 'pos' first; catch up.
+      pos = TK_ATOMIC_LOAD(index, TK_ATOMIC_RELAXED);
+      continue;
+    }
+
+    if (TK_ATOMIC_CAS_WEAK(index, &pos, pos + claimable, TK_ATOMIC_RELAXED,
+                           TK_ATOMIC_RELAXED)) {
+      *first = pos;
+      return claimable;
+    }
+    // The CAS reloaded 'pos'; re-check from there.
+  }
+}
+
+static size_t tk_ring_mpmc_push(tk_ring_t *ring, const char *src,
+                                size_t count) {
+  size_t pos;
+  count = tk_ring_mpmc_claim(ring, &ring->tail, 0, count, &pos);
+  if (count == 0)
+    return 0;
+
+  tk_ring_copy_in(ring, pos, src, count);
+  for (size_t i = 0; i < count; ++i)
+    TK_ATOMIC_STORE(&ring->seq[(pos + i) & ring->mask], pos + i + 1,
+                    TK_ATOMIC_RELEASE);
+  return count;
+}
+
+static size_t tk_ring_mpmc_pop(tk_ring_t *ring, char *dst, size_t count) {
+  size_t pos;
+  count = tk_ring_mpmc_claim(ring, &ring->head, 1, count, &pos);
+  if (count == 0)
+    return 0;
+
+  tk_ring_copy_out(ring, pos, dst, count);
+  for (size_t i = 0; i < count; ++i)
+    TK_ATOMIC_STORE(&ring->seq[(pos + i) & ring->mask],
+                    pos + i + ring->capacity, TK_ATOMIC_RELEASE);
+  return count;
+}
+
+// --- Lifecycle Functions ---
+
+tk_ring_t *tk_ring_create(size_t element_size, size_t capacity,
+                          tk_ring_mode_t mode) {
+  return tk_ring_create_with_allocator(element_size, capacity, mode,
+                                       tk_allocator_default());
+}
+
+tk_ring_t *tk_ring_create_with_allocator(size_t element_size, size_t capacity,
+                                         tk_ring_mode_t mode,
+                                         const tk_allocator_t *allocator) {
+  TK_ASSERT(element_size > 0);
+  tk_allocator_validate(allocator);
+  if (element_size == 0 || !allocator)
+    return NULL;
+
+  size_t slots = 2;
+  while (slots < capacity) {
+    if (slots > SIZE_MAX / 2)
+      return NULL;
+    slots *= 2;
+  }
+  if (slots > SIZE_MAX / element_size)
+    return NULL;
+
+  tk_ring_t *ring =
+      (tk_ring_t *)tk_stats_alloc(TK_STATS_RING, allocator, sizeof(tk_ring_t));
+  if (!ring)
+    return NULL;
+  memset(ring, 0, sizeof(tk_ring_t));
+  ring->capacity = slots;
+  ring->mask = slots - 1;
+  ring->element_size = element_size;
+  ring->mode = mode;
+  ring->allocator = *allocator;
+
+  ring->data = (char *)tk_stats_alloc(TK_STATS_RING, allocator,
+                                      slots * element_size);
+  if (ring->data && mode == TK_RING_MPMC) {
+    ring->seq = (size_t *)tk_stats_alloc(TK_STATS_RING, allocator,
+                                         slots * sizeof(size_t));
+    if (ring->seq) {
+      for (size_t i = 0; i < slots; ++i)
+        ring->seq[i] = i;
+    }
+  }
+  if (!ring->data || (mode == TK_RING_MPMC && !ring->seq)) {
+    tk_ring_destroy(ring);
+    return NULL;
+  }
+  return ring;
+}
+
+void tk_ring_destroy(tk_ring_t *ring) {
+  if (!ring)
+    return;
+  tk_allocator_t allocator = ring->allocator;
+  if (ring->seq)
+    tk_stats_free(TK_STATS_RING, &allocator, ring->seq,
+                  ring->capacity * sizeof(size_t));
+  if (ring->data)
+    tk_stats_free(TK_STATS_RING, &allocator, ring->data,
+                  ring->capacity * ring->element_size);
+  tk_stats_free(TK_STATS_RING, &allocator, ring, sizeof(tk_ring_t));
+}
+
+// --- Capacity Functions ---
+
+size_t tk_ring_size(const tk_ring_t *ring) {
+  TK_ASSERT(ring);
+  // Reading 'head' first keeps the difference from going negative.
+  size_t head = TK_ATOMIC_LOAD(&ring->head, TK_ATOMIC_ACQUIRE);
+  size_t tail = TK_ATOMIC_LOAD(&ring->tail, TK_ATOMIC_ACQUIRE);
+  size_t size = tail - head;
+  return size > ring->capacity ? ring->capacity : size;
+}
+
+tk_bool tk_ring_is_empty(const tk_ring_t *ring) {
+  return tk_ring_size(ring) == 0;
+}
+
+size_t tk_ring_capacity(const tk_ring_t *ring) {
+  TK_ASSERT(ring);
+  return ring->capacity;
+}
+
+size_t tk_ring_element_size(const tk_ring_t *ring) {
+  TK_ASSERT(ring);
+  return ring->element_size;
+}
+
+// --- Producer Functions ---
+
+tk_error_t tk_ring_push(tk_ring_t *ring, const void *element) {
+  return tk_ring_push_n(ring, element, 1) == 1 ? TK_SUCCESS : TK_E_FULL;
+}
+
+size_t tk_ring_push_n(tk_ring_t *ring, const void *elements, size_t count) {
+  TK_ASSERT(ring && (elements || count == 0));
+  if (count == 0)
+    return 0;
+  if (ring->mode == TK_RING_SPSC)
+    return tk_ring_spsc_push(ring, (const char *)elements, count);
+  return tk_ring_mpmc_push(ring, (const char *)elements, count);
+}
+
+// --- Consumer Functions ---
+
+tk_error_t tk_ring_pop(tk_ring_t *ring, void *out) {
+  return tk_ring_pop_n(ring, out, 1) == 1 ? TK_SUCCESS : TK_E_EMPTY;
+}
+
+size_t tk_ring_pop_n(tk_ring_t *ring, void *out, size_t count) {
+  TK_ASSERT(ring);
+  if (count == 0)
+    return 0;
+  if (ring->mode == TK_RING_SPSC)
+    return tk_ring_spsc_pop(ring, (char *)out, count);
+  return tk_ring_mpmc_pop(ring, (char *)out, count);
+}
+
+// --- Iterator Implementation ---
+
+static void tk_ring_iter_advance(tk_iterator_t *self) {
+  tk_ring_iter_state_t *state = (tk_ring_iter_state_t *)self->state.data;
+  ++state->pos;
+}
+
+static void *tk_ring_iter_get(const tk_iterator_t *self) {
+  const tk_ring_iter_state_t *state =
+      (const tk_ring_iter_state_t *)self->state.data;
+  return tk_ring_slot(state->ring, state->pos);
+}
+
+static tk_bool tk_ring_iter_equal(const tk_iterator_t *iter1,
+                                  const tk_iterator_t *iter2) {
+  const tk_ring_iter_state_t *state1 =
+      (const tk_ring_iter_state_t *)iter1->state.data;
+  const tk_ring_iter_state_t *state2 =
+      (const tk_ring_iter_state_t *)iter2->state.data;
+  return state1->ring == state2->ring && state1->pos == state2->pos;
+}
+
+static void tk_ring_iter_clone(tk_iterator_t *dest, const tk_iterator_t *src) {
+  *dest = *src;
+}
+
+/**
+ * @brief The single, static vtable for all tk_ring_t iterators.
+ *
+ * Spelled out rather than built with TK_DEFINE_ITERATOR_VTABLE because a
+ * ring iterator is forward-only and has no retreat function.
+ */
+static const tk_iterator_vtable_t g_ring_vtable = {
+    .category = TK_ITER_FORWARD,
+    .type_name = "tk_ring_iterator",
+    .advance = tk_ring_iter_advance,
+    .get = tk_ring_iter_get,
+    .equal = tk_ring_iter_equal,
+    .clone = tk_ring_iter_clone,
+    .retreat = NULL};
+
+static tk_iterator_t tk_ring_iter_make(tk_ring_t *ring, size_t pos) {
+  tk_iterator_t iter;
+  iter.vtable = &g_ring_vtable;
+  tk_ring_iter_state_t *state = (tk_ring_iter_state_t *)iter.state.data;
+  state->ring = ring;
+  state->pos = pos;
+  return iter;
+}
+
+tk_iterator_t tk_ring_begin(tk_ring_t *ring) {
+  TK_ASSERT(ring);
+  tk_iterator_vtable_validate(&g_ring_vtable);
+  return tk_ring_iter_make(ring,
+                           TK_ATOMIC_LOAD(&ring->head, TK_ATOMIC_RELAXED));
+}
+
+tk_iterator_t tk_ring_end(tk_ring_t *ring) {
+  TK_ASSERT(ring);
+  size_t pos;
+  if (ring->mode == TK_RING_SPSC) {
+    pos = TK_ATOMIC_LOAD(&ring->tail, TK_ATOMIC_ACQUIRE);
+    ring->cached_tail = pos;
+  } else {
+    // Claimed positions may not be written yet: stop at the first slot
+    // that is not ready.
+    pos = TK_ATOMIC_LOAD(&ring->head, TK_ATOMIC_RELAXED);
+    size_t limit = pos + ring->capacity;
+    while (pos != limit && TK_ATOMIC_LOAD(&ring->seq[pos & ring->mask],
+                                          TK_ATOMIC_ACQUIRE) == pos + 1)
+      ++pos;
+  }
+  return tk_ring_iter_make(ring, pos);
+}
+
+void tk_ring_consume(tk_ring_t *ring, const tk_iterator_t *upto) {
+  TK_ASSERT(ring && upto && upto->vtable == &g_ring_vtable);
+  const tk_ring_iter_state_t *state =
+      (const tk_ring_iter_state_t *)upto->state.data;
+  TK_ASSERT(state->ring == ring);
+
+  size_t head = TK_ATOMIC_LOAD(&ring->head, TK_ATOMIC_RELAXED);
+  TK_ASSERT(state->pos - head <= ring->capacity &&
+            "tk_ring_consume: 'upto' is not a readable position.");
+  if (ring->mode == TK_RING_MPMC) {
+    for (size_t pos = head; pos != state->pos; ++pos)
+      TK_ATOMIC_STORE(&ring->seq[pos & ring->mask], pos + ring->capacity,
+                      TK_ATOMIC_RELEASE);
+  }
+  TK_ATOMIC_STORE(&ring->head, state->pos, TK_ATOMIC_RELEASE);
+}
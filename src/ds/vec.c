@@ -4,62 +4,387 @@
  * array (vector).
  *
  * @details
- * This implementation serves as a type-safe, element-oriented wrapper around
- * Sean Barrett's stb_ds.h library.
+ * The vector owns a single contiguous buffer and tracks its length and
+ * capacity natively, in element units. Element access is therefore a bounds
+ * check plus a multiply, with no per-call translation from bytes, and the
+ * buffer has no hidden header in front of the first element.
  *
- * The core design strategy is to force stb_ds to operate in a "byte mode" by
- * using a `char*` as the internal array type. Each function in this public
- * API then acts as a "translator," converting the user's element-based
- * requests (e.g., size in elements) into the byte-based operations that
- * stb_ds expects. This encapsulation is critical for providing a generic API
- * while preventing the memory corruption bugs that arise from misinterpreting
- * the unit of length or capacity.
+ * Growth is geometric: when a push needs more room, the capacity is
+ * multiplied by the vector's growth factor and never drops below
+ * TK_VEC_MIN_CAPACITY. The factor defaults to TK_VEC_GROWTH_NUM /
+ * TK_VEC_GROWTH_DEN (2x) and can be changed per vector. Capacity is only
+ * given back on request (tk_vec_shrink_to_fit) or, with auto-shrink enabled,
+ * once the size drops to 1 / TK_VEC_SHRINK_DIVISOR of the capacity. The
+ * constants can be overridden at library build time with -D. All
+ * memory is obtained from the vector's tk_allocator_t.
+ *
+ * An inline vector is allocated as one block: the handle, padded to
+ * TK_VEC_INLINE_ALIGNMENT, followed by its inline buffer. 'data' points into
+ * that buffer while the elements fit, so tk_vec_set_capacity is the single
+ * place that decides between the buffer and the heap.
+ *
+ * An aligned vector over-allocates each heap block by alignment - 1 bytes
+ * and keeps 'data' at the first boundary inside it, 'data_offset' bytes in.
+ * A padded one stores 'element_size' as the slot size (the stride) and
+ * 'value_size' as the bytes copied in and out, so every address computation
+ * is shared with regular vectors and only the copies from caller memory
+ * differ.
  */
 
-#include <stdlib.h>
+// The struct layout lives in the header's inline section; the
+// implementation always compiles against it.
+#define TK_VEC_INLINE
+
 #include <string.h>
+#include <tk/core/allocator.h>
 #include <tk/core/iterator.h>
 #include <tk/core/macros.h>
+#include <tk/core/stats.h>
 #include <tk/ds/vec.h>
 
-#define STB_DS_IMPLEMENTATION
-#include <stb/stb_ds.h>
+/**
+ * @brief Numerator of the capacity growth factor.
+ */
+#ifndef TK_VEC_GROWTH_NUM
+#define TK_VEC_GROWTH_NUM 2
+#endif
+
+/**
+ * @brief Denominator of the capacity growth factor.
+ */
+#ifndef TK_VEC_GROWTH_DEN
+#define TK_VEC_GROWTH_DEN 1
+#endif
+
+/**
+ * @brief The smallest capacity allocated by a growing push.
+ */
+#ifndef TK_VEC_MIN_CAPACITY
+#define TK_VEC_MIN_CAPACITY 4
+#endif
+
+/**
+ * @brief Auto-shrink triggers once size <= capacity / TK_VEC_SHRINK_DIVISOR.
+ * Must be greater than 2 so that a shrink (to twice the size) cannot be
+ * followed straight away by a growth.
+ */
+#ifndef TK_VEC_SHRINK_DIVISOR
+#define TK_VEC_SHRINK_DIVISOR 4
+#endif
+
+/**
+ * @brief Alignment of the inline buffer that follows an inline handle.
+ */
+#define TK_VEC_INLINE_ALIGNMENT 16
+
+/**
+ * @brief Handle size rounded up so the inline buffer is aligned.
+ */
+#define TK_VEC_INLINE_HEADER                                                   \
+  ((sizeof(tk_vec_t) + TK_VEC_INLINE_ALIGNMENT - 1) &                          \
+   ~(size_t)(TK_VEC_INLINE_ALIGNMENT - 1))
+
+// --- Helper Functions ---
+
+static inline char *tk_vec_inline_buffer(const tk_vec_t *vec) {
+  return (char *)vec + TK_VEC_INLINE_HEADER;
+}
+
+static inline tk_bool tk_vec_data_is_inline(const tk_vec_t *vec) {
+  return vec->inline_capacity > 0 && vec->data == tk_vec_inline_buffer(vec);
+}
+
+/**
+ * @brief Returns the size of the heap block that holds `capacity` elements,
+ * including the slack an aligned vector needs to reach its boundary.
+ */
+static inline size_t tk_vec_storage_bytes(const tk_vec_t *vec,
+                                          size_t capacity) {
+  if (capacity == 0)
+    return 0;
+  size_t slack = vec->alignment ? vec->alignment - 1 : 0;
+  return capacity * vec->element_size + slack;
+}
+
+/**
+ * @brief Frees the heap storage, if any. Inline storage is left alone.
+ */
+static void tk_vec_free_storage(tk_vec_t *vec) {
+  if (!vec->data || tk_vec_data_is_inline(vec))
+    return;
+  tk_stats_free(TK_STATS_VEC, &vec->allocator, vec->data - vec->data_offset,
+                tk_vec_storage_bytes(vec, vec->capacity));
+}
+
+/**
+ * @brief Copies one element from caller memory into the slot at 'slot',
+ * zeroing the padding of a padded slot.
+ */
+static inline void tk_vec_store(const tk_vec_t *vec, char *slot,
+                                const void *element) {
+  memcpy(slot, element, vec->value_size);
+  if (vec->value_size < vec->element_size)
+    memset(slot + vec->value_size, 0, vec->element_size - vec->value_size);
+}
+
+/**
+ * @brief Returns the size the handle was allocated with.
+ */
+static inline size_t tk_vec_handle_size(const tk_vec_t *vec) {
+  if (vec->inline_capacity == 0)
+    return sizeof(tk_vec_t);
+  return TK_VEC_INLINE_HEADER + vec->inline_capacity * vec->element_size;
+}
+
+/**
+ * @brief Reallocates the storage to hold exactly `capacity` elements.
+ * @return TK_SUCCESS, or TK_E_NOMEM if the byte count would overflow or the
+ * allocator fails (the vector is left unchanged).
+ */
+static tk_error_t tk_vec_set_capacity(tk_vec_t *vec, size_t capacity) {
+  TK_ASSERT(capacity >= vec->size);
+  if (vec->inline_capacity > 0 && capacity <= vec->inline_capacity) {
+    // Small enough for the inline buffer: move home from the heap, if needed.
+    if (!tk_vec_data_is_inline(vec)) {
+      char *buffer = tk_vec_inline_buffer(vec);
+      if (vec->size)
+        memcpy(buffer, vec->data, vec->size * vec->element_size);
+      TK_STATS_COPY(TK_STATS_VEC, vec->size);
+      tk_vec_free_storage(vec);
+      vec->data = buffer;
+    }
+    vec->capacity = vec->inline_capacity;
+    return TK_SUCCESS;
+  }
+  if (capacity == 0) {
+    // Realloc to zero bytes is not portable; release the storage instead.
+    tk_vec_free_storage(vec);
+    vec->data = NULL;
+    vec->capacity = 0;
+    vec->data_offset = 0;
+    return TK_SUCCESS;
+  }
+  size_t slack = vec->alignment ? vec->alignment - 1 : 0;
+  if (capacity > (SIZE_MAX - slack) / vec->element_size)
+    return TK_E_NOMEM;
+
+  if (tk_vec_data_is_inline(vec)) {
+    // Spill: the inline buffer cannot be reallocated, only copied out.
+    char *data = (char *)tk_stats_alloc(TK_STATS_VEC, &vec->allocator,
+                                        capacity * vec->element_size);
+    if (!data)
+      return TK_E_NOMEM;
+    memcpy(data, vec->data, vec->size * vec->element_size);
+    TK_STATS_COPY(TK_STATS_VEC, vec->size);
+    vec->data = data;
+    vec->capacity = capacity;
+    return TK_SUCCESS;
+  }
+
+  char *block = vec->data ? vec->data - vec->data_offset : NULL;
+  block = (char *)tk_stats_realloc(TK_STATS_VEC, &vec->allocator, block,
+                                   tk_vec_storage_bytes(vec, vec->capacity),
+                                   tk_vec_storage_bytes(vec, capacity));
+  if (!block)
+    return TK_E_NOMEM;
+
+  if (vec->alignment) {
+    // The block may have moved to an address with a different distance to
+    // the next boundary; realloc kept the elements at the old distance.
+    size_t offset = (size_t)(-(uintptr_t)block & (vec->alignment - 1));
+    if (offset != vec->data_offset && vec->size) {
+      memmove(block + offset, block + vec->data_offset,
+              vec->size * vec->element_size);
+      TK_STATS_COPY(TK_STATS_VEC, vec->size);
+    }
+    vec->data_offset = offset;
+  }
+  vec->data = block + vec->data_offset;
+  vec->capacity = capacity;
+  return TK_SUCCESS;
+}
+
+/**
+ * @brief Ensures room for `extra` more elements with a single geometric
+ * growth, so bulk operations reallocate at most once and pushes stay O(1)
+ * amortized.
+ * @return TK_SUCCESS, or TK_E_NOMEM if the size would overflow or the
+ * reallocation fails.
+ */
+static tk_error_t tk_vec_grow_for(tk_vec_t *vec, size_t extra) {
+  if (extra > SIZE_MAX - vec->size)
+    return TK_E_NOMEM;
+  size_t needed = vec->size + extra;
+  if (needed <= vec->capacity)
+    return TK_SUCCESS;
+
+  size_t capacity = vec->capacity;
+  if (capacity <= SIZE_MAX / vec->growth_num)
+    capacity = capacity * vec->growth_num / vec->growth_den;
+  if (capacity < needed)
+    capacity = needed;
+  if (capacity < TK_VEC_MIN_CAPACITY)
+    capacity = TK_VEC_MIN_CAPACITY;
+  return tk_vec_set_capacity(vec, capacity);
+}
+
+/**
+ * @brief Gives storage back after elements were removed, if auto-shrink is
+ * enabled and the size has fallen to the shrink threshold. Failure is
+ * harmless (the vector keeps its storage), so it is ignored.
+ */
+static void tk_vec_maybe_shrink(tk_vec_t *vec) {
+  if (!vec->auto_shrink || vec->capacity <= TK_VEC_MIN_CAPACITY ||
+      vec->size > vec->capacity / TK_VEC_SHRINK_DIVISOR)
+    return;
+
+  size_t capacity = vec->size * 2;
+  if (capacity < TK_VEC_MIN_CAPACITY)
+    capacity = TK_VEC_MIN_CAPACITY;
+  (void)tk_vec_set_capacity(vec, capacity);
+}
 
 /**
- * @struct tk_vec_t
- * @brief The opaque struct for the dynamic array (vector).
+ * @brief Frees the storage and the handle of `vec`.
  */
-struct tk_vec_t {
-  /**
-   * @brief The internal stb_ds dynamic array.
-   * @details Stored as a `char*` to force all stb_ds macros (arrlen, arrcap)
-   * to operate on a byte-level, which is the key to our generic
-   * implementation.
-   */
-  char *stb_array;
-
-  /**
-   * @brief The size of a single element in bytes.
-   * @details This is the "translation factor" used in almost every function
-   * to convert between the public element count and the internal byte count.
-   */
-  size_t element_size;
-};
+static void tk_vec_release(tk_vec_t *vec) {
+  tk_vec_free_storage(vec);
+
+  // Free through a copy, since the handle that holds the allocator is
+  // being released.
+  tk_allocator_t allocator = vec->allocator;
+  tk_stats_free(TK_STATS_VEC, &allocator, vec, tk_vec_handle_size(vec));
+}
+
+/**
+ * @brief Forgets the storage (without freeing it), leaving an empty vector
+ * on its inline buffer, if it has one.
+ */
+static void tk_vec_reset_storage(tk_vec_t *vec) {
+  vec->data = vec->inline_capacity ? tk_vec_inline_buffer(vec) : NULL;
+  vec->size = 0;
+  vec->capacity = vec->inline_capacity;
+  vec->data_offset = 0;
+}
+
+/**
+ * @brief Moves inline elements to an exactly sized heap buffer, so the
+ * storage can leave the handle. A no-op for heap storage.
+ * @return TK_SUCCESS, or TK_E_NOMEM (the vector is left unchanged).
+ */
+static tk_error_t tk_vec_spill(tk_vec_t *vec) {
+  if (!tk_vec_data_is_inline(vec))
+    return TK_SUCCESS;
+  char *data = NULL;
+  if (vec->size) {
+    data = (char *)tk_stats_alloc(TK_STATS_VEC, &vec->allocator,
+                                  vec->size * vec->element_size);
+    if (!data)
+      return TK_E_NOMEM;
+    memcpy(data, vec->data, vec->size * vec->element_size);
+    TK_STATS_COPY(TK_STATS_VEC, vec->size);
+  }
+  vec->data = data;
+  vec->capacity = vec->size;
+  return TK_SUCCESS;
+}
+
+/**
+ * @brief Checks that storage can move between two vectors: same element
+ * size, the same layout and the same allocator.
+ */
+static tk_bool tk_vec_compatible(const tk_vec_t *a, const tk_vec_t *b) {
+  return a->element_size == b->element_size &&
+         a->value_size == b->value_size && a->alignment == b->alignment &&
+         a->allocator.alloc == b->allocator.alloc &&
+         a->allocator.realloc == b->allocator.realloc &&
+         a->allocator.free == b->allocator.free &&
+         a->allocator.ctx == b->allocator.ctx;
+}
 
 // --- Lifecycle Functions ---
 
 tk_vec_t *tk_vec_create(size_t element_size) {
+  return tk_vec_create_with_allocator(element_size, tk_allocator_default());
+}
+
+tk_vec_t *tk_vec_create_with_allocator(size_t element_size,
+                                       const tk_allocator_t *allocator) {
+  return tk_vec_create_inline_with_allocator(element_size, 0, allocator);
+}
+
+tk_vec_t *tk_vec_create_inline(size_t element_size, size_t inline_bytes) {
+  return tk_vec_create_inline_with_allocator(element_size, inline_bytes,
+                                             tk_allocator_default());
+}
+
+tk_vec_t *tk_vec_create_inline_with_allocator(size_t element_size,
+                                              size_t inline_bytes,
+                                              const tk_allocator_t *allocator) {
   TK_ASSERT(element_size > 0);
-  if (element_size == 0)
+  tk_allocator_validate(allocator);
+  if (element_size == 0 || !allocator)
     return NULL;
 
-  tk_vec_t *vec = (tk_vec_t *)malloc(sizeof(tk_vec_t));
+  size_t inline_capacity = inline_bytes / element_size;
+  size_t handle_size = sizeof(tk_vec_t);
+  if (inline_capacity > 0) {
+    if (inline_capacity * element_size > SIZE_MAX - TK_VEC_INLINE_HEADER)
+      return NULL;
+    handle_size = TK_VEC_INLINE_HEADER + inline_capacity * element_size;
+  }
+
+  tk_vec_t *vec = (tk_vec_t *)tk_stats_alloc(TK_STATS_VEC, allocator,
+                                             handle_size);
   if (!vec)
     return NULL;
 
-  // Initialize the internal array to NULL, as expected by stb_ds.
-  vec->stb_array = NULL;
+  // No storage is allocated until the first element arrives; an inline
+  // vector starts out with its buffer.
+  vec->inline_capacity = inline_capacity;
+  vec->data = inline_capacity ? tk_vec_inline_buffer(vec) : NULL;
+  vec->size = 0;
+  vec->capacity = inline_capacity;
   vec->element_size = element_size;
+  vec->value_size = element_size;
+  vec->alignment = 0;
+  vec->data_offset = 0;
+  vec->allocator = *allocator;
+  vec->growth_num = TK_VEC_GROWTH_NUM;
+  vec->growth_den = TK_VEC_GROWTH_DEN;
+  vec->auto_shrink = false;
+  return vec;
+}
+
+tk_vec_t *tk_vec_create_aligned(size_t element_size, size_t alignment,
+                                unsigned flags) {
+  return tk_vec_create_aligned_with_allocator(element_size, alignment, flags,
+                                              tk_allocator_default());
+}
+
+tk_vec_t *tk_vec_create_aligned_with_allocator(
+    size_t element_size, size_t alignment, unsigned flags,
+    const tk_allocator_t *allocator) {
+  TK_ASSERT(element_size > 0);
+  TK_ASSERT(alignment > 0 && (alignment & (alignment - 1)) == 0 &&
+            "tk_vec_create_aligned: alignment must be a power of two");
+  if (element_size == 0 || alignment == 0 ||
+      (alignment & (alignment - 1)) != 0)
+    return NULL;
+
+  size_t stride = element_size;
+  if (flags & TK_VEC_PAD_ELEMENTS) {
+    if (element_size > SIZE_MAX - (alignment - 1))
+      return NULL;
+    stride = (element_size + alignment - 1) & ~(alignment - 1);
+  }
+
+  // Storage is allocated lazily, so nothing needs aligning yet.
+  tk_vec_t *vec = tk_vec_create_with_allocator(stride, allocator);
+  if (!vec)
+    return NULL;
+  vec->value_size = element_size;
+  vec->alignment = alignment > 1 ? alignment : 0;
   return vec;
 }
 
@@ -67,9 +392,8 @@ void tk_vec_destroy(tk_vec_t *vec) {
   if (!vec)
     return;
 
-  // arrfree safely handles the internal stb_ds array.
-  arrfree(vec->stb_array);
-  free(vec);
+  // Releases the storage and the handle.
+  tk_vec_release(vec);
 }
 
 /**
@@ -82,78 +406,104 @@ void tk_vec_destroy_full(tk_vec_t *vec, tk_element_destroyer_t destroyer) {
   // If a destroyer is provided, iterate and call it for each
   // element.
   if (destroyer) {
-    size_t size = tk_vec_size(vec);
-    for (size_t i = 0; i < size; ++i) {
-      // tk_vec_at returns a pointer TO the element in the array
-      void *element_ptr = tk_vec_at(vec, i);
-      if (element_ptr) {
-        destroyer(element_ptr);
-      }
+    for (size_t i = 0; i < vec->size; ++i) {
+      // Pass a pointer TO the element in the array
+      destroyer(vec->data + i * vec->element_size);
     }
   }
 
   // Now, safely free the vector's internal array and the struct itself.
-  arrfree(vec->stb_array);
-  free(vec);
+  tk_vec_release(vec);
 }
 
 // --- Capacity Functions ---
 
 size_t tk_vec_size(const tk_vec_t *vec) {
   TK_ASSERT(vec);
-  // Translation: stb_ds's arrlenu returns the length in bytes. We convert
-  // it to the number of elements for the public API.
-  return arrlenu(vec->stb_array) / vec->element_size;
+  return vec->size;
 }
 
 tk_bool tk_vec_is_empty(const tk_vec_t *vec) {
   TK_ASSERT(vec);
-  // This function is correct because it relies on our translated tk_vec_size.
-  return tk_vec_size(vec) == 0;
+  return vec->size == 0;
 }
 
 size_t tk_vec_capacity(const tk_vec_t *vec) {
   TK_ASSERT(vec);
-  // Translation: stb_ds's arrcap returns the capacity in bytes. We convert
-  // it to the number of elements.
-  return arrcap(vec->stb_array) / vec->element_size;
+  return vec->capacity;
 }
 
 tk_error_t tk_vec_reserve(tk_vec_t *vec, size_t n) {
   TK_ASSERT(vec);
-  // Translation: The user requests capacity for `n` elements. We must ask
-  // stb_ds for `n * element_size` bytes of capacity.
-  arrsetcap(vec->stb_array, n * vec->element_size);
-  if (n > 0 && tk_vec_capacity(vec) < n) {
-    return TK_E_NOMEM;
-  }
+  // Reserving never shrinks; growing allocates exactly n elements.
+  if (n <= vec->capacity)
+    return TK_SUCCESS;
+  return tk_vec_set_capacity(vec, n);
+}
+
+tk_error_t tk_vec_shrink_to_fit(tk_vec_t *vec) {
+  TK_ASSERT(vec);
+  if (vec->size == vec->capacity)
+    return TK_SUCCESS;
+  return tk_vec_set_capacity(vec, vec->size);
+}
+
+size_t tk_vec_stride(const tk_vec_t *vec) {
+  TK_ASSERT(vec);
+  return vec->element_size;
+}
+
+tk_bool tk_vec_is_inline(const tk_vec_t *vec) {
+  TK_ASSERT(vec);
+  return tk_vec_data_is_inline(vec);
+}
+
+// --- Growth Policy ---
+
+tk_error_t tk_vec_set_growth_factor(tk_vec_t *vec, unsigned num,
+                                    unsigned den) {
+  TK_ASSERT(vec);
+  // The factor must be > 1, or a full vector could never grow.
+  if (den == 0 || num <= den)
+    return TK_E_INVALID_ARG;
+  vec->growth_num = num;
+  vec->growth_den = den;
   return TK_SUCCESS;
 }
 
+void tk_vec_set_auto_shrink(tk_vec_t *vec, tk_bool enable) {
+  TK_ASSERT(vec);
+  vec->auto_shrink = enable;
+  if (enable)
+    tk_vec_maybe_shrink(vec);
+}
+
 // --- Element Access Functions ---
-// Note: These functions are inherently correct because their byte-offset
-// arithmetic aligns perfectly with our `char*` internal storage.
 
 void *tk_vec_at(const tk_vec_t *vec, size_t index) {
   TK_ASSERT(vec);
-  if (index >= tk_vec_size(vec))
+  if (index >= vec->size)
     return NULL;
-  return vec->stb_array + (index * vec->element_size);
+  return vec->data + index * vec->element_size;
 }
 
 void *tk_vec_front(const tk_vec_t *vec) {
   TK_ASSERT(vec);
-  if (tk_vec_is_empty(vec))
+  if (vec->size == 0)
     return NULL;
-  return vec->stb_array;
+  return vec->data;
 }
 
 void *tk_vec_back(const tk_vec_t *vec) {
   TK_ASSERT(vec);
-  if (tk_vec_is_empty(vec))
+  if (vec->size == 0)
     return NULL;
-  size_t last_index = tk_vec_size(vec) - 1;
-  return vec->stb_array + (last_index * vec->element_size);
+  return vec->data + (vec->size - 1) * vec->element_size;
+}
+
+void *tk_vec_data(const tk_vec_t *vec) {
+  TK_ASSERT(vec);
+  return vec->data;
 }
 
 // --- Modifiers ---
@@ -161,40 +511,244 @@ void *tk_vec_back(const tk_vec_t *vec) {
 tk_error_t tk_vec_push_back(tk_vec_t *vec, const void *element) {
   TK_ASSERT(vec && element);
 
-  // This is the safest and most critical part of the implementation.
-  // We use `arraddnptr` to grow the byte array by `element_size` bytes.
-  // This macro correctly handles all internal logic for reallocation and
-  // updating the byte-length in the stb_ds header, completely avoiding the
-  // memory corruption bugs caused by manual header manipulation.
-  void *dest = arraddnptr(vec->stb_array, vec->element_size);
-
-  // In the current stb_ds implementation, arraddnptr on failure returns the
-  // original pointer without growing capacity. A capacity check is the most
-  // reliable way to detect allocation failure.
-  if (tk_vec_capacity(vec) * vec->element_size < arrlenu(vec->stb_array)) {
-    return TK_E_NOMEM;
+  if (vec->size == vec->capacity) {
+    tk_error_t err = tk_vec_grow_for(vec, 1);
+    if (err != TK_SUCCESS)
+      return err;
   }
 
-  // Now it's safe to copy the user's data into the new space.
-  memcpy(dest, element, vec->element_size);
+  tk_vec_store(vec, vec->data + vec->size * vec->element_size, element);
+  TK_STATS_COPY(TK_STATS_VEC, 1);
+  vec->size++;
   return TK_SUCCESS;
 }
 
+void *tk_vec_emplace_back(tk_vec_t *vec) {
+  TK_ASSERT(vec);
+
+  if (vec->size == vec->capacity) {
+    if (tk_vec_grow_for(vec, 1) != TK_SUCCESS)
+      return NULL;
+  }
+
+  // The slot is handed out uninitialized (bar the padding, which stays
+  // zeroed); the caller constructs in place.
+  char *slot = vec->data + vec->size++ * vec->element_size;
+  if (vec->value_size < vec->element_size)
+    memset(slot + vec->value_size, 0, vec->element_size - vec->value_size);
+  return slot;
+}
+
 void tk_vec_pop_back(tk_vec_t *vec) {
   TK_ASSERT(vec);
-  if (!tk_vec_is_empty(vec)) {
-    // Translation: To pop one element, we must reduce the internal byte
-    // length by the size of one element.
-    size_t new_len_in_bytes = arrlenu(vec->stb_array) - vec->element_size;
-    arrsetlen(vec->stb_array, new_len_in_bytes);
+  if (vec->size > 0) {
+    vec->size--;
+    tk_vec_maybe_shrink(vec);
   }
 }
 
 void tk_vec_clear(tk_vec_t *vec) {
   TK_ASSERT(vec);
-  // This is inherently correct, as setting the byte-length to 0 clears the
-  // vector regardless of element size.
-  arrsetlen(vec->stb_array, 0);
+  // The capacity is kept for reuse, unless auto-shrink gives it back.
+  vec->size = 0;
+  tk_vec_maybe_shrink(vec);
+}
+
+// --- Bulk Modifiers ---
+
+tk_error_t tk_vec_push_back_n(tk_vec_t *vec, const void *elements, size_t n) {
+  TK_ASSERT(vec && (elements || n == 0));
+  return tk_vec_insert_range(vec, vec->size, elements, n);
+}
+
+tk_error_t tk_vec_insert_range(tk_vec_t *vec, size_t at, const void *src,
+                               size_t n) {
+  TK_ASSERT(vec && (src || n == 0));
+  if (at > vec->size)
+    return TK_E_OUT_OF_BOUNDS;
+  if (n == 0)
+    return TK_SUCCESS;
+
+  tk_error_t err = tk_vec_grow_for(vec, n);
+  if (err != TK_SUCCESS)
+    return err;
+
+  // Open a gap of n elements at 'at' (no-op when appending), then fill it
+  // with a single copy, or slot by slot when the source is packed tighter
+  // than padded slots.
+  char *gap = vec->data + at * vec->element_size;
+  memmove(gap + n * vec->element_size, gap,
+          (vec->size - at) * vec->element_size);
+  if (vec->value_size == vec->element_size) {
+    memcpy(gap, src, n * vec->element_size);
+  } else {
+    for (size_t i = 0; i < n; ++i)
+      tk_vec_store(vec, gap + i * vec->element_size,
+                   (const char *)src + i * vec->value_size);
+  }
+  TK_STATS_COPY(TK_STATS_VEC, vec->size - at + n);
+  vec->size += n;
+  return TK_SUCCESS;
+}
+
+tk_error_t tk_vec_erase_range(tk_vec_t *vec, size_t at, size_t n) {
+  TK_ASSERT(vec);
+  if (at > vec->size || n > vec->size - at)
+    return TK_E_OUT_OF_BOUNDS;
+  if (n == 0)
+    return TK_SUCCESS;
+
+  // Close the gap with a single move of the tail.
+  char *gap = vec->data + at * vec->element_size;
+  memmove(gap, gap + n * vec->element_size,
+          (vec->size - at - n) * vec->element_size);
+  TK_STATS_COPY(TK_STATS_VEC, vec->size - at - n);
+  vec->size -= n;
+  tk_vec_maybe_shrink(vec);
+  return TK_SUCCESS;
+}
+
+tk_error_t tk_vec_resize(tk_vec_t *vec, size_t n, const void *fill) {
+  TK_ASSERT(vec);
+  if (n <= vec->size) {
+    vec->size = n;
+    tk_vec_maybe_shrink(vec);
+    return TK_SUCCESS;
+  }
+
+  tk_error_t err = tk_vec_grow_for(vec, n - vec->size);
+  if (err != TK_SUCCESS)
+    return err;
+
+  char *first = vec->data + vec->size * vec->element_size;
+  size_t new_bytes = (n - vec->size) * vec->element_size;
+  if (!fill) {
+    memset(first, 0, new_bytes);
+  } else {
+    // Copy the fill value once, then keep doubling the initialized prefix so
+    // the new region is filled with O(log n) memcpy calls.
+    tk_vec_store(vec, first, fill);
+    size_t done = vec->element_size;
+    while (done < new_bytes) {
+      size_t chunk = done < new_bytes - done ? done : new_bytes - done;
+      memcpy(first + done, first, chunk);
+      done += chunk;
+    }
+    TK_STATS_COPY(TK_STATS_VEC, n - vec->size);
+  }
+  vec->size = n;
+  return TK_SUCCESS;
+}
+
+tk_error_t tk_vec_assign(tk_vec_t *vec, const void *src, size_t n) {
+  TK_ASSERT(vec && (src || n == 0));
+  vec->size = 0;
+  tk_error_t err = tk_vec_insert_range(vec, 0, src, n);
+  tk_vec_maybe_shrink(vec);
+  return err;
+}
+
+// --- Ownership Transfer ---
+
+tk_vec_t *tk_vec_from_buffer(size_t element_size, void *buffer, size_t size,
+                             size_t capacity) {
+  return tk_vec_from_buffer_with_allocator(element_size, buffer, size,
+                                           capacity, tk_allocator_default());
+}
+
+tk_vec_t *tk_vec_from_buffer_with_allocator(size_t element_size, void *buffer,
+                                            size_t size, size_t capacity,
+                                            const tk_allocator_t *allocator) {
+  TK_ASSERT(size <= capacity && (buffer || capacity == 0));
+  if (size > capacity || (!buffer && capacity > 0))
+    return NULL;
+  tk_vec_t *vec = tk_vec_create_with_allocator(element_size, allocator);
+  if (!vec)
+    return NULL;
+  vec->data = (char *)buffer;
+  vec->size = size;
+  vec->capacity = capacity;
+  // The vector owns the buffer from here on, as if it had allocated it.
+  if (buffer)
+    TK_STATS_ALLOC(TK_STATS_VEC, capacity * element_size);
+  return vec;
+}
+
+tk_error_t tk_vec_take_buffer(tk_vec_t *vec, void **buffer, size_t *size,
+                              size_t *capacity) {
+  TK_ASSERT(vec && buffer);
+  if (vec->alignment)
+    return TK_E_INVALID_ARG;
+  tk_error_t err = tk_vec_spill(vec);
+  if (err != TK_SUCCESS)
+    return err;
+  *buffer = vec->data;
+  if (size)
+    *size = vec->size;
+  if (capacity)
+    *capacity = vec->capacity;
+  if (vec->data)
+    TK_STATS_FREE(TK_STATS_VEC, vec->capacity * vec->element_size);
+  tk_vec_reset_storage(vec);
+  return TK_SUCCESS;
+}
+
+tk_error_t tk_vec_swap(tk_vec_t *a, tk_vec_t *b) {
+  TK_ASSERT(a && b);
+  if (!tk_vec_compatible(a, b))
+    return TK_E_INVALID_ARG;
+  if (a == b)
+    return TK_SUCCESS;
+  // Spilling is only needed for inline elements, and leaves the elements
+  // where they were if the second spill fails.
+  tk_error_t err = tk_vec_spill(a);
+  if (err == TK_SUCCESS)
+    err = tk_vec_spill(b);
+  if (err != TK_SUCCESS)
+    return err;
+
+  char *data = a->data;
+  size_t size = a->size, capacity = a->capacity, offset = a->data_offset;
+  a->data = b->data;
+  a->size = b->size;
+  a->capacity = b->capacity;
+  a->data_offset = b->data_offset;
+  b->data = data;
+  b->size = size;
+  b->capacity = capacity;
+  b->data_offset = offset;
+
+  // Moving into an inline buffer never allocates, so it cannot fail.
+  if (a->inline_capacity > 0 && a->size <= a->inline_capacity)
+    (void)tk_vec_set_capacity(a, a->size);
+  if (b->inline_capacity > 0 && b->size <= b->inline_capacity)
+    (void)tk_vec_set_capacity(b, b->size);
+  return TK_SUCCESS;
+}
+
+tk_error_t tk_vec_move(tk_vec_t *dest, tk_vec_t *src) {
+  TK_ASSERT(dest && src);
+  if (!tk_vec_compatible(dest, src))
+    return TK_E_INVALID_ARG;
+  if (dest == src)
+    return TK_SUCCESS;
+
+  if (tk_vec_data_is_inline(src)) {
+    // Inline elements are few by construction; copying them is cheap.
+    tk_error_t err = tk_vec_assign(dest, src->data, src->size);
+    if (err != TK_SUCCESS)
+      return err;
+    src->size = 0;
+    return TK_SUCCESS;
+  }
+
+  tk_vec_free_storage(dest);
+  dest->data = src->data;
+  dest->size = src->size;
+  dest->capacity = src->capacity;
+  dest->data_offset = src->data_offset;
+  tk_vec_reset_storage(src);
+  return TK_SUCCESS;
 }
 
 // --- Iterator Implementation ---
@@ -268,16 +822,72 @@ static void tk_vec_iter_clone(tk_iterator_t *dest, const tk_iterator_t *src) {
   *dest = *src;
 }
 
+/**
+ * @brief (vtable) Exposes the element pointer and stride of the iterator.
+ */
+static void *tk_vec_iter_contiguous(const tk_iterator_t *self,
+                                    size_t *stride) {
+  const tk_vec_iter_state_t *state =
+      (const tk_vec_iter_state_t *)self->state.data;
+  *stride = state->element_size;
+  return state->ptr;
+}
+
+/**
+ * @brief (vtable) Moves the vector iterator by 'n' elements.
+ */
+static void tk_vec_iter_seek(tk_iterator_t *self, ptrdiff_t n) {
+  tk_vec_iter_state_t *state = (tk_vec_iter_state_t *)self->state.data;
+  state->ptr += n * (ptrdiff_t)state->element_size;
+}
+
+/**
+ * @brief (vtable) Returns the number of elements between two iterators.
+ */
+static ptrdiff_t tk_vec_iter_distance(const tk_iterator_t *from,
+                                      const tk_iterator_t *to) {
+  const tk_vec_iter_state_t *state1 =
+      (const tk_vec_iter_state_t *)from->state.data;
+  const tk_vec_iter_state_t *state2 =
+      (const tk_vec_iter_state_t *)to->state.data;
+  return (state2->ptr - state1->ptr) / (ptrdiff_t)state1->element_size;
+}
+
+/**
+ * @brief (vtable) Returns the element 'n' positions from the iterator.
+ */
+static void *tk_vec_iter_at_offset(const tk_iterator_t *self, ptrdiff_t n) {
+  const tk_vec_iter_state_t *state =
+      (const tk_vec_iter_state_t *)self->state.data;
+  return state->ptr + n * (ptrdiff_t)state->element_size;
+}
+
+/**
+ * @brief (vtable) Hands out pointers to the next elements, up to 'end'.
+ */
+static size_t tk_vec_iter_next_block(tk_iterator_t *self,
+                                     const tk_iterator_t *end, void **ptrs,
+                                     size_t max) {
+  tk_vec_iter_state_t *state = (tk_vec_iter_state_t *)self->state.data;
+  const tk_vec_iter_state_t *last =
+      (const tk_vec_iter_state_t *)end->state.data;
+  size_t left = (size_t)(last->ptr - state->ptr) / state->element_size;
+  size_t n = left < max ? left : max;
+  for (size_t i = 0; i < n; ++i, state->ptr += state->element_size)
+    ptrs[i] = state->ptr;
+  return n;
+}
+
 /**
  * @brief The single, static vtable for all tk_vec_t iterators.
  *
- * This uses the TK_DEFINE_ITERATOR_VTABLE macro to ensure all
- * function pointers and metadata fields are correctly initialized.
+ * This uses the TK_DEFINE_BLOCK_CONTIGUOUS_ITERATOR_VTABLE macro to ensure
+ * all function pointers and metadata fields are correctly initialized,
+ * including the contiguous fast-path hooks and the batch function.
  */
 static const tk_iterator_vtable_t g_vec_vtable =
-    TK_DEFINE_ITERATOR_VTABLE(tk_vec_iter,           /* Function Prefix */
-                              TK_ITER_RANDOM_ACCESS, /* Category */
-                              "tk_vec_iterator");    /* Type Name */
+    TK_DEFINE_BLOCK_CONTIGUOUS_ITERATOR_VTABLE(tk_vec_iter,        /* Prefix */
+                                               "tk_vec_iterator"); /* Name */
 
 // --- Public iterator function implementations ---
 
@@ -295,7 +905,7 @@ tk_iterator_t tk_vec_begin(tk_vec_t *vec) {
 
   // Fill the state
   state->element_size = vec->element_size;
-  state->ptr = vec->stb_array; // 'stb_array' points to the first element
+  state->ptr = vec->data; // 'data' points to the first element
 
   return iter;
 }
@@ -312,7 +922,7 @@ tk_iterator_t tk_vec_end(tk_vec_t *vec) {
   // Fill the state
   state->element_size = vec->element_size;
   // The "end" iterator points *past* the last element.
-  state->ptr = vec->stb_array + (tk_vec_size(vec) * vec->element_size);
+  state->ptr = vec->data + vec->size * vec->element_size;
 
   return iter;
 }
@@ -154,3 +154,115 @@ Test(list_algo_suite, find_if_first_element) {
   cr_assert_eq(*(int *)tk_iter_get(&result), 10,
                "The algorithm found the wrong element.");
 }
+
+/**
+ * @brief Test that list iterators do not claim contiguous storage, so the
+ * algorithms keep using the generic vtable loop.
+ */
+Test(list_algo_suite, list_is_not_contiguous) {
+  tk_iterator_t begin = tk_list_begin(list_int_algo);
+  size_t stride = 0;
+  cr_assert_null(tk_iter_contiguous(&begin, &stride));
+  cr_assert_eq(stride, 0, "stride must be left untouched.");
+}
+
+/**
+ * @brief Test `tk_algo_find_if` on a list long enough to be scanned in
+ * several `next_block` batches, with matches on both sides of a boundary.
+ */
+Test(list_algo_suite, find_if_across_blocks) {
+  for (int i = 0; i < 3 * TK_ALGO_BLOCK; ++i) {
+    int val = i == TK_ALGO_BLOCK + 3 ? 99 : 0;
+    tk_list_push_back(list_int_algo, &val);
+  }
+
+  tk_iterator_t end = tk_list_end(list_int_algo);
+  tk_iterator_t result =
+      tk_algo_find_if(tk_list_begin(list_int_algo), end, find_99);
+  cr_assert_not(tk_iter_equal(&result, &end));
+  cr_assert_eq(*(int *)tk_iter_get(&result), 99);
+
+  // The returned iterator is positioned on the match, not past its block.
+  tk_iter_prev(&result);
+  cr_assert_eq(*(int *)tk_iter_get(&result), 0);
+  tk_iter_next(&result);
+  tk_iter_next(&result);
+  cr_assert_eq(*(int *)tk_iter_get(&result), 0);
+}
+
+// --- A minimal array iterator without a next_block function ---
+
+typedef struct {
+  int *ptr;
+} int_arr_state_t;
+
+static void int_arr_advance(tk_iterator_t *self) {
+  ((int_arr_state_t *)self->state.data)->ptr++;
+}
+
+static void int_arr_retreat(tk_iterator_t *self) {
+  ((int_arr_state_t *)self->state.data)->ptr--;
+}
+
+static void *int_arr_get(const tk_iterator_t *self) {
+  return ((const int_arr_state_t *)self->state.data)->ptr;
+}
+
+static tk_bool int_arr_equal(const tk_iterator_t *a, const tk_iterator_t *b) {
+  return ((const int_arr_state_t *)a->state.data)->ptr ==
+         ((const int_arr_state_t *)b->state.data)->ptr;
+}
+
+static void int_arr_clone(tk_iterator_t *dest, const tk_iterator_t *src) {
+  *dest = *src;
+}
+
+// The jump functions are only used by the random-access vtable below.
+static void int_arr_seek(tk_iterator_t *self, ptrdiff_t n) {
+  ((int_arr_state_t *)self->state.data)->ptr += n;
+}
+
+static ptrdiff_t int_arr_distance(const tk_iterator_t *from,
+                                  const tk_iterator_t *to) {
+  return ((const int_arr_state_t *)to->state.data)->ptr -
+         ((const int_arr_state_t *)from->state.data)->ptr;
+}
+
+static void *int_arr_at_offset(const tk_iterator_t *self, ptrdiff_t n) {
+  return ((const int_arr_state_t *)self->state.data)->ptr + n;
+}
+
+static const tk_iterator_vtable_t g_int_arr_vtable = TK_DEFINE_ITERATOR_VTABLE(
+    int_arr, TK_ITER_BIDIRECTIONAL, "int_array_iterator");
+
+static tk_iterator_t int_arr_make(int *ptr) {
+  tk_iterator_t iter;
+  iter.vtable = &g_int_arr_vtable;
+  ((int_arr_state_t *)iter.state.data)->ptr = ptr;
+  return iter;
+}
+
+/**
+ * @brief Test that an iterator built with `TK_DEFINE_ITERATOR_VTABLE`, which
+ * provides no batch function, falls back to stepping inside
+ * `tk_algo_find_if`.
+ */
+Test(list_algo_misc, find_if_without_next_block) {
+  cr_assert_null(g_int_arr_vtable.next_block);
+  int values[3 * TK_ALGO_BLOCK] = {0};
+  values[2 * TK_ALGO_BLOCK + 1] = 99;
+  tk_iterator_t end = int_arr_make(values + 3 * TK_ALGO_BLOCK);
+  tk_iterator_t result = tk_algo_find_if(int_arr_make(values), end, find_99);
+  cr_assert_eq(tk_iter_get(&result), &values[2 * TK_ALGO_BLOCK + 1]);
+}
+
+/**
+ * @brief Test that the random-access vtable macros leave the optional
+ * 'next_block' slot alone unless asked for.
+ */
+Test(list_algo_misc, vtable_macros_leave_next_block_optional) {
+  static const tk_iterator_vtable_t random_access =
+      TK_DEFINE_RANDOM_ACCESS_ITERATOR_VTABLE(int_arr, "int_array_iterator");
+  cr_assert_null(random_access.next_block);
+  tk_iterator_vtable_validate(&random_access);
+}
@@ -0,0 +1,137 @@
+/**
+ * @file test_parallel.c
+ * @brief Unit tests for the parallel algorithms in <tk/algo/parallel.h>.
+ *
+ * The ranges are large enough to be split across several threads.
+ */
+
+#include <criterion/criterion.h>
+#include <criterion/new/assert.h>
+#include <tk/algo/parallel.h>
+#include <tk/ds/deque.h>
+#include <tk/ds/list.h>
+#include <tk/ds/vec.h>
+
+#define N 100000
+
+// --- Test Fixture ---
+
+static tk_vec_t *vec;
+
+// Setup: vec = {0, 1, 2, ..., N - 1}
+void setup_parallel(void) {
+  vec = tk_vec_create(sizeof(int));
+  cr_assert_not_null(vec);
+  for (int i = 0; i < N; ++i)
+    tk_vec_push_back(vec, &i);
+}
+
+void teardown_parallel(void) { tk_vec_destroy(vec); }
+
+TestSuite(parallel_suite, .init = setup_parallel, .fini = teardown_parallel);
+
+// --- Callbacks ---
+
+static void double_it(void *element) { *(int *)element *= 2; }
+
+static tk_bool is_multiple_of_7(const void *element) {
+  return *(const int *)element % 7 == 0;
+}
+
+static tk_bool is_late(const void *element) {
+  // Matches many elements; only the first must be reported.
+  return *(const int *)element >= 3 * N / 4;
+}
+
+static tk_bool never(const void *element) {
+  (void)element;
+  return false;
+}
+
+static void to_double(const void *in, void *out) {
+  *(double *)out = *(const int *)in * 0.5;
+}
+
+// --- Test Cases ---
+
+Test(parallel_suite, hardware_threads) {
+  cr_assert_geq(tk_algo_par_hardware_threads(), 1);
+}
+
+Test(parallel_suite, for_each) {
+  tk_algo_par_for_each(tk_vec_begin(vec), tk_vec_end(vec), double_it, 8);
+  for (int i = 0; i < N; ++i)
+    cr_assert_eq(*(int *)tk_vec_at(vec, i), 2 * i);
+}
+
+Test(parallel_suite, count_if) {
+  size_t expected = (N + 6) / 7;
+  for (size_t threads = 0; threads <= 8; threads += 4) {
+    cr_assert_eq(tk_algo_par_count_if(tk_vec_begin(vec), tk_vec_end(vec),
+                                      is_multiple_of_7, threads),
+                 expected);
+  }
+}
+
+Test(parallel_suite, find_if_returns_first_match) {
+  tk_iterator_t end = tk_vec_end(vec);
+  tk_iterator_t result =
+      tk_algo_par_find_if(tk_vec_begin(vec), end, is_late, 8);
+  cr_assert_not(tk_iter_equal(&result, &end));
+  cr_assert_eq(*(int *)tk_iter_get(&result), 3 * N / 4);
+
+  result = tk_algo_par_find_if(tk_vec_begin(vec), end, is_multiple_of_7, 8);
+  cr_assert_eq(*(int *)tk_iter_get(&result), 0, "Match at index 0");
+
+  result = tk_algo_par_find_if(tk_vec_begin(vec), end, never, 8);
+  cr_assert(tk_iter_equal(&result, &end));
+}
+
+Test(parallel_suite, transform) {
+  tk_vec_t *out = tk_vec_create(sizeof(double));
+  cr_assert_eq(tk_vec_resize(out, N, NULL), TK_SUCCESS);
+
+  tk_iterator_t last = tk_algo_par_transform(
+      tk_vec_begin(vec), tk_vec_end(vec), tk_vec_begin(out), to_double, 8);
+  tk_iterator_t out_end = tk_vec_end(out);
+  cr_assert(tk_iter_equal(&last, &out_end));
+
+  for (int i = 0; i < N; ++i)
+    cr_assert_float_eq(*(double *)tk_vec_at(out, i), i * 0.5, 1e-12);
+  tk_vec_destroy(out);
+}
+
+Test(parallel_suite, small_and_empty_ranges) {
+  tk_vec_t *empty = tk_vec_create(sizeof(int));
+  tk_iterator_t end = tk_vec_end(empty);
+  tk_iterator_t result =
+      tk_algo_par_find_if(tk_vec_begin(empty), end, never, 0);
+  cr_assert(tk_iter_equal(&result, &end));
+  cr_assert_eq(tk_algo_par_count_if(tk_vec_begin(empty), end, never, 0), 0);
+  tk_vec_destroy(empty);
+
+  // A sub-range of 10 elements runs on the calling thread.
+  tk_iterator_t first = tk_vec_begin(vec);
+  tk_iterator_t last = tk_vec_begin(vec);
+  for (int i = 0; i < 10; ++i)
+    tk_iter_next(&last);
+  cr_assert_eq(tk_algo_par_count_if(first, last, is_multiple_of_7, 0), 2);
+}
+
+Test(parallel_suite, non_contiguous_random_access) {
+  // A deque is random-access but not contiguous: it is split by index.
+  tk_deque_t *deque = tk_deque_create(sizeof(int));
+  for (int i = 0; i < N; ++i)
+    tk_deque_push_back(deque, &i);
+  tk_iterator_t begin = tk_deque_begin(deque), end = tk_deque_end(deque);
+
+  cr_assert_eq(tk_algo_par_count_if(begin, end, is_multiple_of_7, 4),
+               (N + 6) / 7);
+  tk_iterator_t found = tk_algo_par_find_if(begin, end, is_late, 4);
+  cr_assert_eq(*(int *)tk_iter_get(&found), 3 * N / 4);
+
+  tk_algo_par_for_each(begin, end, double_it, 4);
+  for (int i = 0; i < N; i += 997)
+    cr_assert_eq(*(int *)tk_deque_at(deque, (size_t)i), 2 * i);
+  tk_deque_destroy(deque);
+}
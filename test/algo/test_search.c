@@ -0,0 +1,182 @@
+/**
+ * @file test_search.c
+ * @brief Unit tests for the vectorized value searches in <tk/algo/search.h>.
+ *
+ * Each type is checked on a `tk_vec_t` (the dense SIMD path) at lengths that
+ * leave every possible tail, and on a `tk_list_t` (the staged path) against
+ * a plain scalar reference.
+ */
+
+#include <criterion/criterion.h>
+#include <criterion/new/assert.h>
+#include <math.h>
+#include <stdint.h>
+#include <tk/algo/search.h>
+#include <tk/ds/deque.h>
+#include <tk/ds/list.h>
+#include <tk/ds/vec.h>
+
+#define MAX_LEN 200
+
+// --- Helpers ---
+
+static size_t index_of(tk_vec_t *vec, tk_iterator_t it) {
+  tk_iterator_t begin = tk_vec_begin(vec);
+  return (size_t)tk_iter_distance(&begin, &it);
+}
+
+/**
+ * @brief Checks find/count/min_max of one type on vecs of every length up
+ * to MAX_LEN. Values are kept small so that matches repeat, with the
+ * extremes planted at varying positions.
+ */
+#define CHECK_TYPE(T, TYPE, LO, HI)                                            \
+  do {                                                                         \
+    for (size_t len = 0; len <= MAX_LEN; len += 1 + len / 16) {                \
+      tk_vec_t *vec = tk_vec_create(sizeof(T));                                \
+      for (size_t i = 0; i < len; ++i) {                                       \
+        T x = (T)((i * 7) % 11);                                               \
+        tk_vec_push_back(vec, &x);                                             \
+      }                                                                        \
+      T *data = (T *)tk_vec_data(vec);                                         \
+      if (len > 2) {                                                           \
+        data[len / 3] = (T)(LO);                                               \
+        data[len - 1] = (T)(HI);                                               \
+      }                                                                        \
+      T lo = 0, hi = 0;                                                        \
+      for (size_t i = 0; i < len; ++i) {                                       \
+        if (i == 0 || data[i] < lo)                                            \
+          lo = data[i];                                                        \
+        if (i == 0 || data[i] > hi)                                            \
+          hi = data[i];                                                        \
+      }                                                                        \
+      for (T v = 0; v < (T)12; ++v) {                                          \
+        size_t first = len, n = 0;                                             \
+        for (size_t i = 0; i < len; ++i)                                       \
+          if (data[i] == v) {                                                  \
+            first = first == len ? i : first;                                  \
+            ++n;                                                               \
+          }                                                                    \
+        tk_iterator_t it = tk_algo_find_value(tk_vec_begin(vec),               \
+                                              tk_vec_end(vec), TYPE, &v);      \
+        cr_assert_eq(index_of(vec, it), first);                                \
+        cr_assert_eq(tk_algo_count_value(tk_vec_begin(vec), tk_vec_end(vec),   \
+                                         TYPE, &v),                            \
+                     n);                                                       \
+      }                                                                        \
+      T got_lo, got_hi;                                                        \
+      tk_error_t err = tk_algo_min_max(tk_vec_begin(vec), tk_vec_end(vec),     \
+                                       TYPE, &got_lo, &got_hi);                \
+      if (len == 0) {                                                          \
+        cr_assert_eq(err, TK_E_EMPTY);                                         \
+      } else {                                                                 \
+        cr_assert_eq(err, TK_SUCCESS);                                         \
+        cr_assert(got_lo == lo && got_hi == hi, "len %zu", len);               \
+      }                                                                        \
+      tk_vec_destroy(vec);                                                     \
+    }                                                                          \
+  } while (0)
+
+// --- Test Cases ---
+
+Test(search_suite, signed_integers) {
+  CHECK_TYPE(int8_t, TK_SCALAR_I8, INT8_MIN, INT8_MAX);
+  CHECK_TYPE(int16_t, TK_SCALAR_I16, INT16_MIN, INT16_MAX);
+  CHECK_TYPE(int32_t, TK_SCALAR_I32, INT32_MIN, INT32_MAX);
+  CHECK_TYPE(int64_t, TK_SCALAR_I64, INT64_MIN, INT64_MAX);
+}
+
+Test(search_suite, unsigned_integers) {
+  // A high bit set must rank as large, not as negative.
+  CHECK_TYPE(uint8_t, TK_SCALAR_U8, 0, UINT8_MAX);
+  CHECK_TYPE(uint16_t, TK_SCALAR_U16, 0, UINT16_MAX);
+  CHECK_TYPE(uint32_t, TK_SCALAR_U32, 0, UINT32_MAX);
+  CHECK_TYPE(uint64_t, TK_SCALAR_U64, 0, UINT64_MAX);
+}
+
+Test(search_suite, floating_point) {
+  CHECK_TYPE(float, TK_SCALAR_F32, -1e30f, 1e30f);
+  CHECK_TYPE(double, TK_SCALAR_F64, -1e300, 1e300);
+}
+
+Test(search_suite, float_equality_semantics) {
+  tk_vec_t *vec = tk_vec_create(sizeof(float));
+  float values[] = {1.0f, NAN, -0.0f, 2.0f, 0.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+  tk_vec_push_back_n(vec, values, 9);
+
+  float zero = 0.0f, nan = NAN;
+  tk_iterator_t it = tk_algo_find_value(tk_vec_begin(vec), tk_vec_end(vec),
+                                        TK_SCALAR_F32, &zero);
+  cr_assert_eq(index_of(vec, it), 2); // -0.0 == 0.0
+  cr_assert_eq(tk_algo_count_value(tk_vec_begin(vec), tk_vec_end(vec),
+                                   TK_SCALAR_F32, &zero),
+               2);
+  cr_assert_eq(tk_algo_count_value(tk_vec_begin(vec), tk_vec_end(vec),
+                                   TK_SCALAR_F32, &nan),
+               0);
+  tk_vec_destroy(vec);
+}
+
+Test(search_suite, staged_list_range) {
+  tk_list_t *list = tk_list_create(sizeof(int32_t));
+  int32_t expected_lo = INT32_MAX, expected_hi = INT32_MIN;
+  size_t expected_count = 0;
+  for (int32_t i = 0; i < 500; ++i) {
+    int32_t x = (i * 37) % 101 - 50;
+    tk_list_push_back(list, &x);
+    expected_lo = x < expected_lo ? x : expected_lo;
+    expected_hi = x > expected_hi ? x : expected_hi;
+    expected_count += x == 7;
+  }
+
+  int32_t seven = 7, absent = 1000;
+  tk_iterator_t it = tk_algo_find_value(tk_list_begin(list), tk_list_end(list),
+                                        TK_SCALAR_I32, &seven);
+  cr_assert_eq(*(int32_t *)tk_iter_get(&it), 7);
+  tk_iterator_t end = tk_list_end(list);
+  it = tk_algo_find_value(tk_list_begin(list), end, TK_SCALAR_I32, &absent);
+  cr_assert(tk_iter_equal(&it, &end));
+  cr_assert_eq(tk_algo_count_value(tk_list_begin(list), tk_list_end(list),
+                                   TK_SCALAR_I32, &seven),
+               expected_count);
+
+  int32_t lo, hi;
+  cr_assert_eq(tk_algo_min_max(tk_list_begin(list), tk_list_end(list),
+                               TK_SCALAR_I32, &lo, &hi),
+               TK_SUCCESS);
+  cr_assert_eq(lo, expected_lo);
+  cr_assert_eq(hi, expected_hi);
+  tk_list_destroy(list);
+}
+
+Test(search_suite, staged_deque_finds_late_match) {
+  tk_deque_t *deque = tk_deque_create(sizeof(uint64_t));
+  for (uint64_t i = 0; i < 300; ++i)
+    tk_deque_push_back(deque, &i);
+
+  uint64_t target = 250;
+  tk_iterator_t begin = tk_deque_begin(deque);
+  tk_iterator_t it = tk_algo_find_value(begin, tk_deque_end(deque),
+                                        TK_SCALAR_U64, &target);
+  cr_assert_eq(tk_iter_distance(&begin, &it), 250);
+
+  uint64_t max;
+  cr_assert_eq(tk_algo_min_max(tk_deque_begin(deque), tk_deque_end(deque),
+                               TK_SCALAR_U64, NULL, &max),
+               TK_SUCCESS);
+  cr_assert_eq(max, 299);
+  tk_deque_destroy(deque);
+}
+
+Test(search_suite, empty_ranges) {
+  tk_list_t *list = tk_list_create(sizeof(int));
+  int lo = 42, hi = 42, v = 0;
+  cr_assert_eq(tk_algo_min_max(tk_list_begin(list), tk_list_end(list),
+                               TK_SCALAR_I32, &lo, &hi),
+               TK_E_EMPTY);
+  cr_assert_eq(lo, 42);
+  cr_assert_eq(tk_algo_count_value(tk_list_begin(list), tk_list_end(list),
+                                   TK_SCALAR_I32, &v),
+               0);
+  tk_list_destroy(list);
+}
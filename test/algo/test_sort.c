@@ -0,0 +1,208 @@
+/**
+ * @file test_sort.c
+ * @brief Unit tests for the sorting algorithms in <tk/algo/sort.h>.
+ */
+
+#include <criterion/criterion.h>
+#include <criterion/new/assert.h>
+#include <string.h>
+#include <tk/algo/sort.h>
+#include <tk/ds/list.h>
+#include <tk/ds/vec.h>
+
+#define N 100000
+
+// --- Helpers ---
+
+// A 16-byte record: sorts by 'key', 'index' records the original position.
+typedef struct {
+  int64_t key;
+  uint64_t index;
+} record_t;
+
+// A record of an unspecialized size (12 bytes).
+typedef struct {
+  int32_t key;
+  uint32_t index;
+  uint32_t pad;
+} odd_record_t;
+
+static uint64_t rng_state = 88172645463325252ull;
+
+static uint64_t next_random(void) {
+  rng_state ^= rng_state << 13;
+  rng_state ^= rng_state >> 7;
+  rng_state ^= rng_state << 17;
+  return rng_state;
+}
+
+static int compare_int(const void *a, const void *b) {
+  int x = *(const int *)a, y = *(const int *)b;
+  return (x > y) - (x < y);
+}
+
+static int compare_record(const void *a, const void *b) {
+  int64_t x = ((const record_t *)a)->key, y = ((const record_t *)b)->key;
+  return (x > y) - (x < y);
+}
+
+static int compare_odd_record(const void *a, const void *b) {
+  int32_t x = ((const odd_record_t *)a)->key;
+  int32_t y = ((const odd_record_t *)b)->key;
+  return (x > y) - (x < y);
+}
+
+static tk_vec_t *random_ints(size_t n, int range) {
+  tk_vec_t *vec = tk_vec_create(sizeof(int));
+  cr_assert_not_null(vec);
+  for (size_t i = 0; i < n; ++i) {
+    int value = (int)(next_random() % (uint64_t)range) - range / 2;
+    tk_vec_push_back(vec, &value);
+  }
+  return vec;
+}
+
+// Few distinct keys, so stability is observable.
+static tk_vec_t *random_records(size_t n) {
+  tk_vec_t *vec = tk_vec_create(sizeof(record_t));
+  cr_assert_not_null(vec);
+  for (size_t i = 0; i < n; ++i) {
+    record_t record = {(int64_t)(next_random() % 64) - 32, i};
+    tk_vec_push_back(vec, &record);
+  }
+  return vec;
+}
+
+static void assert_ints_sorted(const tk_vec_t *vec) {
+  for (size_t i = 1; i < tk_vec_size(vec); ++i)
+    cr_assert_leq(*(const int *)tk_vec_at(vec, i - 1),
+                  *(const int *)tk_vec_at(vec, i));
+}
+
+static void assert_records_stable(const tk_vec_t *vec) {
+  for (size_t i = 1; i < tk_vec_size(vec); ++i) {
+    const record_t *a = (const record_t *)tk_vec_at(vec, i - 1);
+    const record_t *b = (const record_t *)tk_vec_at(vec, i);
+    cr_assert_leq(a->key, b->key);
+    if (a->key == b->key)
+      cr_assert_lt(a->index, b->index);
+  }
+}
+
+// --- Test Cases ---
+
+Test(sort_suite, sort_ints) {
+  size_t sizes[] = {0, 1, 2, 15, 17, 1000, N};
+  for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+    tk_vec_t *vec = random_ints(sizes[s], 1 << 20);
+    cr_assert_eq(tk_algo_sort(tk_vec_begin(vec), tk_vec_end(vec), compare_int),
+                 TK_SUCCESS);
+    cr_assert_eq(tk_vec_size(vec), sizes[s]);
+    assert_ints_sorted(vec);
+    tk_vec_destroy(vec);
+  }
+}
+
+Test(sort_suite, sort_adversarial_inputs) {
+  tk_vec_t *vec = tk_vec_create(sizeof(int));
+  // Ascending, then descending, then all-equal, back to back.
+  for (int i = 0; i < N / 3; ++i)
+    tk_vec_push_back(vec, &i);
+  for (int i = N / 3; i > 0; --i)
+    tk_vec_push_back(vec, &i);
+  int seven = 7;
+  for (int i = 0; i < N / 3; ++i)
+    tk_vec_push_back(vec, &seven);
+
+  cr_assert_eq(tk_algo_sort(tk_vec_begin(vec), tk_vec_end(vec), compare_int),
+               TK_SUCCESS);
+  assert_ints_sorted(vec);
+  tk_vec_destroy(vec);
+}
+
+Test(sort_suite, sort_wide_and_odd_elements) {
+  tk_vec_t *records = random_records(5000);
+  tk_algo_sort(tk_vec_begin(records), tk_vec_end(records), compare_record);
+  for (size_t i = 1; i < tk_vec_size(records); ++i)
+    cr_assert_leq(((record_t *)tk_vec_at(records, i - 1))->key,
+                  ((record_t *)tk_vec_at(records, i))->key);
+  tk_vec_destroy(records);
+
+  tk_vec_t *odd = tk_vec_create(sizeof(odd_record_t));
+  for (uint32_t i = 0; i < 5000; ++i) {
+    odd_record_t record = {(int32_t)(next_random() % 100), i, 0xABCD};
+    tk_vec_push_back(odd, &record);
+  }
+  tk_algo_sort(tk_vec_begin(odd), tk_vec_end(odd), compare_odd_record);
+  for (size_t i = 1; i < tk_vec_size(odd); ++i) {
+    const odd_record_t *b = (const odd_record_t *)tk_vec_at(odd, i);
+    cr_assert_leq(((odd_record_t *)tk_vec_at(odd, i - 1))->key, b->key);
+    cr_assert_eq(b->pad, 0xABCD);
+  }
+  tk_vec_destroy(odd);
+}
+
+Test(sort_suite, stable_sort_keeps_order_of_equal_keys) {
+  size_t sizes[] = {1, 31, 33, 1000, N};
+  for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+    tk_vec_t *vec = random_records(sizes[s]);
+    cr_assert_eq(tk_algo_stable_sort(tk_vec_begin(vec), tk_vec_end(vec),
+                                     compare_record),
+                 TK_SUCCESS);
+    assert_records_stable(vec);
+    tk_vec_destroy(vec);
+  }
+}
+
+Test(sort_suite, radix_sort_signed_ints) {
+  tk_vec_t *vec = random_ints(N, 1 << 30);
+  cr_assert_eq(
+      tk_algo_radix_sort(tk_vec_begin(vec), tk_vec_end(vec), 0, TK_RADIX_I32),
+      TK_SUCCESS);
+  assert_ints_sorted(vec);
+  tk_vec_destroy(vec);
+}
+
+Test(sort_suite, radix_sort_by_field_is_stable) {
+  tk_vec_t *vec = random_records(N);
+  // Push some keys far apart so the high bytes get a pass too.
+  for (size_t i = 0; i < N; i += 97)
+    ((record_t *)tk_vec_at(vec, i))->key *= (int64_t)1 << 40;
+
+  cr_assert_eq(tk_algo_radix_sort(tk_vec_begin(vec), tk_vec_end(vec),
+                                  offsetof(record_t, key), TK_RADIX_I64),
+               TK_SUCCESS);
+  assert_records_stable(vec);
+
+  // A key that does not fit in the element is rejected.
+  cr_assert_eq(tk_algo_radix_sort(tk_vec_begin(vec), tk_vec_end(vec), 12,
+                                  TK_RADIX_U64),
+               TK_E_INVALID_ARG);
+  tk_vec_destroy(vec);
+}
+
+Test(sort_suite, par_stable_sort) {
+  size_t threads[] = {0, 1, 3, 8};
+  for (size_t t = 0; t < sizeof(threads) / sizeof(threads[0]); ++t) {
+    tk_vec_t *vec = random_records(N);
+    cr_assert_eq(tk_algo_par_stable_sort(tk_vec_begin(vec), tk_vec_end(vec),
+                                         compare_record, threads[t]),
+                 TK_SUCCESS);
+    cr_assert_eq(tk_vec_size(vec), N);
+    assert_records_stable(vec);
+    tk_vec_destroy(vec);
+  }
+}
+
+Test(sort_suite, rejects_non_contiguous_ranges) {
+  tk_list_t *list = tk_list_create(sizeof(int));
+  for (int i = 3; i > 0; --i)
+    tk_list_push_back(list, &i);
+  cr_assert_eq(
+      tk_algo_sort(tk_list_begin(list), tk_list_end(list), compare_int),
+      TK_E_INVALID_ARG);
+  cr_assert_eq(tk_algo_stable_sort(tk_list_begin(list), tk_list_end(list),
+                                   compare_int),
+               TK_E_INVALID_ARG);
+  tk_list_destroy(list);
+}
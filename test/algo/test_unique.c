@@ -0,0 +1,180 @@
+/**
+ * @file test_unique.c
+ * @brief Unit tests for the duplicate removal algorithms in
+ * <tk/algo/unique.h>.
+ */
+
+#include <criterion/criterion.h>
+#include <criterion/new/assert.h>
+#include <tk/algo/sort.h>
+#include <tk/algo/unique.h>
+#include <tk/ds/list.h>
+#include <tk/ds/vec.h>
+
+#define N 100000
+
+// --- Helpers ---
+
+static uint64_t rng_state = 2463534242ull;
+
+static uint64_t next_random(void) {
+  rng_state ^= rng_state << 13;
+  rng_state ^= rng_state >> 7;
+  rng_state ^= rng_state << 17;
+  return rng_state;
+}
+
+static int compare_int(const void *a, const void *b) {
+  int x = *(const int *)a, y = *(const int *)b;
+  return (x > y) - (x < y);
+}
+
+// Compares only 'key', so records with different payloads can be equal.
+typedef struct {
+  int key;
+  int payload;
+} record_t;
+
+static int compare_key(const void *a, const void *b) {
+  return compare_int(&((const record_t *)a)->key, &((const record_t *)b)->key);
+}
+
+// Record hash and equality on 'key' only; the hash is deliberately weak, so
+// keys collide and the probing is exercised.
+static size_t hash_key(const void *record, size_t size) {
+  (void)size;
+  return (size_t)(((const record_t *)record)->key % 7);
+}
+
+static tk_bool equal_key(const void *a, const void *b, size_t size) {
+  (void)size;
+  return compare_key(a, b) == 0;
+}
+
+static tk_vec_t *ints_of(const int *values, size_t n) {
+  tk_vec_t *vec = tk_vec_create(sizeof(int));
+  tk_vec_push_back_n(vec, values, n);
+  return vec;
+}
+
+// --- Test Cases ---
+
+Test(unique_suite, unique_drops_adjacent_runs) {
+  int values[] = {1, 1, 2, 3, 3, 3, 1, 4, 4};
+  tk_vec_t *vec = ints_of(values, 9);
+  size_t kept = 0;
+  cr_assert_eq(
+      tk_algo_unique(tk_vec_begin(vec), tk_vec_end(vec), compare_int, &kept),
+      TK_SUCCESS);
+  cr_assert_eq(kept, 5);
+  int expected[] = {1, 2, 3, 1, 4};
+  for (size_t i = 0; i < kept; ++i)
+    cr_assert_eq(*(int *)tk_vec_at(vec, i), expected[i]);
+  tk_vec_destroy(vec);
+}
+
+Test(unique_suite, unique_keeps_first_of_each_run) {
+  record_t records[] = {{1, 10}, {1, 11}, {2, 20}, {2, 21}, {2, 22}};
+  tk_vec_t *vec = tk_vec_create(sizeof(record_t));
+  tk_vec_push_back_n(vec, records, 5);
+  size_t kept;
+  tk_algo_unique(tk_vec_begin(vec), tk_vec_end(vec), compare_key, &kept);
+  cr_assert_eq(kept, 2);
+  cr_assert_eq(((record_t *)tk_vec_at(vec, 0))->payload, 10);
+  cr_assert_eq(((record_t *)tk_vec_at(vec, 1))->payload, 20);
+
+  // NULL compares bytes: every record differs from the one before.
+  tk_vec_assign(vec, records, 5);
+  tk_algo_unique(tk_vec_begin(vec), tk_vec_end(vec), NULL, &kept);
+  cr_assert_eq(kept, 5);
+  tk_vec_destroy(vec);
+}
+
+Test(unique_suite, sort_then_unique_matches_hashed_dedup) {
+  tk_vec_t *a = tk_vec_create(sizeof(int));
+  for (int i = 0; i < N; ++i) {
+    int value = (int)(next_random() % 5000);
+    tk_vec_push_back(a, &value);
+  }
+  tk_vec_t *b = ints_of((const int *)tk_vec_data(a), tk_vec_size(a));
+
+  size_t sorted_kept, hashed_kept;
+  tk_algo_sort(tk_vec_begin(a), tk_vec_end(a), compare_int);
+  cr_assert_eq(tk_algo_unique(tk_vec_begin(a), tk_vec_end(a), compare_int,
+                              &sorted_kept),
+               TK_SUCCESS);
+  cr_assert_eq(tk_algo_dedup_hashed(tk_vec_begin(b), tk_vec_end(b), NULL,
+                                    NULL, &hashed_kept),
+               TK_SUCCESS);
+  cr_assert_eq(sorted_kept, hashed_kept);
+  cr_assert_eq(sorted_kept, 5000, "N draws cover every value");
+
+  // Both yield the same distinct values; the hashed result keeps the input
+  // order, so sort it before comparing.
+  tk_vec_resize(a, sorted_kept, NULL);
+  tk_vec_resize(b, hashed_kept, NULL);
+  tk_algo_sort(tk_vec_begin(b), tk_vec_end(b), compare_int);
+  for (size_t i = 0; i < sorted_kept; ++i)
+    cr_assert_eq(*(int *)tk_vec_at(a, i), *(int *)tk_vec_at(b, i));
+  tk_vec_destroy(a);
+  tk_vec_destroy(b);
+}
+
+Test(unique_suite, dedup_hashed_keeps_first_occurrences_in_order) {
+  int values[] = {5, 3, 5, 9, 3, 3, 1, 9, 5, 7};
+  tk_vec_t *vec = ints_of(values, 10);
+  size_t kept;
+  cr_assert_eq(tk_algo_dedup_hashed(tk_vec_begin(vec), tk_vec_end(vec), NULL,
+                                    NULL, &kept),
+               TK_SUCCESS);
+  cr_assert_eq(kept, 5);
+  int expected[] = {5, 3, 9, 1, 7};
+  for (size_t i = 0; i < kept; ++i)
+    cr_assert_eq(*(int *)tk_vec_at(vec, i), expected[i]);
+  tk_vec_destroy(vec);
+}
+
+Test(unique_suite, dedup_hashed_uses_the_callers_functions) {
+  tk_vec_t *vec = tk_vec_create(sizeof(record_t));
+  for (int i = 0; i < 1000; ++i) {
+    record_t r = {(i * 37) % 100, i};
+    tk_vec_push_back(vec, &r);
+  }
+  size_t kept;
+  cr_assert_eq(tk_algo_dedup_hashed(tk_vec_begin(vec), tk_vec_end(vec),
+                                    hash_key, equal_key, &kept),
+               TK_SUCCESS);
+  cr_assert_eq(kept, 100);
+  for (size_t i = 0; i < kept; ++i) {
+    const record_t *r = (const record_t *)tk_vec_at(vec, i);
+    cr_assert_eq(r->payload, (int)i, "The first occurrence is kept");
+    cr_assert_eq(r->key, (int)(i * 37 % 100));
+  }
+  tk_vec_destroy(vec);
+}
+
+Test(unique_suite, small_and_unsupported_ranges) {
+  tk_vec_t *vec = tk_vec_create(sizeof(int));
+  size_t kept = 99;
+  cr_assert_eq(tk_algo_unique(tk_vec_begin(vec), tk_vec_end(vec), NULL, &kept),
+               TK_SUCCESS);
+  cr_assert_eq(kept, 0);
+  int one = 1;
+  tk_vec_push_back(vec, &one);
+  cr_assert_eq(tk_algo_dedup_hashed(tk_vec_begin(vec), tk_vec_end(vec), NULL,
+                                    NULL, &kept),
+               TK_SUCCESS);
+  cr_assert_eq(kept, 1);
+  tk_vec_destroy(vec);
+
+  tk_list_t *list = tk_list_create(sizeof(int));
+  tk_list_push_back(list, &one);
+  tk_list_push_back(list, &one);
+  cr_assert_eq(
+      tk_algo_unique(tk_list_begin(list), tk_list_end(list), NULL, &kept),
+      TK_E_INVALID_ARG);
+  cr_assert_eq(tk_algo_dedup_hashed(tk_list_begin(list), tk_list_end(list),
+                                    NULL, NULL, &kept),
+               TK_E_INVALID_ARG);
+  tk_list_destroy(list);
+}
@@ -153,3 +153,29 @@ Test(algo_suite, find_if_first_element) {
   cr_assert_eq(*(int *)tk_iter_get(&result), 10,
                "The algorithm found the wrong element.");
 }
+
+/**
+ * @brief Test that vector iterators expose contiguous storage and that the
+ * fast path returns a fully usable iterator.
+ */
+Test(algo_suite, find_if_contiguous_fast_path) {
+  tk_iterator_t begin = tk_vec_begin(vec_int);
+  tk_iterator_t end = tk_vec_end(vec_int);
+
+  size_t stride = 0;
+  cr_assert_eq(tk_iter_contiguous(&begin, &stride), tk_vec_data(vec_int),
+               "begin() should expose the vector's storage.");
+  cr_assert_eq(stride, sizeof(int));
+
+  // Search a sub-range starting at the second element.
+  tk_iter_next(&begin);
+  tk_iterator_t result = tk_algo_find_if(begin, end, find_30);
+  cr_assert_eq(*(int *)tk_iter_get(&result), 30);
+
+  // The returned iterator must keep working with the regular protocol.
+  tk_iter_next(&result);
+  cr_assert_eq(*(int *)tk_iter_get(&result), 40);
+  tk_iter_prev(&result);
+  tk_iter_prev(&result);
+  cr_assert_eq(*(int *)tk_iter_get(&result), 20);
+}
@@ -0,0 +1,133 @@
+/**
+ * @file test_arena.c
+ * @brief Unit tests for the tk_arena module using the Criterion framework.
+ *
+ * This file tests bump allocation, mark/rewind, reset, oversized requests
+ * and the tk_allocator_t adapter used to host containers in an arena.
+ */
+
+#include <criterion/criterion.h>
+#include <criterion/new/assert.h>
+#include <stdint.h>
+#include <string.h>
+#include <tk/core/allocator.h>
+#include <tk/core/arena.h>
+#include <tk/ds/list.h>
+#include <tk/ds/vec.h>
+
+// --- Test Fixture ---
+
+static tk_arena_t *arena;
+
+void setup_arena(void) {
+  arena = tk_arena_create(1024, tk_allocator_default());
+  cr_assert_not_null(arena, "Arena creation failed in setup");
+}
+
+void teardown_arena(void) { tk_arena_destroy(arena); }
+
+TestSuite(arena_suite, .init = setup_arena, .fini = teardown_arena);
+
+// --- Test Cases ---
+
+/**
+ * @brief Tests that allocations are aligned, adjacent and counted.
+ */
+Test(arena_suite, bump_allocation) {
+  cr_assert_eq(tk_arena_bytes_used(arena), 0);
+
+  char *a = (char *)tk_arena_alloc(arena, 10);
+  char *b = (char *)tk_arena_alloc(arena, 16);
+  cr_assert_not_null(a);
+  cr_assert_not_null(b);
+  cr_assert_eq((uintptr_t)a % 16, 0);
+  cr_assert_eq(b - a, 16, "10 bytes should be padded to 16");
+  cr_assert_eq(tk_arena_bytes_used(arena), 32);
+}
+
+/**
+ * @brief Tests that rewinding to a mark releases later allocations, across
+ * chunk boundaries.
+ */
+Test(arena_suite, mark_and_rewind) {
+  tk_arena_alloc(arena, 100);
+  tk_arena_mark_t mark = tk_arena_mark(arena);
+  size_t used = tk_arena_bytes_used(arena);
+  void *after_mark = tk_arena_alloc(arena, 64);
+
+  // Spill into further chunks.
+  for (int i = 0; i < 10; ++i) {
+    cr_assert_not_null(tk_arena_alloc(arena, 512));
+  }
+  cr_assert_gt(tk_arena_bytes_used(arena), 1024);
+
+  tk_arena_rewind(arena, mark);
+  cr_assert_eq(tk_arena_bytes_used(arena), used);
+  cr_assert_eq(tk_arena_alloc(arena, 64), after_mark,
+               "Rewind should hand the same memory out again");
+}
+
+/**
+ * @brief Tests that reset reuses the first chunk and that oversized requests
+ * get a dedicated chunk.
+ */
+Test(arena_suite, reset_and_oversized) {
+  void *first = tk_arena_alloc(arena, 32);
+  char *big = (char *)tk_arena_alloc(arena, 4096);
+  cr_assert_not_null(big);
+  memset(big, 0xAB, 4096);
+
+  tk_arena_reset(arena);
+  cr_assert_eq(tk_arena_bytes_used(arena), 0);
+  cr_assert_eq(tk_arena_alloc(arena, 32), first);
+}
+
+/**
+ * @brief Tests the allocator adapter: LIFO free and in-place realloc.
+ */
+Test(arena_suite, allocator_adapter) {
+  tk_allocator_t alloc = tk_arena_allocator(arena);
+
+  void *a = tk_allocator_alloc(&alloc, 32);
+  void *b = tk_allocator_alloc(&alloc, 32);
+
+  // Growing the most recent block happens in place.
+  cr_assert_eq(tk_allocator_realloc(&alloc, b, 32, 128), b);
+
+  // Freeing the most recent block hands its memory back.
+  tk_allocator_free(&alloc, b, 128);
+  cr_assert_eq(tk_allocator_alloc(&alloc, 16), b);
+
+  // Growing an older block copies it.
+  memset(a, 7, 32);
+  char *moved = (char *)tk_allocator_realloc(&alloc, a, 32, 64);
+  cr_assert_neq(moved, a);
+  cr_assert_eq(moved[31], 7);
+}
+
+/**
+ * @brief Tests hosting containers in an arena and discarding them all with a
+ * single rewind instead of destroying each one.
+ */
+Test(arena_suite, containers_discarded_by_rewind) {
+  tk_allocator_t scratch = tk_arena_allocator(arena);
+  tk_arena_mark_t mark = tk_arena_mark(arena);
+
+  for (int round = 0; round < 3; ++round) {
+    tk_vec_t *v = tk_vec_create_with_allocator(sizeof(int), &scratch);
+    tk_list_t *l = tk_list_create_with_allocator(sizeof(int), &scratch);
+    cr_assert_not_null(v);
+    cr_assert_not_null(l);
+
+    for (int i = 0; i < 200; ++i) {
+      cr_assert_eq(tk_vec_push_back(v, &i), TK_SUCCESS);
+      cr_assert_eq(tk_list_push_back(l, &i), TK_SUCCESS);
+    }
+    cr_assert_eq(*(int *)tk_vec_at(v, 199), 199);
+    cr_assert_eq(*(int *)tk_list_back(l), 199);
+
+    // No destroy calls: the whole round is discarded at once.
+    tk_arena_rewind(arena, mark);
+    cr_assert_eq(tk_arena_bytes_used(arena), 0);
+  }
+}
@@ -0,0 +1,155 @@
+/**
+ * @file test_pool.c
+ * @brief Unit tests for the tk_pool_t work-stealing thread pool.
+ */
+
+#define _POSIX_C_SOURCE 200809L // For nanosleep and clock_gettime
+
+#include <criterion/criterion.h>
+#include <criterion/new/assert.h>
+#include <tk/core/atomic.h>
+#include <tk/core/pool.h>
+#include <time.h>
+
+// --- Test Fixture ---
+
+static tk_pool_t *pool;
+
+void setup_pool(void) {
+  pool = tk_pool_create(4);
+  cr_assert_not_null(pool, "Pool creation failed");
+}
+
+void teardown_pool(void) { tk_pool_destroy(pool); }
+
+TestSuite(pool_suite, .init = setup_pool, .fini = teardown_pool);
+
+// --- Tasks ---
+
+static void increment(void *ctx) {
+  TK_ATOMIC_FETCH_ADD((size_t *)ctx, 1, TK_ATOMIC_RELAXED);
+}
+
+static void sleep_300ms(void *ctx) {
+  (void)ctx;
+  struct timespec duration = {0, 300000000L};
+  nanosleep(&duration, NULL);
+}
+
+static double seconds(clockid_t clock) {
+  struct timespec now;
+  clock_gettime(clock, &now);
+  return (double)now.tv_sec + (double)now.tv_nsec / 1e9;
+}
+
+static void mark_range(size_t first, size_t last, void *ctx) {
+  unsigned char *marks = (unsigned char *)ctx;
+  for (size_t i = first; i < last; ++i)
+    marks[i]++;
+}
+
+typedef struct {
+  size_t depth;  // Remaining recursion depth
+  size_t *count; // Leaf counter
+} tree_ctx_t;
+
+static void spawn_tree(void *arg);
+
+/**
+ * @brief Spawns two children per level from inside a task and waits for
+ * them, which exercises the worker deques and helping while waiting.
+ */
+static void spawn_tree(void *arg) {
+  tree_ctx_t *node = (tree_ctx_t *)arg;
+  if (node->depth == 0) {
+    increment(node->count);
+    return;
+  }
+  tree_ctx_t children[2] = {{node->depth - 1, node->count},
+                            {node->depth - 1, node->count}};
+  tk_wait_group_t wg;
+  tk_wait_group_init(&wg);
+  tk_pool_submit(pool, spawn_tree, &children[0], &wg);
+  tk_pool_submit(pool, spawn_tree, &children[1], &wg);
+  tk_pool_wait(pool, &wg);
+}
+
+static void sum_range(size_t first, size_t last, void *ctx) {
+  size_t local = 0;
+  for (size_t i = first; i < last; ++i)
+    local += i;
+  TK_ATOMIC_FETCH_ADD((size_t *)ctx, local, TK_ATOMIC_RELAXED);
+}
+
+// --- Test Cases ---
+
+Test(pool_suite, thread_count) {
+  cr_assert_eq(tk_pool_num_threads(pool), 4);
+  cr_assert_not_null(tk_pool_default());
+  cr_assert_eq(tk_pool_default(), tk_pool_default());
+}
+
+Test(pool_suite, submit_and_wait) {
+  size_t count = 0;
+  tk_wait_group_t wg;
+  tk_wait_group_init(&wg);
+  for (int i = 0; i < 10000; ++i)
+    cr_assert_eq(tk_pool_submit(pool, increment, &count, &wg), TK_SUCCESS);
+  tk_pool_wait(pool, &wg);
+  cr_assert_eq(count, 10000);
+}
+
+Test(pool_suite, wait_blocks_instead_of_spinning) {
+  tk_wait_group_t wg;
+  tk_wait_group_init(&wg);
+  double wall = seconds(CLOCK_MONOTONIC);
+  double cpu = seconds(CLOCK_THREAD_CPUTIME_ID);
+  cr_assert_eq(tk_pool_submit(pool, sleep_300ms, NULL, &wg), TK_SUCCESS);
+  tk_pool_wait(pool, &wg);
+  wall = seconds(CLOCK_MONOTONIC) - wall;
+  cpu = seconds(CLOCK_THREAD_CPUTIME_ID) - cpu;
+  cr_assert_geq(wall, 0.25);
+  cr_assert_lt(cpu, wall / 4, "The waiter used %.3f s CPU over %.3f s", cpu,
+               wall);
+}
+
+Test(pool_suite, nested_tasks) {
+  size_t count = 0;
+  tree_ctx_t root = {10, &count};
+  tk_wait_group_t wg;
+  tk_wait_group_init(&wg);
+  tk_pool_submit(pool, spawn_tree, &root, &wg);
+  tk_pool_wait(pool, &wg);
+  cr_assert_eq(count, 1024);
+}
+
+Test(pool_suite, parallel_for_covers_range_once) {
+  enum { N = 100003 };
+  static unsigned char marks[N];
+  tk_pool_parallel_for(pool, 0, N, 64, mark_range, marks);
+  for (size_t i = 0; i < N; ++i)
+    cr_assert_eq(marks[i], 1, "index %zu visited %d times", i, marks[i]);
+
+  // Empty and offset ranges.
+  tk_pool_parallel_for(pool, 5, 5, 64, mark_range, marks);
+  tk_pool_parallel_for(pool, 10, 20, 0, mark_range, marks);
+  cr_assert_eq(marks[9], 1);
+  cr_assert_eq(marks[10], 2);
+  cr_assert_eq(marks[19], 2);
+  cr_assert_eq(marks[20], 1);
+}
+
+Test(pool_suite, parallel_for_sum) {
+  size_t sum = 0;
+  tk_pool_parallel_for(pool, 0, 1000000, 1000, sum_range, &sum);
+  cr_assert_eq(sum, (size_t)1000000 * 999999 / 2);
+}
+
+Test(pool_misc, destroy_runs_queued_tasks) {
+  size_t count = 0;
+  tk_pool_t *small = tk_pool_create(1);
+  for (int i = 0; i < 1000; ++i)
+    tk_pool_submit(small, increment, &count, NULL);
+  tk_pool_destroy(small);
+  cr_assert_eq(count, 1000);
+}
@@ -0,0 +1,99 @@
+/**
+ * @file test_slab.c
+ * @brief Unit tests for the tk_slab module using the Criterion framework.
+ *
+ * This file tests block allocation, recycling through the free list, chunk
+ * growth and reset of the fixed-size block pool.
+ */
+
+#include <criterion/criterion.h>
+#include <criterion/new/assert.h>
+#include <stdint.h>
+#include <string.h>
+#include <tk/core/allocator.h>
+#include <tk/core/slab.h>
+
+// --- Test Fixture ---
+
+static tk_slab_t *slab;
+
+void setup_slab(void) {
+  // 24-byte blocks, 4 per chunk, so chunk growth is easy to trigger.
+  slab = tk_slab_create(24, 4, tk_allocator_default());
+  cr_assert_not_null(slab, "Slab creation failed in setup");
+}
+
+void teardown_slab(void) { tk_slab_destroy(slab); }
+
+TestSuite(slab_suite, .init = setup_slab, .fini = teardown_slab);
+
+// --- Test Cases ---
+
+/**
+ * @brief Tests that the block size is rounded up and blocks are aligned.
+ */
+Test(slab_suite, block_size_and_alignment) {
+  cr_assert_eq(tk_slab_block_size(slab), 32, "24 should round up to 32");
+
+  for (int i = 0; i < 10; ++i) {
+    void *block = tk_slab_alloc(slab);
+    cr_assert_not_null(block);
+    cr_assert_eq((uintptr_t)block % 16, 0, "Blocks must be 16-byte aligned");
+  }
+}
+
+/**
+ * @brief Tests that blocks within a chunk are carved sequentially and that
+ * live blocks never overlap across chunk boundaries.
+ */
+Test(slab_suite, sequential_and_distinct) {
+  char *blocks[12];
+  for (int i = 0; i < 12; ++i) {
+    blocks[i] = (char *)tk_slab_alloc(slab);
+    cr_assert_not_null(blocks[i]);
+    memset(blocks[i], i, 24);
+  }
+
+  // The first chunk holds 4 adjacent blocks.
+  for (int i = 1; i < 4; ++i) {
+    cr_assert_eq(blocks[i] - blocks[i - 1], 32, "Blocks should be adjacent");
+  }
+
+  // Writes to one block never clobber another.
+  for (int i = 0; i < 12; ++i) {
+    cr_assert_eq(blocks[i][0], i);
+    cr_assert_eq(blocks[i][23], i);
+  }
+}
+
+/**
+ * @brief Tests that freed blocks are recycled in LIFO order.
+ */
+Test(slab_suite, free_list_recycling) {
+  void *a = tk_slab_alloc(slab);
+  void *b = tk_slab_alloc(slab);
+
+  tk_slab_free(slab, a);
+  tk_slab_free(slab, b);
+  tk_slab_free(slab, NULL); // No-op
+
+  cr_assert_eq(tk_slab_alloc(slab), b, "Most recently freed block first");
+  cr_assert_eq(tk_slab_alloc(slab), a);
+}
+
+/**
+ * @brief Tests that reset reuses the existing chunks from the start.
+ */
+Test(slab_suite, reset_reuses_chunks) {
+  void *first = tk_slab_alloc(slab);
+  for (int i = 0; i < 9; ++i) {
+    tk_slab_alloc(slab);
+  }
+
+  tk_slab_reset(slab);
+  cr_assert_eq(tk_slab_alloc(slab), first,
+               "Reset should restart carving at the first chunk");
+  for (int i = 0; i < 11; ++i) {
+    cr_assert_not_null(tk_slab_alloc(slab));
+  }
+}
@@ -0,0 +1,197 @@
+/**
+ * @file test_stats.c
+ * @brief Unit tests for the tk_stats module using the Criterion framework.
+ *
+ * The counters are process-wide, so every test compares two snapshots
+ * rather than absolute values. In a build without TK_ENABLE_STATS the
+ * snapshots must stay all zeros, and that is what gets checked instead.
+ */
+
+#define _POSIX_C_SOURCE 200809L // For pthreads
+
+#include <criterion/criterion.h>
+#include <criterion/new/assert.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <tk/core/stats.h>
+#include <tk/ds/deque.h>
+#include <tk/ds/hashmap.h>
+#include <tk/ds/list.h>
+#include <tk/ds/ring.h>
+#include <tk/ds/vec.h>
+
+// --- Helpers ---
+
+static tk_stats_t before;
+
+/**
+ * @brief Returns the counters of `kind` accumulated since `before`.
+ */
+static tk_stats_counters_t delta(tk_stats_kind_t kind) {
+  tk_stats_t after;
+  tk_stats_snapshot(&after);
+  const tk_stats_counters_t *a = &after.kinds[kind], *b = &before.kinds[kind];
+  tk_stats_counters_t d = {
+      .allocs = a->allocs - b->allocs,
+      .frees = a->frees - b->frees,
+      .reallocs = a->reallocs - b->reallocs,
+      .realloc_moves = a->realloc_moves - b->realloc_moves,
+      .element_copies = a->element_copies - b->element_copies,
+      .bytes_live = a->bytes_live - b->bytes_live,
+      .peak_bytes = a->peak_bytes - b->peak_bytes,
+  };
+  return d;
+}
+
+static tk_bool is_zero(const tk_stats_counters_t *c) {
+  static const tk_stats_counters_t zero;
+  return memcmp(c, &zero, sizeof(zero)) == 0;
+}
+
+void setup_stats(void) { tk_stats_snapshot(&before); }
+
+TestSuite(stats_suite, .init = setup_stats);
+
+// --- Test Cases ---
+
+/**
+ * @brief Tests the vector's counters over a grow, shrink and destroy cycle.
+ */
+Test(stats_suite, vec_counters) {
+  tk_vec_t *vec = tk_vec_create(sizeof(int));
+  for (int i = 0; i < 1000; ++i)
+    tk_vec_push_back(vec, &i);
+  tk_vec_erase_range(vec, 0, 10);
+
+  tk_stats_counters_t d = delta(TK_STATS_VEC);
+  if (!tk_stats_enabled()) {
+    cr_assert(is_zero(&d), "Disabled statistics must stay zero");
+    tk_vec_destroy(vec);
+    return;
+  }
+  cr_assert_eq(d.allocs, 2, "The handle, then the first buffer");
+  cr_assert_geq(d.reallocs, 5, "4 -> 8 -> ... -> 1024");
+  cr_assert_leq(d.realloc_moves, d.reallocs);
+  cr_assert_eq(d.element_copies, 1000 + 990, "Pushes plus the tail shift");
+  cr_assert_geq(d.bytes_live, (int64_t)(1000 * sizeof(int)));
+  cr_assert_geq(d.peak_bytes, d.bytes_live);
+
+  tk_vec_destroy(vec);
+  d = delta(TK_STATS_VEC);
+  cr_assert_eq(d.frees, 2);
+  cr_assert_eq(d.bytes_live, 0, "Everything was given back");
+  cr_assert_geq(d.peak_bytes, (int64_t)(1000 * sizeof(int)));
+}
+
+/**
+ * @brief Tests that adopting and detaching a buffer moves it in and out of
+ * the live bytes.
+ */
+Test(stats_suite, vec_buffer_transfer) {
+  int *buffer = (int *)malloc(64 * sizeof(int));
+  tk_vec_t *vec = tk_vec_create(sizeof(int));
+  int64_t handle = delta(TK_STATS_VEC).bytes_live;
+  tk_vec_destroy(vec);
+
+  vec = tk_vec_from_buffer(sizeof(int), buffer, 0, 64);
+  tk_stats_counters_t d = delta(TK_STATS_VEC);
+  if (tk_stats_enabled())
+    cr_assert_eq(d.bytes_live, handle + (int64_t)(64 * sizeof(int)));
+
+  void *taken = NULL;
+  cr_assert_eq(tk_vec_take_buffer(vec, &taken, NULL, NULL), TK_SUCCESS);
+  d = delta(TK_STATS_VEC);
+  if (tk_stats_enabled())
+    cr_assert_eq(d.bytes_live, handle, "Only the handle is left");
+  tk_vec_destroy(vec);
+  free(taken);
+}
+
+/**
+ * @brief Tests that every container balances its books once destroyed, and
+ * attributes the activity to its own kind.
+ */
+Test(stats_suite, containers_balance) {
+  tk_list_t *list = tk_list_create(sizeof(int));
+  tk_list_t *pooled = tk_list_create_pooled(sizeof(int), 16);
+  tk_deque_t *deque = tk_deque_create(sizeof(int));
+  tk_hashmap_t *map = tk_hashmap_create(sizeof(int), sizeof(int), NULL, NULL);
+  tk_ring_t *ring = tk_ring_create(sizeof(int), 128, TK_RING_SPSC);
+  for (int i = 0; i < 100; ++i) {
+    tk_list_push_back(list, &i);
+    tk_list_push_back(pooled, &i);
+    tk_deque_push_front(deque, &i);
+    tk_hashmap_insert(map, &i, &i);
+    tk_ring_push(ring, &i);
+  }
+  int out;
+  while (tk_ring_pop(ring, &out) == TK_SUCCESS)
+    ;
+
+  tk_stats_counters_t list_live = delta(TK_STATS_LIST);
+  tk_list_destroy(list);
+  tk_list_destroy(pooled);
+  tk_deque_destroy(deque);
+  tk_hashmap_destroy(map);
+  tk_ring_destroy(ring);
+
+  if (!tk_stats_enabled()) {
+    for (int kind = 0; kind < TK_STATS_KIND_COUNT; ++kind) {
+      tk_stats_counters_t d = delta((tk_stats_kind_t)kind);
+      cr_assert(is_zero(&d));
+    }
+    return;
+  }
+  cr_assert_eq(list_live.allocs, 2 + 200, "Two handles, 200 nodes");
+  cr_assert_eq(list_live.element_copies, 200);
+
+  for (int kind = TK_STATS_LIST; kind < TK_STATS_KIND_COUNT; ++kind) {
+    tk_stats_counters_t d = delta((tk_stats_kind_t)kind);
+    cr_assert_gt(d.allocs, 0, "%s", tk_stats_kind_name(kind));
+    cr_assert_eq(d.allocs, d.frees, "%s", tk_stats_kind_name(kind));
+    cr_assert_eq(d.bytes_live, 0, "%s", tk_stats_kind_name(kind));
+    cr_assert_geq(d.element_copies, 100, "%s", tk_stats_kind_name(kind));
+  }
+  cr_assert_eq(delta(TK_STATS_RING).element_copies, 200, "In and out");
+  cr_assert_eq(delta(TK_STATS_VEC).allocs, 0, "Nothing was a vector");
+}
+
+static void *vec_worker(void *arg) {
+  (void)arg;
+  tk_vec_t *vec = tk_vec_create(sizeof(int));
+  for (int i = 0; i < 100; ++i)
+    tk_vec_push_back(vec, &i);
+  tk_vec_destroy(vec);
+  return NULL;
+}
+
+/**
+ * @brief Tests that the counters of exited threads are kept.
+ */
+Test(stats_suite, merges_exited_threads) {
+  pthread_t threads[4];
+  for (int i = 0; i < 4; ++i)
+    cr_assert_eq(pthread_create(&threads[i], NULL, vec_worker, NULL), 0);
+  for (int i = 0; i < 4; ++i)
+    pthread_join(threads[i], NULL);
+
+  tk_stats_counters_t d = delta(TK_STATS_VEC);
+  if (!tk_stats_enabled()) {
+    cr_assert(is_zero(&d));
+    return;
+  }
+  cr_assert_eq(d.allocs, 4 * 2);
+  cr_assert_eq(d.frees, 4 * 2);
+  cr_assert_eq(d.element_copies, 4 * 100);
+  cr_assert_eq(d.bytes_live, 0);
+}
+
+/**
+ * @brief Tests the kind names.
+ */
+Test(stats_suite, kind_names) {
+  cr_assert_str_eq(tk_stats_kind_name(TK_STATS_VEC), "vec");
+  cr_assert_str_eq(tk_stats_kind_name(TK_STATS_HASHMAP), "hashmap");
+  cr_assert_str_eq(tk_stats_kind_name(TK_STATS_KIND_COUNT), "unknown");
+}
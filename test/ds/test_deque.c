@@ -0,0 +1,185 @@
+/**
+ * @file test_deque.c
+ * @brief Unit tests for the tk_deque_t container.
+ */
+
+#include <criterion/criterion.h>
+#include <criterion/new/assert.h>
+#include <tk/algo/sequence.h>
+#include <tk/ds/deque.h>
+
+// Enough elements to span many blocks (a block holds 1024 ints).
+#define N 10000
+
+// --- Test Fixture ---
+
+static tk_deque_t *deque;
+
+void setup_deque(void) {
+  deque = tk_deque_create(sizeof(int));
+  cr_assert_not_null(deque);
+}
+
+void teardown_deque(void) { tk_deque_destroy(deque); }
+
+TestSuite(deque_suite, .init = setup_deque, .fini = teardown_deque);
+
+static tk_bool is_minus_one(const void *element) {
+  return *(const int *)element == -1;
+}
+
+static int destroyed;
+
+static void count_destroyed(void *element) {
+  (void)element;
+  ++destroyed;
+}
+
+// --- Test Cases ---
+
+Test(deque_suite, starts_empty) {
+  cr_assert(tk_deque_is_empty(deque));
+  cr_assert_null(tk_deque_front(deque));
+  cr_assert_null(tk_deque_back(deque));
+  cr_assert_null(tk_deque_at(deque, 0));
+  tk_deque_pop_back(deque); // No-ops
+  tk_deque_pop_front(deque);
+  tk_iterator_t begin = tk_deque_begin(deque), end = tk_deque_end(deque);
+  cr_assert(tk_iter_equal(&begin, &end));
+}
+
+Test(deque_suite, push_at_both_ends) {
+  // Build {-N, ..., -1, 0, ..., N - 1}.
+  for (int i = 0; i < N; ++i) {
+    int back = i, front = -i - 1;
+    cr_assert_eq(tk_deque_push_back(deque, &back), TK_SUCCESS);
+    cr_assert_eq(tk_deque_push_front(deque, &front), TK_SUCCESS);
+  }
+  cr_assert_eq(tk_deque_size(deque), 2 * N);
+  cr_assert_eq(*(int *)tk_deque_front(deque), -N);
+  cr_assert_eq(*(int *)tk_deque_back(deque), N - 1);
+  for (size_t i = 0; i < 2 * N; ++i)
+    cr_assert_eq(*(int *)tk_deque_at(deque, i), (int)i - N);
+  cr_assert_null(tk_deque_at(deque, 2 * N));
+}
+
+Test(deque_suite, element_addresses_are_stable) {
+  int value = 42;
+  tk_deque_push_back(deque, &value);
+  int *first = (int *)tk_deque_front(deque);
+  for (int i = 0; i < N; ++i) {
+    tk_deque_push_back(deque, &i);
+    tk_deque_push_front(deque, &i);
+  }
+  cr_assert_eq(tk_deque_at(deque, N), first);
+  cr_assert_eq(*first, 42);
+}
+
+Test(deque_suite, fifo_usage_keeps_working) {
+  // A queue drifts through the block map; it must keep recycling.
+  int next_in = 0, next_out = 0;
+  for (int round = 0; round < 50; ++round) {
+    for (int i = 0; i < 3000; ++i, ++next_in)
+      cr_assert_eq(tk_deque_push_back(deque, &next_in), TK_SUCCESS);
+    for (int i = 0; i < 2990; ++i, ++next_out) {
+      cr_assert_eq(*(int *)tk_deque_front(deque), next_out);
+      tk_deque_pop_front(deque);
+    }
+  }
+  cr_assert_eq(tk_deque_size(deque), (size_t)(next_in - next_out));
+
+  while (!tk_deque_is_empty(deque))
+    tk_deque_pop_back(deque);
+  cr_assert_eq(tk_deque_size(deque), 0);
+  int value = 7;
+  tk_deque_push_front(deque, &value);
+  cr_assert_eq(*(int *)tk_deque_back(deque), 7);
+}
+
+Test(deque_suite, random_access_iterator) {
+  for (int i = 0; i < N; ++i)
+    tk_deque_push_back(deque, &i);
+
+  tk_iterator_t it = tk_deque_begin(deque), end = tk_deque_end(deque);
+  cr_assert_eq(it.vtable->category, TK_ITER_RANDOM_ACCESS);
+  int expected = 0;
+  for (; !tk_iter_equal(&it, &end); tk_iter_next(&it))
+    cr_assert_eq(*(int *)tk_iter_get(&it), expected++);
+  cr_assert_eq(expected, N);
+
+  it = tk_deque_begin(deque);
+  it.vtable->seek(&it, 5000);
+  cr_assert_eq(*(int *)tk_iter_get(&it), 5000);
+  tk_iter_prev(&it);
+  cr_assert_eq(*(int *)tk_iter_get(&it), 4999);
+  it.vtable->seek(&it, N - 4999);
+  cr_assert(tk_iter_equal(&it, &end));
+}
+
+Test(deque_suite, iterator_jumps_across_blocks) {
+  for (int i = 0; i < N; ++i)
+    tk_deque_push_back(deque, &i);
+  for (int i = 1; i <= 100; ++i) { // Start mid-block
+    int value = -i;
+    tk_deque_push_front(deque, &value);
+  }
+
+  tk_iterator_t begin = tk_deque_begin(deque), end = tk_deque_end(deque);
+  cr_assert_eq(tk_iter_distance(&begin, &end), N + 100);
+  tk_iterator_t it = begin;
+  tk_iter_advance_n(&it, 100 + 5000);
+  cr_assert_eq(*(int *)tk_iter_get(&it), 5000);
+  cr_assert_eq(*(int *)tk_iter_at(&it, -5100), -100);
+  cr_assert_eq(*(int *)tk_iter_at(&it, N - 5001), N - 1);
+  cr_assert_eq(tk_iter_distance(&it, &begin), -5100);
+}
+
+Test(deque_suite, next_block_spans_blocks) {
+  for (int i = 0; i < N; ++i)
+    tk_deque_push_back(deque, &i);
+
+  // Start and stop mid-block, with batches that straddle block boundaries.
+  tk_iterator_t it = tk_deque_begin(deque), end = tk_deque_begin(deque);
+  tk_iter_advance_n(&it, 1000);
+  tk_iter_advance_n(&end, N - 10);
+  void *ptrs[300];
+  int expected = 1000;
+  size_t n;
+  while ((n = tk_iter_next_block(&it, &end, ptrs, 300)) > 0) {
+    for (size_t i = 0; i < n; ++i)
+      cr_assert_eq(*(int *)ptrs[i], expected++);
+  }
+  cr_assert_eq(expected, N - 10);
+  cr_assert(tk_iter_equal(&it, &end));
+  cr_assert_eq(*(int *)tk_iter_get(&it), N - 10);
+}
+
+Test(deque_suite, find_if_and_clear) {
+  for (int i = 0; i < N; ++i)
+    tk_deque_push_back(deque, &i);
+  int marker = -1;
+  tk_deque_push_front(deque, &marker);
+  tk_deque_pop_front(deque);
+  tk_deque_push_back(deque, &marker);
+
+  tk_iterator_t end = tk_deque_end(deque);
+  tk_iterator_t found =
+      tk_algo_find_if(tk_deque_begin(deque), end, is_minus_one);
+  cr_assert_not(tk_iter_equal(&found, &end));
+  cr_assert_eq(tk_deque_back(deque), tk_iter_get(&found));
+
+  tk_deque_clear(deque);
+  cr_assert(tk_deque_is_empty(deque));
+  tk_deque_push_back(deque, &marker);
+  cr_assert_eq(tk_deque_size(deque), 1);
+}
+
+Test(deque_suite, destroy_full_visits_every_element) {
+  tk_deque_t *d = tk_deque_create(64); // Wide elements: 64 per block
+  char element[64] = {0};
+  for (int i = 0; i < 1000; ++i)
+    tk_deque_push_front(d, element);
+  destroyed = 0;
+  tk_deque_destroy_full(d, count_destroyed);
+  cr_assert_eq(destroyed, 1000);
+}
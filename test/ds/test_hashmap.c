@@ -0,0 +1,223 @@
+/**
+ * @file test_hashmap.c
+ * @brief Unit tests for the tk_hashmap_t container.
+ */
+
+#include <criterion/criterion.h>
+#include <criterion/new/assert.h>
+#include <string.h>
+#include <tk/ds/hashmap.h>
+
+// --- Test Fixture ---
+
+static tk_hashmap_t *map;
+
+void setup_hashmap(void) {
+  map = tk_hashmap_create(sizeof(int), sizeof(double), NULL, NULL);
+  cr_assert_not_null(map, "Hash map creation failed");
+}
+
+void teardown_hashmap(void) { tk_hashmap_destroy(map); }
+
+TestSuite(hashmap_suite, .init = setup_hashmap, .fini = teardown_hashmap);
+
+// --- Custom hash / equality: case-insensitive fixed-size strings ---
+
+typedef struct {
+  char text[16];
+} name_t;
+
+static size_t name_hash(const void *key, size_t key_size) {
+  (void)key_size;
+  const char *text = ((const name_t *)key)->text;
+  size_t hash = 0;
+  for (; *text; ++text)
+    hash = hash * 31 + (size_t)(*text | 0x20);
+  return hash;
+}
+
+static tk_bool name_equal(const void *key1, const void *key2,
+                          size_t key_size) {
+  (void)key_size;
+  const char *a = ((const name_t *)key1)->text;
+  const char *b = ((const name_t *)key2)->text;
+  for (; *a && *b; ++a, ++b) {
+    if ((*a | 0x20) != (*b | 0x20))
+      return false;
+  }
+  return *a == *b;
+}
+
+// --- Test Cases ---
+
+Test(hashmap_suite, starts_empty) {
+  int key = 1;
+  cr_assert(tk_hashmap_is_empty(map));
+  cr_assert_eq(tk_hashmap_capacity(map), 0, "No table before first insert");
+  cr_assert_null(tk_hashmap_get(map, &key));
+  cr_assert_eq(tk_hashmap_erase(map, &key), TK_E_NOT_FOUND);
+
+  tk_iterator_t begin = tk_hashmap_begin(map);
+  tk_iterator_t end = tk_hashmap_end(map);
+  cr_assert(tk_iter_equal(&begin, &end));
+}
+
+Test(hashmap_suite, insert_get_overwrite) {
+  int key = 7;
+  double value = 1.5;
+  cr_assert_eq(tk_hashmap_insert(map, &key, &value), TK_SUCCESS);
+  cr_assert_eq(tk_hashmap_size(map), 1);
+  cr_assert_float_eq(*(double *)tk_hashmap_get(map, &key), 1.5, 1e-12);
+
+  value = 2.5;
+  cr_assert_eq(tk_hashmap_insert(map, &key, &value), TK_SUCCESS);
+  cr_assert_eq(tk_hashmap_size(map), 1, "Overwrite must not add an entry");
+  cr_assert_float_eq(*(double *)tk_hashmap_get(map, &key), 2.5, 1e-12);
+
+  // The returned pointer can be used to update in place.
+  *(double *)tk_hashmap_get(map, &key) = 3.5;
+  cr_assert_float_eq(*(double *)tk_hashmap_get(map, &key), 3.5, 1e-12);
+}
+
+Test(hashmap_suite, try_insert_keeps_existing_value) {
+  int key = 3;
+  double value = 1.0;
+  tk_bool inserted = false;
+  cr_assert_eq(tk_hashmap_try_insert(map, &key, &value, &inserted),
+               TK_SUCCESS);
+  cr_assert(inserted);
+
+  value = 9.0;
+  cr_assert_eq(tk_hashmap_try_insert(map, &key, &value, &inserted),
+               TK_SUCCESS);
+  cr_assert_not(inserted);
+  cr_assert_eq(tk_hashmap_size(map), 1);
+  cr_assert_float_eq(*(double *)tk_hashmap_get(map, &key), 1.0, 1e-12,
+                     "The first value stays");
+  cr_assert_eq(tk_hashmap_try_insert(map, &key, &value, NULL), TK_SUCCESS);
+}
+
+Test(hashmap_suite, many_keys_grow) {
+  const int n = 10000;
+  for (int i = 0; i < n; ++i) {
+    double value = i * 0.5;
+    cr_assert_eq(tk_hashmap_insert(map, &i, &value), TK_SUCCESS);
+  }
+  cr_assert_eq(tk_hashmap_size(map), (size_t)n);
+  cr_assert_leq(tk_hashmap_size(map), tk_hashmap_capacity(map) / 8 * 7);
+
+  for (int i = 0; i < n; ++i) {
+    double *value = tk_hashmap_get(map, &i);
+    cr_assert_not_null(value, "key %d lost after growth", i);
+    cr_assert_float_eq(*value, i * 0.5, 1e-12);
+  }
+  int missing = n;
+  cr_assert_not(tk_hashmap_contains(map, &missing));
+}
+
+Test(hashmap_suite, erase_and_reuse) {
+  for (int i = 0; i < 1000; ++i) {
+    double value = i;
+    tk_hashmap_insert(map, &i, &value);
+  }
+  for (int i = 0; i < 1000; i += 2) {
+    cr_assert_eq(tk_hashmap_erase(map, &i), TK_SUCCESS);
+  }
+  cr_assert_eq(tk_hashmap_size(map), 500);
+  for (int i = 0; i < 1000; ++i) {
+    cr_assert_eq(tk_hashmap_contains(map, &i), i % 2 == 1, "key %d", i);
+  }
+
+  // Heavy churn at a constant size must not grow the table without bound.
+  size_t capacity = tk_hashmap_capacity(map);
+  for (int round = 0; round < 50; ++round) {
+    for (int i = 0; i < 1000; i += 2) {
+      int key = 1000 * (round + 1) + i;
+      double value = key;
+      cr_assert_eq(tk_hashmap_insert(map, &key, &value), TK_SUCCESS);
+    }
+    for (int i = 0; i < 1000; i += 2) {
+      int key = 1000 * (round + 1) + i;
+      cr_assert_eq(tk_hashmap_erase(map, &key), TK_SUCCESS);
+    }
+  }
+  cr_assert_eq(tk_hashmap_size(map), 500);
+  cr_assert_leq(tk_hashmap_capacity(map), capacity * 2);
+  for (int i = 1; i < 1000; i += 2) {
+    cr_assert_float_eq(*(double *)tk_hashmap_get(map, &i), (double)i, 1e-12);
+  }
+}
+
+Test(hashmap_suite, iterate_all_entries) {
+  int sum_keys = 0;
+  for (int i = 1; i <= 100; ++i) {
+    double value = i * 2.0;
+    tk_hashmap_insert(map, &i, &value);
+    sum_keys += i;
+  }
+
+  int seen = 0, key_total = 0;
+  tk_iterator_t it = tk_hashmap_begin(map);
+  tk_iterator_t end = tk_hashmap_end(map);
+  for (; !tk_iter_equal(&it, &end); tk_iter_next(&it)) {
+    int key = *(const int *)tk_hashmap_iter_key(&it);
+    cr_assert_eq(*(const int *)tk_iter_get(&it), key);
+    cr_assert_float_eq(*(double *)tk_hashmap_iter_value(&it), key * 2.0,
+                       1e-12);
+    key_total += key;
+    seen++;
+  }
+  cr_assert_eq(seen, 100);
+  cr_assert_eq(key_total, sum_keys);
+}
+
+Test(hashmap_suite, clear_and_reserve) {
+  cr_assert_eq(tk_hashmap_reserve(map, 1000), TK_SUCCESS);
+  size_t capacity = tk_hashmap_capacity(map);
+  cr_assert_geq(capacity / 8 * 7, 1000);
+
+  for (int i = 0; i < 1000; ++i) {
+    double value = i;
+    tk_hashmap_insert(map, &i, &value);
+  }
+  cr_assert_eq(tk_hashmap_capacity(map), capacity, "No rehash after reserve");
+
+  tk_hashmap_clear(map);
+  cr_assert(tk_hashmap_is_empty(map));
+  cr_assert_eq(tk_hashmap_capacity(map), capacity);
+  int key = 5;
+  cr_assert_null(tk_hashmap_get(map, &key));
+}
+
+Test(hashmap_misc, custom_hash_and_value_less_set) {
+  tk_hashmap_t *set =
+      tk_hashmap_create(sizeof(name_t), 0, name_hash, name_equal);
+  cr_assert_not_null(set);
+
+  name_t alice = {"Alice"}, bob = {"bob"}, upper = {"ALICE"};
+  cr_assert_eq(tk_hashmap_insert(set, &alice, NULL), TK_SUCCESS);
+  cr_assert_eq(tk_hashmap_insert(set, &bob, NULL), TK_SUCCESS);
+  cr_assert_eq(tk_hashmap_insert(set, &upper, NULL), TK_SUCCESS);
+  cr_assert_eq(tk_hashmap_size(set), 2, "ALICE equals Alice");
+  cr_assert(tk_hashmap_contains(set, &upper));
+
+  tk_hashmap_destroy(set);
+}
+
+Test(hashmap_misc, struct_values) {
+  typedef struct {
+    char tag;
+    long long payload[3];
+  } record_t;
+  tk_hashmap_t *records =
+      tk_hashmap_create(sizeof(char), sizeof(record_t), NULL, NULL);
+  for (char c = 'a'; c <= 'z'; ++c) {
+    record_t r = {c, {c, c * 2, c * 3}};
+    cr_assert_eq(tk_hashmap_insert(records, &c, &r), TK_SUCCESS);
+  }
+  char q = 'm';
+  record_t *r = tk_hashmap_get(records, &q);
+  cr_assert_eq(r->tag, 'm');
+  cr_assert_eq(r->payload[2], 'm' * 3);
+  tk_hashmap_destroy(records);
+}
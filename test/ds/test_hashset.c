@@ -0,0 +1,87 @@
+/**
+ * @file test_hashset.c
+ * @brief Unit tests for the tk_hashset_t container.
+ */
+
+#include <criterion/criterion.h>
+#include <criterion/new/assert.h>
+#include <tk/ds/hashset.h>
+
+// --- Test Fixture ---
+
+static tk_hashset_t *set;
+
+void setup_hashset(void) {
+  set = tk_hashset_create(sizeof(int), NULL, NULL);
+  cr_assert_not_null(set, "Hash set creation failed");
+}
+
+void teardown_hashset(void) { tk_hashset_destroy(set); }
+
+TestSuite(hashset_suite, .init = setup_hashset, .fini = teardown_hashset);
+
+// Keys equal modulo 10.
+static size_t mod10_hash(const void *key, size_t key_size) {
+  (void)key_size;
+  return (size_t)(*(const int *)key % 10);
+}
+
+static tk_bool mod10_equal(const void *key1, const void *key2,
+                           size_t key_size) {
+  (void)key_size;
+  return *(const int *)key1 % 10 == *(const int *)key2 % 10;
+}
+
+// --- Test Cases ---
+
+Test(hashset_suite, insert_reports_new_keys) {
+  cr_assert(tk_hashset_is_empty(set));
+  tk_bool inserted = false;
+  int key = 42;
+  cr_assert_eq(tk_hashset_insert(set, &key, &inserted), TK_SUCCESS);
+  cr_assert(inserted);
+  cr_assert_eq(tk_hashset_insert(set, &key, &inserted), TK_SUCCESS);
+  cr_assert_not(inserted, "A second insert finds the key");
+  cr_assert_eq(tk_hashset_size(set), 1);
+  cr_assert(tk_hashset_contains(set, &key));
+
+  cr_assert_eq(tk_hashset_erase(set, &key), TK_SUCCESS);
+  cr_assert_eq(tk_hashset_erase(set, &key), TK_E_NOT_FOUND);
+  cr_assert_not(tk_hashset_contains(set, &key));
+}
+
+Test(hashset_suite, grows_and_iterates) {
+  const int n = 5000;
+  cr_assert_eq(tk_hashset_reserve(set, n), TK_SUCCESS);
+  size_t capacity = tk_hashset_capacity(set);
+  for (int i = 0; i < n; ++i)
+    cr_assert_eq(tk_hashset_insert(set, &i, NULL), TK_SUCCESS);
+  cr_assert_eq(tk_hashset_capacity(set), capacity, "Reserved up front");
+  cr_assert_eq(tk_hashset_size(set), (size_t)n);
+
+  long long sum = 0;
+  size_t visited = 0;
+  tk_iterator_t it = tk_hashset_begin(set), end = tk_hashset_end(set);
+  for (; !tk_iter_equal(&it, &end); tk_iter_next(&it)) {
+    sum += *(const int *)tk_iter_get(&it);
+    ++visited;
+  }
+  cr_assert_eq(visited, (size_t)n);
+  cr_assert_eq(sum, (long long)n * (n - 1) / 2);
+
+  tk_hashset_clear(set);
+  cr_assert(tk_hashset_is_empty(set));
+  int key = 7;
+  cr_assert_not(tk_hashset_contains(set, &key));
+}
+
+Test(hashset_misc, custom_equality) {
+  tk_hashset_t *digits = tk_hashset_create(sizeof(int), mod10_hash,
+                                           mod10_equal);
+  for (int i = 0; i < 100; ++i)
+    tk_hashset_insert(digits, &i, NULL);
+  cr_assert_eq(tk_hashset_size(digits), 10);
+  int key = 123;
+  cr_assert(tk_hashset_contains(digits, &key), "123 is 3 modulo 10");
+  tk_hashset_destroy(digits);
+}
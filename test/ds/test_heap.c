@@ -0,0 +1,212 @@
+/**
+ * @file test_heap.c
+ * @brief Unit tests for the tk_heap_t priority queue.
+ */
+
+#include <criterion/criterion.h>
+#include <criterion/new/assert.h>
+#include <stdlib.h>
+#include <tk/core/stats.h>
+#include <tk/ds/heap.h>
+
+#define N 2000
+
+static int compare_int(const void *a, const void *b) {
+  int x = *(const int *)a, y = *(const int *)b;
+  return (x > y) - (x < y);
+}
+
+static int compare_int_desc(const void *a, const void *b) {
+  return compare_int(b, a);
+}
+
+typedef struct {
+  long deadline;
+  int id;
+} timer_entry_t;
+
+static int compare_deadline(const void *a, const void *b) {
+  long x = ((const timer_entry_t *)a)->deadline;
+  long y = ((const timer_entry_t *)b)->deadline;
+  return (x > y) - (x < y);
+}
+
+/**
+ * @brief Pops everything and checks that the values come out sorted.
+ */
+static void assert_drains_sorted(tk_heap_t *heap, size_t expected) {
+  size_t popped = 0;
+  int previous = 0, value;
+  while (tk_heap_pop(heap, &value) == TK_SUCCESS) {
+    if (popped++ > 0)
+      cr_assert_geq(value, previous);
+    previous = value;
+  }
+  cr_assert_eq(popped, expected);
+  cr_assert(tk_heap_is_empty(heap));
+}
+
+// --- Test Cases ---
+
+Test(heap_suite, push_pop_orders_every_arity) {
+  size_t arities[] = {2, 4, 8, 16};
+  for (size_t a = 0; a < 4; ++a) {
+    tk_heap_t *heap = tk_heap_create(sizeof(int), compare_int, arities[a]);
+    cr_assert_not_null(heap);
+    cr_assert_eq(tk_heap_arity(heap), arities[a]);
+    srand(7);
+    for (int i = 0; i < N; ++i) {
+      int value = rand() % 500; // Plenty of duplicates
+      cr_assert_eq(tk_heap_push(heap, &value, NULL), TK_SUCCESS);
+    }
+    cr_assert_eq(tk_heap_size(heap), N);
+    assert_drains_sorted(heap, N);
+    tk_heap_destroy(heap);
+  }
+}
+
+Test(heap_suite, create_and_empty_behaviour) {
+  cr_assert_null(tk_heap_create(sizeof(int), compare_int, 3));
+  cr_assert_null(tk_heap_create(sizeof(int), compare_int, 32));
+  tk_heap_t *heap = tk_heap_create(sizeof(int), compare_int, 0);
+  cr_assert_eq(tk_heap_arity(heap), TK_HEAP_DEFAULT_ARITY);
+  cr_assert_null(tk_heap_top(heap));
+  cr_assert_eq(tk_heap_top_handle(heap), TK_HEAP_NO_HANDLE);
+  cr_assert_eq(tk_heap_pop(heap, NULL), TK_E_EMPTY);
+  cr_assert_not(tk_heap_contains(heap, 0));
+  tk_heap_destroy(heap);
+}
+
+Test(heap_suite, reversed_comparator_gives_max_heap) {
+  tk_heap_t *heap = tk_heap_create(sizeof(int), compare_int_desc, 2);
+  int values[] = {5, 1, 9, 3, 7};
+  for (int i = 0; i < 5; ++i)
+    tk_heap_push(heap, &values[i], NULL);
+  cr_assert_eq(*(const int *)tk_heap_top(heap), 9);
+  int out;
+  tk_heap_pop(heap, &out);
+  cr_assert_eq(out, 9);
+  cr_assert_eq(*(const int *)tk_heap_top(heap), 7);
+  tk_heap_destroy(heap);
+}
+
+Test(heap_suite, assign_heapifies_in_bulk) {
+  static int values[N];
+  static tk_heap_handle_t handles[N];
+  srand(11);
+  for (int i = 0; i < N; ++i)
+    values[i] = rand() % 100000;
+
+  tk_heap_t *heap = tk_heap_create(sizeof(int), compare_int, 4);
+  int stale = 42;
+  tk_heap_handle_t old;
+  tk_heap_push(heap, &stale, &old);
+
+  cr_assert_eq(tk_heap_assign(heap, values, N, handles), TK_SUCCESS);
+  cr_assert_eq(tk_heap_size(heap), N);
+  for (int i = 0; i < N; i += 37)
+    cr_assert_eq(*(const int *)tk_heap_get(heap, handles[i]), values[i]);
+  assert_drains_sorted(heap, N);
+
+  cr_assert_eq(tk_heap_assign(heap, NULL, 0, NULL), TK_SUCCESS);
+  cr_assert(tk_heap_is_empty(heap));
+  tk_heap_destroy(heap);
+}
+
+/**
+ * @brief The timer-wheel use case: reschedule and cancel by handle.
+ */
+Test(heap_suite, handles_follow_their_elements) {
+  tk_heap_t *heap = tk_heap_create(sizeof(timer_entry_t), compare_deadline, 0);
+  tk_heap_handle_t handles[100];
+  for (int i = 0; i < 100; ++i) {
+    timer_entry_t t = {.deadline = 1000 + i * 10, .id = i};
+    cr_assert_eq(tk_heap_push(heap, &t, &handles[i]), TK_SUCCESS);
+  }
+  for (int i = 0; i < 100; ++i) {
+    const timer_entry_t *t =
+        (const timer_entry_t *)tk_heap_get(heap, handles[i]);
+    cr_assert_eq(t->id, i);
+  }
+
+  // Fire timer 50 first.
+  timer_entry_t sooner = {.deadline = 5, .id = 50};
+  cr_assert_eq(tk_heap_decrease_key(heap, handles[50], &sooner), TK_SUCCESS);
+  cr_assert_eq(tk_heap_top_handle(heap), handles[50]);
+
+  // Increasing through decrease_key is refused; update accepts it.
+  timer_entry_t later = {.deadline = 100000, .id = 0};
+  cr_assert_eq(tk_heap_decrease_key(heap, handles[0], &later),
+               TK_E_INVALID_ARG);
+  const timer_entry_t *first =
+      (const timer_entry_t *)tk_heap_get(heap, handles[0]);
+  cr_assert_eq(first->deadline, 1000);
+  cr_assert_eq(tk_heap_update(heap, handles[0], &later), TK_SUCCESS);
+
+  // Cancel timer 1, and every timer from 60 on.
+  timer_entry_t cancelled;
+  cr_assert_eq(tk_heap_erase(heap, handles[1], &cancelled), TK_SUCCESS);
+  cr_assert_eq(cancelled.id, 1);
+  cr_assert_not(tk_heap_contains(heap, handles[1]));
+  cr_assert_eq(tk_heap_erase(heap, handles[1], NULL), TK_E_NOT_FOUND);
+  for (int i = 60; i < 100; ++i)
+    cr_assert_eq(tk_heap_erase(heap, handles[i], NULL), TK_SUCCESS);
+  cr_assert_eq(tk_heap_size(heap), 59);
+
+  timer_entry_t t;
+  cr_assert_eq(tk_heap_pop(heap, &t), TK_SUCCESS);
+  cr_assert_eq(t.id, 50);
+  long previous = t.deadline;
+  int last_id = -1;
+  while (tk_heap_pop(heap, &t) == TK_SUCCESS) {
+    cr_assert_geq(t.deadline, previous);
+    previous = t.deadline;
+    last_id = t.id;
+  }
+  cr_assert_eq(last_id, 0, "Timer 0 was pushed to the back");
+  tk_heap_destroy(heap);
+}
+
+Test(heap_suite, handles_are_recycled_and_cleared) {
+  tk_heap_t *heap = tk_heap_create(sizeof(int), compare_int, 2);
+  int value = 1;
+  tk_heap_handle_t a, b, c;
+  tk_heap_push(heap, &value, &a);
+  tk_heap_push(heap, &value, &b);
+  cr_assert_neq(a, b);
+  tk_heap_erase(heap, a, NULL);
+  tk_heap_push(heap, &value, &c);
+  cr_assert_eq(c, a, "A freed handle is reused");
+  cr_assert(tk_heap_contains(heap, b));
+  cr_assert(tk_heap_contains(heap, c));
+
+  tk_heap_clear(heap);
+  cr_assert(tk_heap_is_empty(heap));
+  cr_assert_not(tk_heap_contains(heap, b));
+  cr_assert_not(tk_heap_contains(heap, c));
+  cr_assert_eq(tk_heap_reserve(heap, 1000), TK_SUCCESS);
+  for (int i = 0; i < 1000; ++i) {
+    int v = 999 - i;
+    tk_heap_push(heap, &v, NULL);
+  }
+  cr_assert_eq(*(const int *)tk_heap_top(heap), 0);
+  tk_heap_destroy(heap);
+}
+
+Test(heap_suite, pushes_grow_storage_geometrically) {
+  tk_stats_t before, after;
+  tk_stats_snapshot(&before);
+  tk_heap_t *heap = tk_heap_create(sizeof(int), compare_int, 0);
+  for (int i = 0; i < 10000; ++i)
+    cr_assert_eq(tk_heap_push(heap, &i, NULL), TK_SUCCESS);
+  tk_stats_snapshot(&after);
+  uint64_t reallocs = after.kinds[TK_STATS_VEC].reallocs -
+                      before.kinds[TK_STATS_VEC].reallocs;
+  // Three vectors, each doubling from 4 to 16384 elements: 12 reallocs.
+  cr_assert_leq(reallocs, 3 * 12, "Got %llu reallocs",
+                (unsigned long long)reallocs);
+  if (tk_stats_enabled())
+    cr_assert_gt(reallocs, 0);
+  assert_drains_sorted(heap, 10000);
+  tk_heap_destroy(heap);
+}
@@ -0,0 +1,138 @@
+/**
+ * @file test_ilist.c
+ * @brief Unit tests for the intrusive tk_ilist_t list.
+ */
+
+#include <criterion/criterion.h>
+#include <criterion/new/assert.h>
+#include <string.h>
+#include <tk/algo/sequence.h>
+#include <tk/ds/ilist.h>
+
+// An object that carries its own link, not at offset 0.
+typedef struct {
+  int id;
+  tk_ilist_node_t link;
+  double payload;
+} item_t;
+
+#define ITEMS 8
+
+// --- Test Fixture ---
+
+static tk_ilist_t list;
+static item_t items[ITEMS];
+
+// Setup: an empty list and ITEMS unlinked objects with ids 0..ITEMS-1.
+void setup_ilist(void) {
+  memset(items, 0, sizeof(items));
+  for (int i = 0; i < ITEMS; ++i)
+    items[i].id = i;
+  tk_ilist_init(&list, offsetof(item_t, link));
+}
+
+TestSuite(ilist_suite, .init = setup_ilist);
+
+static tk_bool has_id_5(const void *element) {
+  return ((const item_t *)element)->id == 5;
+}
+
+static void assert_ids(const int *expected, size_t count) {
+  cr_assert_eq(tk_ilist_size(&list), count);
+  tk_iterator_t it = tk_ilist_begin(&list), end = tk_ilist_end(&list);
+  for (size_t i = 0; i < count; ++i, tk_iter_next(&it)) {
+    cr_assert_not(tk_iter_equal(&it, &end));
+    cr_assert_eq(((item_t *)tk_iter_get(&it))->id, expected[i]);
+  }
+  cr_assert(tk_iter_equal(&it, &end));
+}
+
+// --- Test Cases ---
+
+Test(ilist_suite, starts_empty) {
+  cr_assert(tk_ilist_is_empty(&list));
+  cr_assert_null(tk_ilist_front(&list));
+  cr_assert_null(tk_ilist_back(&list));
+  cr_assert_null(tk_ilist_pop_front(&list));
+  cr_assert_null(tk_ilist_pop_back(&list));
+  tk_iterator_t begin = tk_ilist_begin(&list), end = tk_ilist_end(&list);
+  cr_assert(tk_iter_equal(&begin, &end));
+}
+
+Test(ilist_suite, push_links_objects_in_place) {
+  tk_ilist_push_back(&list, &items[1].link);
+  tk_ilist_push_back(&list, &items[2].link);
+  tk_ilist_push_front(&list, &items[0].link);
+  int expected[] = {0, 1, 2};
+  assert_ids(expected, 3);
+
+  // The list hands out the objects themselves, not copies.
+  cr_assert_eq(tk_ilist_front(&list), &items[0]);
+  cr_assert_eq(tk_ilist_back(&list), &items[2]);
+  cr_assert(tk_ilist_node_is_linked(&items[1].link));
+  cr_assert_not(tk_ilist_node_is_linked(&items[3].link));
+}
+
+Test(ilist_suite, remove_and_pop_unlink) {
+  for (int i = 0; i < 5; ++i)
+    tk_ilist_push_back(&list, &items[i].link);
+
+  tk_ilist_remove(&list, &items[2].link); // O(1) from the object alone
+  cr_assert_not(tk_ilist_node_is_linked(&items[2].link));
+  tk_ilist_node_t *node = tk_ilist_pop_front(&list);
+  cr_assert_eq(tk_ilist_entry(node, item_t, link), &items[0]);
+  node = tk_ilist_pop_back(&list);
+  cr_assert_eq(tk_ilist_entry(node, item_t, link), &items[4]);
+  int expected[] = {1, 3};
+  assert_ids(expected, 2);
+
+  // Unlinked nodes can go into another list.
+  tk_ilist_t other;
+  tk_ilist_init(&other, offsetof(item_t, link));
+  tk_ilist_push_back(&other, &items[2].link);
+  cr_assert_eq(tk_ilist_front(&other), &items[2]);
+}
+
+Test(ilist_suite, insert_relative_to_nodes_and_iterators) {
+  tk_ilist_push_back(&list, &items[0].link);
+  tk_ilist_push_back(&list, &items[3].link);
+  tk_ilist_insert_before(&list, &items[3].link, &items[1].link);
+
+  tk_iterator_t it = tk_ilist_begin(&list);
+  tk_iter_next(&it);
+  tk_iter_next(&it); // -> 3
+  tk_ilist_insert_at(&list, it, &items[2].link);
+  tk_ilist_insert_at(&list, tk_ilist_end(&list), &items[4].link);
+  int expected[] = {0, 1, 2, 3, 4};
+  assert_ids(expected, 5);
+}
+
+Test(ilist_suite, bidirectional_iterator) {
+  for (int i = 0; i < ITEMS; ++i)
+    tk_ilist_push_back(&list, &items[i].link);
+
+  tk_iterator_t it = tk_ilist_end(&list);
+  cr_assert_eq(it.vtable->category, TK_ITER_BIDIRECTIONAL);
+  for (int i = ITEMS - 1; i >= 0; --i) {
+    tk_iter_prev(&it);
+    cr_assert_eq(((item_t *)tk_iter_get(&it))->id, i);
+  }
+  tk_iterator_t begin = tk_ilist_begin(&list);
+  cr_assert(tk_iter_equal(&it, &begin));
+  cr_assert_eq(tk_ilist_iter_node(&it), &items[0].link);
+
+  tk_iterator_t end = tk_ilist_end(&list);
+  tk_iterator_t found = tk_algo_find_if(begin, end, has_id_5);
+  cr_assert_eq(tk_iter_get(&found), &items[5]);
+}
+
+Test(ilist_suite, clear_unlinks_everything) {
+  for (int i = 0; i < ITEMS; ++i)
+    tk_ilist_push_front(&list, &items[i].link);
+  tk_ilist_clear(&list);
+  cr_assert(tk_ilist_is_empty(&list));
+  for (int i = 0; i < ITEMS; ++i)
+    cr_assert_not(tk_ilist_node_is_linked(&items[i].link));
+  tk_ilist_push_back(&list, &items[7].link);
+  cr_assert_eq(tk_ilist_back(&list), &items[7]);
+}
@@ -10,6 +10,8 @@
 #include <criterion/criterion.h>
 #include <criterion/new/assert.h> // Modern assertion macros (eq, ne, etc.)
 #include <stdio.h>
+#include <stdlib.h>           // For malloc/free in the counting allocator
+#include <string.h>           // For memset
 #include <tk/core/iterator.h> // For tk_iterator_t and operations
 #include <tk/ds/list.h>       // The list implementation we are testing
 
@@ -401,3 +403,334 @@ Test(standalone_list_tests, destroy_full) {
                "The destroyer function was not called the correct number of "
                "times.");
 }
+
+// --- Standalone Test for inline node payloads ---
+
+typedef struct {
+  long long id;
+  char payload[240];
+} list_record_t;
+
+/**
+ * @brief Tests that large elements stored inline in the nodes round-trip
+ * intact and stay writable through mutable accessors and iterators.
+ */
+Test(standalone_list_tests, large_inline_elements) {
+  tk_list_t *lst = tk_list_create(sizeof(list_record_t));
+  cr_assert_not_null(lst);
+
+  for (int i = 0; i < 16; ++i) {
+    list_record_t rec = {.id = i};
+    memset(rec.payload, 'a' + i, sizeof(rec.payload));
+    cr_assert_eq(tk_list_push_back(lst, &rec), TK_SUCCESS);
+  }
+
+  // Write through the mutable front accessor, in place.
+  ((list_record_t *)tk_list_front_mut(lst))->id = 100;
+
+  int i = 0;
+  tk_iterator_t it = tk_list_begin(lst);
+  tk_iterator_t end = tk_list_end(lst);
+  while (!tk_iter_equal(&it, &end)) {
+    const list_record_t *rec = (const list_record_t *)tk_iter_get(&it);
+    cr_assert_eq(rec->id, i == 0 ? 100 : i);
+    cr_assert_eq(rec->payload[0], 'a' + i);
+    cr_assert_eq(rec->payload[sizeof(rec->payload) - 1], 'a' + i);
+    tk_iter_next(&it);
+    i++;
+  }
+  cr_assert_eq(i, 16);
+
+  tk_list_destroy(lst);
+}
+
+/**
+ * @brief Tests that the emplace functions link nodes whose payload is then
+ * written in place, at the position requested.
+ */
+Test(standalone_list_tests, emplace_constructs_in_place) {
+  tk_list_t *lst = tk_list_create(sizeof(list_record_t));
+  cr_assert_not_null(lst);
+
+  list_record_t *rec = (list_record_t *)tk_list_emplace_back(lst);
+  cr_assert_not_null(rec);
+  rec->id = 3;
+  rec = (list_record_t *)tk_list_emplace_front(lst);
+  rec->id = 0;
+  cr_assert_eq(tk_list_front(lst), rec, "The payload lives in the node");
+
+  // Before the second element, then before end (an append).
+  tk_iterator_t it = tk_list_begin(lst);
+  tk_iter_next(&it);
+  rec = (list_record_t *)tk_list_emplace_before(lst, it);
+  rec->id = 1;
+  memset(rec->payload, 'x', sizeof(rec->payload));
+  rec = (list_record_t *)tk_list_emplace_before(lst, tk_list_end(lst));
+  rec->id = 4;
+
+  int ids[] = {0, 1, 3, 4};
+  cr_assert_eq(tk_list_size(lst), 4);
+  it = tk_list_begin(lst);
+  for (int i = 0; i < 4; ++i, tk_iter_next(&it)) {
+    cr_assert_eq(((const list_record_t *)tk_iter_get(&it))->id, ids[i]);
+  }
+
+  // An iterator from another list is rejected without linking anything.
+  tk_list_t *other = tk_list_create(sizeof(list_record_t));
+  cr_assert_null(tk_list_emplace_before(lst, tk_list_end(other)));
+  cr_assert_eq(tk_list_size(lst), 4);
+  tk_list_destroy(other);
+  tk_list_destroy(lst);
+}
+
+// --- Test helpers for custom allocators ---
+
+/**
+ * @brief Bookkeeping for a counting allocator that forwards to malloc.
+ */
+typedef struct {
+  int allocs;
+  int frees;
+  long long bytes_live;
+} counting_ctx_t;
+
+static void *counting_alloc(void *ctx, size_t size) {
+  counting_ctx_t *c = (counting_ctx_t *)ctx;
+  c->allocs++;
+  c->bytes_live += (long long)size;
+  return malloc(size);
+}
+
+static void counting_free(void *ctx, void *ptr, size_t size) {
+  counting_ctx_t *c = (counting_ctx_t *)ctx;
+  c->frees++;
+  c->bytes_live -= (long long)size;
+  free(ptr);
+}
+
+/**
+ * @brief Tests that the handle and every node of a list are allocated
+ * through a custom allocator (one allocation per node) and balanced again by
+ * pops and destroy.
+ */
+Test(standalone_list_tests, custom_allocator) {
+  counting_ctx_t ctx = {0};
+  tk_allocator_t allocator = {
+      .alloc = counting_alloc, .free = counting_free, .ctx = &ctx};
+
+  tk_list_t *lst = tk_list_create_with_allocator(sizeof(int), &allocator);
+  cr_assert_not_null(lst);
+  cr_assert_eq(ctx.allocs, 1, "The handle should come from the allocator");
+
+  for (int i = 0; i < 10; ++i) {
+    cr_assert_eq(tk_list_push_back(lst, &i), TK_SUCCESS);
+  }
+  cr_assert_eq(ctx.allocs, 11, "Each node should be a single allocation");
+
+  tk_list_pop_front(lst);
+  tk_list_pop_back(lst);
+  cr_assert_eq(ctx.frees, 2);
+
+  tk_list_destroy(lst);
+  cr_assert_eq(ctx.allocs, ctx.frees, "Every allocation should be freed");
+  cr_assert_eq(ctx.bytes_live, 0, "Freed sizes should match allocated sizes");
+}
+
+/**
+ * @brief Tests a pooled list through push/pop churn, clear and iteration.
+ */
+Test(standalone_list_tests, pooled_list) {
+  tk_list_t *lst = tk_list_create_pooled(sizeof(int), 8);
+  cr_assert_not_null(lst);
+
+  // Churn: nodes freed by pop_front are recycled by push_back.
+  for (int i = 0; i < 100; ++i) {
+    cr_assert_eq(tk_list_push_back(lst, &i), TK_SUCCESS);
+    if (i % 3 == 2) {
+      tk_list_pop_front(lst);
+    }
+  }
+  cr_assert_eq(tk_list_size(lst), 67);
+  cr_assert_eq(*(int *)tk_list_front(lst), 33);
+  cr_assert_eq(*(int *)tk_list_back(lst), 99);
+
+  int expected = 33;
+  tk_iterator_t it = tk_list_begin(lst);
+  tk_iterator_t end = tk_list_end(lst);
+  while (!tk_iter_equal(&it, &end)) {
+    cr_assert_eq(*(int *)tk_iter_get(&it), expected++);
+    tk_iter_next(&it);
+  }
+  cr_assert_eq(expected, 100);
+
+  // Clear recycles every node; the list stays usable.
+  tk_list_clear(lst);
+  cr_assert(tk_list_is_empty(lst));
+  for (int i = 0; i < 20; ++i) {
+    cr_assert_eq(tk_list_push_front(lst, &i), TK_SUCCESS);
+  }
+  cr_assert_eq(*(int *)tk_list_front(lst), 19);
+  cr_assert_eq(*(int *)tk_list_back(lst), 0);
+
+  g_list_destroy_counter = 0;
+  tk_list_destroy_full(lst, test_list_element_destroyer);
+  cr_assert_eq(g_list_destroy_counter, 20);
+}
+
+// --- Bulk Modifiers ---
+
+/**
+ * @brief Asserts that a list of ints holds exactly `expected`, both by
+ * iteration and by its O(1) size.
+ */
+static void assert_list_ints(tk_list_t *lst, const int *expected, size_t n) {
+  cr_assert_eq(tk_list_size(lst), n);
+  size_t i = 0;
+  tk_iterator_t it = tk_list_begin(lst);
+  tk_iterator_t end = tk_list_end(lst);
+  for (; !tk_iter_equal(&it, &end); tk_iter_next(&it), ++i) {
+    cr_assert_lt(i, n);
+    cr_assert_eq(*(int *)tk_iter_get(&it), expected[i]);
+  }
+  cr_assert_eq(i, n);
+}
+
+/**
+ * @brief Returns an iterator `n` steps from the beginning of `lst`.
+ */
+static tk_iterator_t list_iter_at(tk_list_t *lst, int n) {
+  tk_iterator_t it = tk_list_begin(lst);
+  while (n-- > 0) {
+    tk_iter_next(&it);
+  }
+  return it;
+}
+
+Test(list_suite, next_block_walks_nodes) {
+  for (int i = 0; i < 10; ++i)
+    tk_list_push_back(list_int, &i);
+
+  tk_iterator_t it = tk_list_begin(list_int), end = tk_list_end(list_int);
+  void *ptrs[4];
+  int expected = 0;
+  size_t n, calls = 0;
+  while ((n = tk_iter_next_block(&it, &end, ptrs, 4)) > 0) {
+    ++calls;
+    for (size_t i = 0; i < n; ++i)
+      cr_assert_eq(*(int *)ptrs[i], expected++);
+  }
+  cr_assert_eq(expected, 10);
+  cr_assert_eq(calls, 3, "Blocks of 4, 4 and 2");
+  cr_assert(tk_iter_equal(&it, &end));
+
+  // A sub-range stops at its own end.
+  tk_iterator_t first = tk_list_begin(list_int), last = first;
+  tk_iter_next(&last);
+  tk_iter_next(&last);
+  cr_assert_eq(tk_iter_next_block(&first, &last, ptrs, 4), 2);
+  cr_assert(tk_iter_equal(&first, &last));
+}
+
+Test(list_suite, push_back_n) {
+  int first = -1;
+  tk_list_push_back(list_int, &first);
+  int values[5] = {0, 1, 2, 3, 4};
+  cr_assert_eq(tk_list_push_back_n(list_int, values, 5), TK_SUCCESS);
+  cr_assert_eq(tk_list_push_back_n(list_int, NULL, 0), TK_SUCCESS);
+  int expected[6] = {-1, 0, 1, 2, 3, 4};
+  assert_list_ints(list_int, expected, 6);
+  cr_assert_eq(*(int *)tk_list_back(list_int), 4);
+}
+
+Test(list_suite, splice_relinks_between_lists) {
+  int values[6] = {0, 1, 2, 3, 4, 5};
+  tk_list_push_back_n(list_int, values, 6);
+  tk_list_t *other = tk_list_create(sizeof(int));
+  int others[2] = {10, 11};
+  tk_list_push_back_n(other, others, 2);
+
+  // Move {2, 3, 4} before 11. The nodes themselves move, not copies.
+  tk_iterator_t first = list_iter_at(list_int, 2);
+  const void *address_of_2 = tk_iter_get(&first);
+  cr_assert_eq(tk_list_splice(other, list_iter_at(other, 1), list_int, first,
+                              list_iter_at(list_int, 5)),
+               TK_SUCCESS);
+  int expected_src[3] = {0, 1, 5};
+  int expected_dst[5] = {10, 2, 3, 4, 11};
+  assert_list_ints(list_int, expected_src, 3);
+  assert_list_ints(other, expected_dst, 5);
+  tk_iterator_t moved = list_iter_at(other, 1);
+  cr_assert_eq(tk_iter_get(&moved), address_of_2);
+
+  // Splice the tail of one list onto the end of the other.
+  cr_assert_eq(tk_list_splice(list_int, tk_list_end(list_int), other,
+                              list_iter_at(other, 3), tk_list_end(other)),
+               TK_SUCCESS);
+  int expected_src2[5] = {0, 1, 5, 4, 11};
+  int expected_dst2[3] = {10, 2, 3};
+  assert_list_ints(list_int, expected_src2, 5);
+  assert_list_ints(other, expected_dst2, 3);
+  cr_assert_eq(*(int *)tk_list_back(other), 3);
+
+  // Iterators from the wrong list are rejected.
+  cr_assert_eq(tk_list_splice(other, tk_list_begin(list_int), list_int,
+                              tk_list_begin(list_int), tk_list_end(list_int)),
+               TK_E_INVALID_ARG);
+  tk_list_destroy(other);
+}
+
+Test(list_suite, splice_within_one_list) {
+  int values[5] = {0, 1, 2, 3, 4};
+  tk_list_push_back_n(list_int, values, 5);
+
+  // Rotate {3, 4} to the front.
+  cr_assert_eq(tk_list_splice(list_int, tk_list_begin(list_int), list_int,
+                              list_iter_at(list_int, 3), tk_list_end(list_int)),
+               TK_SUCCESS);
+  int expected[5] = {3, 4, 0, 1, 2};
+  assert_list_ints(list_int, expected, 5);
+  cr_assert_eq(*(int *)tk_list_back(list_int), 2);
+
+  // Move the head to the end.
+  tk_iterator_t second = list_iter_at(list_int, 1);
+  cr_assert_eq(tk_list_splice(list_int, tk_list_end(list_int), list_int,
+                              tk_list_begin(list_int), second),
+               TK_SUCCESS);
+  int expected2[5] = {4, 0, 1, 2, 3};
+  assert_list_ints(list_int, expected2, 5);
+}
+
+/**
+ * @brief Appending between lists that share an allocator relinks the nodes
+ * without allocating; a pooled source has to be copied.
+ */
+Test(standalone_list_tests, append_list) {
+  counting_ctx_t ctx = {0};
+  tk_allocator_t allocator = {
+      .alloc = counting_alloc, .free = counting_free, .ctx = &ctx};
+  tk_list_t *a = tk_list_create_with_allocator(sizeof(int), &allocator);
+  tk_list_t *b = tk_list_create_with_allocator(sizeof(int), &allocator);
+  int values[4] = {0, 1, 2, 3};
+  tk_list_push_back_n(a, values, 2);
+  tk_list_push_back_n(b, values + 2, 2);
+
+  int allocs = ctx.allocs;
+  cr_assert_eq(tk_list_append_list(a, b), TK_SUCCESS);
+  cr_assert_eq(ctx.allocs, allocs, "Relinking must not allocate");
+  cr_assert(tk_list_is_empty(b));
+  assert_list_ints(a, values, 4);
+
+  tk_list_t *pooled = tk_list_create_pooled(sizeof(int), 8);
+  int more[2] = {4, 5};
+  tk_list_push_back_n(pooled, more, 2);
+  cr_assert_eq(tk_list_append_list(a, pooled), TK_SUCCESS);
+  cr_assert(tk_list_is_empty(pooled));
+  int expected[6] = {0, 1, 2, 3, 4, 5};
+  assert_list_ints(a, expected, 6);
+
+  tk_list_destroy(pooled);
+  tk_list_destroy(b);
+  tk_list_destroy(a);
+  cr_assert_eq(ctx.allocs, ctx.frees);
+  cr_assert_eq(ctx.bytes_live, 0);
+}
@@ -0,0 +1,195 @@
+/**
+ * @file test_mmvec.c
+ * @brief Unit tests for the file-backed tk_mmvec_t vector.
+ *
+ * Every test works on its own temporary file, removed again at teardown.
+ */
+
+#define _POSIX_C_SOURCE 200809L // For mkstemp and unlink
+
+#include <criterion/criterion.h>
+#include <criterion/new/assert.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <tk/algo/sequence.h>
+#include <tk/ds/mmvec.h>
+#include <unistd.h>
+
+typedef struct {
+  int id;
+  double score;
+} record_t;
+
+// --- Test Fixture ---
+
+static char path[64];
+
+// Setup: reserve a unique path. The file is removed so each test decides
+// how it is created.
+void setup_mmvec(void) {
+  strcpy(path, "/tmp/tk_mmvec_XXXXXX");
+  int fd = mkstemp(path);
+  cr_assert_geq(fd, 0);
+  close(fd);
+  unlink(path);
+}
+
+void teardown_mmvec(void) { unlink(path); }
+
+TestSuite(mmvec_suite, .init = setup_mmvec, .fini = teardown_mmvec);
+
+static tk_bool has_id_77(const void *element) {
+  return ((const record_t *)element)->id == 77;
+}
+
+// --- Test Cases ---
+
+Test(mmvec_suite, records_persist_across_reopen) {
+  tk_mmvec_t *vec = tk_mmvec_open(path, sizeof(record_t), TK_MMVEC_CREATE);
+  cr_assert_not_null(vec);
+  cr_assert(tk_mmvec_is_empty(vec));
+
+  for (int i = 0; i < 100; ++i) {
+    record_t rec = {.id = i, .score = i * 0.5};
+    cr_assert_eq(tk_mmvec_push_back(vec, &rec), TK_SUCCESS);
+  }
+  record_t *slot = (record_t *)tk_mmvec_emplace_back(vec);
+  cr_assert_not_null(slot);
+  slot->id = 1000;
+  slot->score = -1.0;
+  size_t capacity = tk_mmvec_capacity(vec);
+  cr_assert_eq(tk_mmvec_sync(vec), TK_SUCCESS);
+  tk_mmvec_close(vec);
+
+  // Reopen: the records are mapped back as they were, capacity included.
+  vec = tk_mmvec_open(path, sizeof(record_t), 0);
+  cr_assert_not_null(vec);
+  cr_assert_eq(tk_mmvec_size(vec), 101);
+  cr_assert_eq(tk_mmvec_capacity(vec), capacity);
+  cr_assert_eq(((record_t *)tk_mmvec_at(vec, 42))->score, 21.0);
+  cr_assert_eq(((record_t *)tk_mmvec_back(vec))->id, 1000);
+  cr_assert_null(tk_mmvec_at(vec, 101));
+
+  tk_mmvec_pop_back(vec);
+  tk_mmvec_close(vec);
+
+  vec = tk_mmvec_open(path, sizeof(record_t), TK_MMVEC_READ_ONLY);
+  cr_assert_not_null(vec);
+  cr_assert(tk_mmvec_is_read_only(vec));
+  cr_assert_eq(tk_mmvec_size(vec), 100, "The pop must have persisted");
+  tk_mmvec_close(vec);
+}
+
+Test(mmvec_suite, emplace_back_clears_the_slot) {
+  tk_mmvec_t *vec = tk_mmvec_open(path, sizeof(record_t), TK_MMVEC_CREATE);
+  record_t rec = {.id = 77, .score = 3.5};
+  tk_mmvec_push_back(vec, &rec);
+  tk_mmvec_pop_back(vec);
+
+  // The popped record's bytes are still in the mapping; they must not
+  // reappear in the published slot.
+  record_t *slot = (record_t *)tk_mmvec_emplace_back(vec);
+  cr_assert_not_null(slot);
+  cr_assert_eq(tk_mmvec_size(vec), 1);
+  cr_assert_eq(slot->id, 0);
+  cr_assert_eq(slot->score, 0.0);
+  tk_mmvec_close(vec);
+}
+
+Test(mmvec_suite, read_only_rejects_modifiers) {
+  tk_mmvec_t *vec = tk_mmvec_open(path, sizeof(int), TK_MMVEC_CREATE);
+  int value = 5;
+  tk_mmvec_push_back(vec, &value);
+  tk_mmvec_close(vec);
+
+  vec = tk_mmvec_open(path, sizeof(int), TK_MMVEC_READ_ONLY);
+  cr_assert_not_null(vec);
+  cr_assert_eq(tk_mmvec_push_back(vec, &value), TK_E_INVALID_ARG);
+  cr_assert_eq(tk_mmvec_reserve(vec, 100), TK_E_INVALID_ARG);
+  cr_assert_eq(tk_mmvec_shrink_to_fit(vec), TK_E_INVALID_ARG);
+  cr_assert_null(tk_mmvec_emplace_back(vec));
+  cr_assert_eq(tk_mmvec_pop_back(vec), TK_E_INVALID_ARG);
+  cr_assert_eq(tk_mmvec_clear(vec), TK_E_INVALID_ARG);
+  cr_assert_eq(tk_mmvec_size(vec), 1);
+  cr_assert_eq(*(int *)tk_mmvec_front(vec), 5);
+  tk_mmvec_close(vec);
+
+  cr_assert_null(
+      tk_mmvec_open(path, sizeof(int), TK_MMVEC_READ_ONLY | TK_MMVEC_CREATE));
+  cr_assert_eq(errno, EINVAL);
+}
+
+Test(mmvec_suite, open_validates_the_file) {
+  cr_assert_null(tk_mmvec_open(path, sizeof(int), 0), "Missing file");
+  cr_assert_eq(errno, ENOENT);
+
+  tk_mmvec_t *vec = tk_mmvec_open(path, sizeof(int), TK_MMVEC_CREATE);
+  tk_mmvec_close(vec);
+  cr_assert_null(tk_mmvec_open(path, sizeof(double), 0), "Wrong size");
+  cr_assert_eq(errno, EINVAL);
+
+  FILE *file = fopen(path, "wb");
+  fputs("definitely not a vector, but longer than the header...........", file);
+  fclose(file);
+  cr_assert_null(tk_mmvec_open(path, sizeof(int), 0), "Bad magic");
+  cr_assert_eq(errno, EINVAL);
+
+  // TRUNCATE starts over, whatever the file held.
+  vec = tk_mmvec_open(path, sizeof(int), TK_MMVEC_TRUNCATE);
+  cr_assert_not_null(vec);
+  cr_assert(tk_mmvec_is_empty(vec));
+  tk_mmvec_close(vec);
+}
+
+Test(mmvec_suite, growth_and_shrink_to_fit) {
+  tk_mmvec_t *vec = tk_mmvec_open(path, sizeof(int), TK_MMVEC_CREATE);
+  int batch[1000];
+  for (int i = 0; i < 1000; ++i) {
+    batch[i] = i;
+  }
+  for (int round = 0; round < 20; ++round) {
+    cr_assert_eq(tk_mmvec_push_back_n(vec, batch, 1000), TK_SUCCESS);
+  }
+  cr_assert_eq(tk_mmvec_size(vec), 20000);
+  cr_assert_geq(tk_mmvec_capacity(vec), 20000);
+  for (size_t i = 0; i < 20000; i += 997) {
+    cr_assert_eq(*(int *)tk_mmvec_at(vec, i), (int)(i % 1000));
+  }
+
+  cr_assert_eq(tk_mmvec_reserve(vec, 50000), TK_SUCCESS);
+  cr_assert_eq(tk_mmvec_capacity(vec), 50000);
+  cr_assert_eq(tk_mmvec_shrink_to_fit(vec), TK_SUCCESS);
+  cr_assert_eq(tk_mmvec_capacity(vec), 20000);
+  struct stat st;
+  cr_assert_eq(stat(path, &st), 0);
+  cr_assert_eq((size_t)st.st_size, 64 + 20000 * sizeof(int),
+               "The file is header plus records");
+
+  tk_mmvec_clear(vec);
+  cr_assert(tk_mmvec_is_empty(vec));
+  cr_assert_eq(tk_mmvec_capacity(vec), 20000, "Clear keeps the file");
+  tk_mmvec_close(vec);
+}
+
+Test(mmvec_suite, contiguous_iterators) {
+  tk_mmvec_t *vec = tk_mmvec_open(path, sizeof(record_t), TK_MMVEC_CREATE);
+  for (int i = 0; i < 200; ++i) {
+    record_t rec = {.id = i, .score = 0.0};
+    tk_mmvec_push_back(vec, &rec);
+  }
+
+  tk_iterator_t begin = tk_mmvec_begin(vec), end = tk_mmvec_end(vec);
+  cr_assert_eq(begin.vtable->category, TK_ITER_RANDOM_ACCESS);
+  cr_assert_eq(tk_iter_distance(&begin, &end), 200);
+  size_t stride = 0;
+  cr_assert_eq(tk_iter_contiguous(&begin, &stride), tk_mmvec_data(vec));
+  cr_assert_eq(stride, sizeof(record_t));
+
+  tk_iterator_t found = tk_algo_find_if(begin, end, has_id_77);
+  cr_assert_eq(tk_iter_get(&found), tk_mmvec_at(vec, 77));
+  cr_assert_eq(((record_t *)tk_iter_at(&begin, 150))->id, 150);
+  tk_mmvec_close(vec);
+}
@@ -0,0 +1,192 @@
+/**
+ * @file test_ring.c
+ * @brief Unit tests for the tk_ring_t ring buffer.
+ *
+ * The threaded tests hand a known sequence of values through the ring and
+ * check that nothing is lost, duplicated or reordered.
+ */
+
+#define _POSIX_C_SOURCE 200809L // For pthreads and sched_yield
+
+#include <criterion/criterion.h>
+#include <criterion/new/assert.h>
+#include <pthread.h>
+#include <sched.h>
+#include <tk/ds/ring.h>
+
+#define ITEMS 200000
+#define THREADS 4
+
+// --- Test Fixture ---
+
+static tk_ring_t *ring;
+
+void setup_ring(void) {
+  ring = tk_ring_create(sizeof(int), 6, TK_RING_SPSC);
+  cr_assert_not_null(ring);
+}
+
+void teardown_ring(void) { tk_ring_destroy(ring); }
+
+TestSuite(ring_suite, .init = setup_ring, .fini = teardown_ring);
+
+// --- Thread Bodies ---
+
+typedef struct {
+  tk_ring_t *ring;
+  int first; // First value to push
+  int count; // Values to push or pop
+  long long sum;
+  tk_bool in_order;
+} worker_t;
+
+static void *producer(void *arg) {
+  worker_t *w = (worker_t *)arg;
+  int batch[8];
+  for (int i = 0; i < w->count;) {
+    int n = w->count - i < 8 ? w->count - i : 8;
+    for (int k = 0; k < n; ++k)
+      batch[k] = w->first + i + k;
+    size_t pushed = tk_ring_push_n(w->ring, batch, (size_t)n);
+    if (pushed == 0)
+      sched_yield(); // Full: let the consumers run
+    i += (int)pushed;
+  }
+  return NULL;
+}
+
+static void *consumer(void *arg) {
+  worker_t *w = (worker_t *)arg;
+  int batch[8], expected = w->first;
+  w->in_order = true;
+  for (int i = 0; i < w->count;) {
+    size_t want = w->count - i < 8 ? (size_t)(w->count - i) : 8;
+    size_t n = tk_ring_pop_n(w->ring, batch, want);
+    if (n == 0)
+      sched_yield(); // Empty: let the producers run
+    for (size_t k = 0; k < n; ++k) {
+      w->sum += batch[k];
+      if (batch[k] != expected++)
+        w->in_order = false;
+    }
+    i += (int)n;
+  }
+  return NULL;
+}
+
+// --- Test Cases ---
+
+Test(ring_suite, capacity_is_rounded_up) {
+  cr_assert_eq(tk_ring_capacity(ring), 8);
+  cr_assert_eq(tk_ring_element_size(ring), sizeof(int));
+  cr_assert(tk_ring_is_empty(ring));
+}
+
+Test(ring_suite, push_pop_fifo_with_wraparound) {
+  int value;
+  for (int round = 0; round < 5; ++round) {
+    for (int i = 0; i < 5; ++i) {
+      value = round * 10 + i;
+      cr_assert_eq(tk_ring_push(ring, &value), TK_SUCCESS);
+    }
+    cr_assert_eq(tk_ring_size(ring), 5);
+    for (int i = 0; i < 5; ++i) {
+      cr_assert_eq(tk_ring_pop(ring, &value), TK_SUCCESS);
+      cr_assert_eq(value, round * 10 + i);
+    }
+  }
+  cr_assert_eq(tk_ring_pop(ring, &value), TK_E_EMPTY);
+}
+
+Test(ring_suite, full_ring_rejects_pushes) {
+  int values[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  cr_assert_eq(tk_ring_push_n(ring, values, 10), 8);
+  cr_assert_eq(tk_ring_push(ring, &values[8]), TK_E_FULL);
+  cr_assert_eq(tk_ring_size(ring), 8);
+
+  int out[10];
+  cr_assert_eq(tk_ring_pop_n(ring, NULL, 3), 3); // Discard three
+  cr_assert_eq(tk_ring_push_n(ring, &values[8], 2), 2);
+  cr_assert_eq(tk_ring_pop_n(ring, out, 10), 7);
+  int expected[7] = {3, 4, 5, 6, 7, 8, 9};
+  cr_assert_arr_eq(out, expected, sizeof(expected));
+}
+
+Test(ring_suite, iterator_drains_in_order) {
+  int values[8] = {10, 11, 12, 13, 14, 15, 16, 17};
+  tk_ring_push_n(ring, values, 4);
+  tk_ring_pop(ring, NULL);
+  tk_ring_push_n(ring, &values[4], 2); // Crosses the wrap point: 11..15
+
+  tk_iterator_t it = tk_ring_begin(ring), end = tk_ring_end(ring);
+  int expected = 11;
+  for (; !tk_iter_equal(&it, &end); tk_iter_next(&it))
+    cr_assert_eq(*(int *)tk_iter_get(&it), expected++);
+  cr_assert_eq(expected, 16);
+
+  // Nothing is removed until the view is consumed.
+  cr_assert_eq(tk_ring_size(ring), 5);
+  tk_ring_consume(ring, &end);
+  cr_assert(tk_ring_is_empty(ring));
+  cr_assert_eq(tk_ring_push_n(ring, values, 8), 8);
+}
+
+Test(ring_suite, mpmc_single_thread_and_iterator) {
+  tk_ring_t *mpmc = tk_ring_create(sizeof(int), 4, TK_RING_MPMC);
+  cr_assert_not_null(mpmc);
+  int values[5] = {1, 2, 3, 4, 5}, out = 0;
+  cr_assert_eq(tk_ring_push_n(mpmc, values, 5), 4);
+  cr_assert_eq(tk_ring_pop(mpmc, &out), TK_SUCCESS);
+  cr_assert_eq(out, 1);
+  cr_assert_eq(tk_ring_push(mpmc, &values[4]), TK_SUCCESS);
+  cr_assert_eq(tk_ring_push(mpmc, &values[4]), TK_E_FULL);
+
+  tk_iterator_t it = tk_ring_begin(mpmc), end = tk_ring_end(mpmc);
+  int expected = 2;
+  for (; !tk_iter_equal(&it, &end); tk_iter_next(&it))
+    cr_assert_eq(*(int *)tk_iter_get(&it), expected++);
+  cr_assert_eq(expected, 6);
+  tk_ring_consume(mpmc, &end);
+  cr_assert_eq(tk_ring_pop(mpmc, &out), TK_E_EMPTY);
+
+  // The consumed slots are usable for another lap.
+  cr_assert_eq(tk_ring_push_n(mpmc, values, 4), 4);
+  cr_assert_eq(tk_ring_pop(mpmc, &out), TK_SUCCESS);
+  cr_assert_eq(out, 1);
+  tk_ring_destroy(mpmc);
+}
+
+Test(ring_suite, spsc_threads_preserve_order) {
+  worker_t prod = {ring, 0, ITEMS, 0, false};
+  worker_t cons = {ring, 0, ITEMS, 0, false};
+  pthread_t threads[2];
+  pthread_create(&threads[0], NULL, producer, &prod);
+  pthread_create(&threads[1], NULL, consumer, &cons);
+  pthread_join(threads[0], NULL);
+  pthread_join(threads[1], NULL);
+  cr_assert(cons.in_order);
+  cr_assert_eq(cons.sum, (long long)ITEMS * (ITEMS - 1) / 2);
+}
+
+Test(ring_suite, mpmc_threads_lose_nothing) {
+  tk_ring_t *mpmc = tk_ring_create(sizeof(int), 64, TK_RING_MPMC);
+  cr_assert_not_null(mpmc);
+  worker_t prods[THREADS], conss[THREADS];
+  pthread_t threads[2 * THREADS];
+  int per_thread = ITEMS / THREADS;
+  for (int i = 0; i < THREADS; ++i) {
+    prods[i] = (worker_t){mpmc, i * per_thread, per_thread, 0, false};
+    conss[i] = (worker_t){mpmc, 0, per_thread, 0, false};
+    pthread_create(&threads[i], NULL, producer, &prods[i]);
+    pthread_create(&threads[THREADS + i], NULL, consumer, &conss[i]);
+  }
+  long long sum = 0;
+  for (int i = 0; i < 2 * THREADS; ++i)
+    pthread_join(threads[i], NULL);
+  for (int i = 0; i < THREADS; ++i)
+    sum += conss[i].sum;
+  long long total = (long long)per_thread * THREADS;
+  cr_assert_eq(sum, total * (total - 1) / 2);
+  cr_assert(tk_ring_is_empty(mpmc));
+  tk_ring_destroy(mpmc);
+}
@@ -0,0 +1,112 @@
+/**
+ * @file test_typed.c
+ * @brief Unit tests for the TK_VEC_DEFINE / TK_LIST_DEFINE typed containers.
+ *
+ * This file instantiates the code-generation macros for a primitive and a
+ * struct type and checks the generated functions.
+ */
+
+#include <criterion/criterion.h>
+#include <criterion/new/assert.h>
+#include <tk/ds/typed_list.h>
+#include <tk/ds/typed_vec.h>
+
+typedef struct {
+  int x;
+  int y;
+} point_t;
+
+TK_VEC_DEFINE(int_vec, int)
+TK_VEC_DEFINE(point_vec, point_t)
+TK_LIST_DEFINE(int_list, int)
+
+// --- Typed Vector Tests ---
+
+Test(typed_vec_suite, push_at_pop) {
+  int_vec_t v;
+  int_vec_init(&v);
+  cr_assert(int_vec_is_empty(&v));
+  cr_assert_null(int_vec_back(&v));
+
+  for (int i = 0; i < 1000; ++i) {
+    cr_assert_eq(int_vec_push_back(&v, i * 2), TK_SUCCESS);
+  }
+  cr_assert_eq(int_vec_size(&v), 1000);
+  cr_assert_geq(int_vec_capacity(&v), 1000);
+  cr_assert_eq(*int_vec_at(&v, 500), 1000);
+  cr_assert_null(int_vec_at(&v, 1000), "at(size) is out of bounds");
+  cr_assert_eq(int_vec_data(&v)[999], 1998);
+
+  int out = 0;
+  cr_assert_eq(int_vec_pop_back(&v, &out), TK_SUCCESS);
+  cr_assert_eq(out, 1998);
+  cr_assert_eq(*int_vec_back(&v), 1996);
+
+  int_vec_clear(&v);
+  cr_assert_eq(int_vec_pop_back(&v, NULL), TK_E_EMPTY);
+
+  int_vec_destroy(&v);
+}
+
+Test(typed_vec_suite, struct_elements_and_reserve) {
+  point_vec_t v;
+  point_vec_init(&v);
+  cr_assert_eq(point_vec_reserve(&v, 10), TK_SUCCESS);
+  cr_assert_eq(point_vec_capacity(&v), 10);
+
+  for (int i = 0; i < 10; ++i) {
+    point_t p = {.x = i, .y = -i};
+    point_vec_push_back(&v, p);
+  }
+  cr_assert_eq(point_vec_capacity(&v), 10, "No growth within the reserve");
+
+  point_vec_at(&v, 3)->y = 42;
+  cr_assert_eq(point_vec_at(&v, 3)->x, 3);
+  cr_assert_eq(point_vec_at(&v, 3)->y, 42);
+
+  point_t *p = point_vec_emplace_back(&v);
+  cr_assert_not_null(p);
+  p->x = 10;
+  p->y = -10;
+  cr_assert_eq(point_vec_size(&v), 11);
+  cr_assert_eq(point_vec_back(&v)->y, -10);
+
+  point_vec_destroy(&v);
+}
+
+// --- Typed List Tests ---
+
+Test(typed_list_suite, push_pop_both_ends) {
+  int_list_t l;
+  int_list_init(&l);
+  cr_assert(int_list_is_empty(&l));
+  cr_assert_null(int_list_front(&l));
+
+  int_list_push_back(&l, 2);
+  int_list_push_back(&l, 3);
+  int_list_push_front(&l, 1); // {1, 2, 3}
+  cr_assert_eq(int_list_size(&l), 3);
+  cr_assert_eq(*int_list_front(&l), 1);
+  cr_assert_eq(*int_list_back(&l), 3);
+
+  int expected = 1;
+  for (int_list_node_t *n = l.head; n; n = n->next) {
+    cr_assert_eq(n->value, expected++);
+  }
+
+  int out = 0;
+  cr_assert_eq(int_list_pop_front(&l, &out), TK_SUCCESS);
+  cr_assert_eq(out, 1);
+  cr_assert_eq(int_list_pop_back(&l, &out), TK_SUCCESS);
+  cr_assert_eq(out, 3);
+  cr_assert_eq(int_list_pop_back(&l, NULL), TK_SUCCESS);
+  cr_assert_eq(int_list_pop_front(&l, NULL), TK_E_EMPTY);
+  cr_assert(int_list_is_empty(&l));
+
+  int_list_push_back(&l, 7);
+  *int_list_emplace_back(&l) = 8;
+  cr_assert_eq(*int_list_back(&l), 8);
+  cr_assert_eq(int_list_size(&l), 2);
+  int_list_destroy(&l);
+  cr_assert(int_list_is_empty(&l));
+}
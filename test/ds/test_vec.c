@@ -9,6 +9,7 @@
 #include <criterion/criterion.h>
 #include <criterion/new/assert.h> // Modern assertion macros (eq, ne, etc.)
 #include <stdio.h>
+#include <stdlib.h> // For malloc/realloc/free in the counting allocator
 #include <string.h> // For strcmp in struct test
 #include <tk/core/iterator.h>
 #include <tk/ds/vec.h>
@@ -103,6 +104,157 @@ Test(vec_suite, reserve_edge_cases) {
   cr_assert_eq(tk_vec_size(vec), 5, "Size should not change when reserving 0");
 }
 
+Test(vec_suite, push_back_n_and_insert_range) {
+  int batch[100];
+  for (int i = 0; i < 100; ++i) {
+    batch[i] = i;
+  }
+
+  cr_assert_eq(tk_vec_push_back_n(vec, batch, 100), TK_SUCCESS);
+  cr_assert_eq(tk_vec_size(vec), 100);
+  cr_assert_eq(tk_vec_push_back_n(vec, NULL, 0), TK_SUCCESS);
+
+  // Insert {-1, -2, -3} before index 10.
+  int middle[] = {-1, -2, -3};
+  cr_assert_eq(tk_vec_insert_range(vec, 10, middle, 3), TK_SUCCESS);
+  cr_assert_eq(tk_vec_size(vec), 103);
+  cr_assert_eq(*(int *)tk_vec_at(vec, 9), 9);
+  cr_assert_eq(*(int *)tk_vec_at(vec, 10), -1);
+  cr_assert_eq(*(int *)tk_vec_at(vec, 12), -3);
+  cr_assert_eq(*(int *)tk_vec_at(vec, 13), 10);
+  cr_assert_eq(*(int *)tk_vec_back(vec), 99);
+
+  // Insert at the front and at the very end.
+  cr_assert_eq(tk_vec_insert_range(vec, 0, middle, 1), TK_SUCCESS);
+  cr_assert_eq(*(int *)tk_vec_front(vec), -1);
+  cr_assert_eq(tk_vec_insert_range(vec, tk_vec_size(vec), middle + 2, 1),
+               TK_SUCCESS);
+  cr_assert_eq(*(int *)tk_vec_back(vec), -3);
+
+  cr_assert_eq(tk_vec_insert_range(vec, tk_vec_size(vec) + 1, middle, 1),
+               TK_E_OUT_OF_BOUNDS);
+}
+
+Test(vec_suite, erase_range) {
+  for (int i = 0; i < 10; ++i) {
+    tk_vec_push_back(vec, &i);
+  }
+  size_t capacity = tk_vec_capacity(vec);
+
+  // Remove {3, 4, 5}.
+  cr_assert_eq(tk_vec_erase_range(vec, 3, 3), TK_SUCCESS);
+  cr_assert_eq(tk_vec_size(vec), 7);
+  int expected[] = {0, 1, 2, 6, 7, 8, 9};
+  for (int i = 0; i < 7; ++i) {
+    cr_assert_eq(*(int *)tk_vec_at(vec, i), expected[i]);
+  }
+  cr_assert_eq(tk_vec_capacity(vec), capacity, "Erase keeps the capacity");
+
+  // Remove the tail, then reject ranges that run past the end.
+  cr_assert_eq(tk_vec_erase_range(vec, 5, 2), TK_SUCCESS);
+  cr_assert_eq(tk_vec_size(vec), 5);
+  cr_assert_eq(tk_vec_erase_range(vec, 4, 2), TK_E_OUT_OF_BOUNDS);
+  cr_assert_eq(tk_vec_erase_range(vec, 6, 0), TK_E_OUT_OF_BOUNDS);
+  cr_assert_eq(tk_vec_erase_range(vec, 5, 0), TK_SUCCESS);
+}
+
+Test(vec_suite, resize_and_assign) {
+  int fill = 7;
+  cr_assert_eq(tk_vec_resize(vec, 37, &fill), TK_SUCCESS);
+  cr_assert_eq(tk_vec_size(vec), 37);
+  for (int i = 0; i < 37; ++i) {
+    cr_assert_eq(*(int *)tk_vec_at(vec, i), 7);
+  }
+
+  // Growing without a fill value zeroes the new elements.
+  cr_assert_eq(tk_vec_resize(vec, 40, NULL), TK_SUCCESS);
+  cr_assert_eq(*(int *)tk_vec_at(vec, 36), 7);
+  cr_assert_eq(*(int *)tk_vec_at(vec, 39), 0);
+
+  // Shrinking keeps the prefix and the capacity.
+  size_t capacity = tk_vec_capacity(vec);
+  cr_assert_eq(tk_vec_resize(vec, 2, &fill), TK_SUCCESS);
+  cr_assert_eq(tk_vec_size(vec), 2);
+  cr_assert_eq(tk_vec_capacity(vec), capacity);
+
+  int values[] = {5, 4, 3};
+  cr_assert_eq(tk_vec_assign(vec, values, 3), TK_SUCCESS);
+  cr_assert_eq(tk_vec_size(vec), 3);
+  cr_assert_eq(*(int *)tk_vec_front(vec), 5);
+  cr_assert_eq(*(int *)tk_vec_back(vec), 3);
+
+  cr_assert_eq(tk_vec_assign(vec, NULL, 0), TK_SUCCESS);
+  cr_assert(tk_vec_is_empty(vec));
+}
+
+Test(vec_suite, shrink_to_fit) {
+  for (int i = 0; i < 100; ++i) {
+    tk_vec_push_back(vec, &i);
+  }
+  tk_vec_erase_range(vec, 10, 90);
+  cr_assert_geq(tk_vec_capacity(vec), 100);
+
+  cr_assert_eq(tk_vec_shrink_to_fit(vec), TK_SUCCESS);
+  cr_assert_eq(tk_vec_capacity(vec), 10);
+  cr_assert_eq(*(int *)tk_vec_back(vec), 9, "Shrinking must keep elements");
+
+  // An empty vector gives all of its storage back.
+  tk_vec_clear(vec);
+  cr_assert_eq(tk_vec_shrink_to_fit(vec), TK_SUCCESS);
+  cr_assert_eq(tk_vec_capacity(vec), 0);
+  cr_assert_null(tk_vec_data(vec));
+  int value = 1;
+  cr_assert_eq(tk_vec_push_back(vec, &value), TK_SUCCESS);
+}
+
+Test(vec_suite, growth_factor) {
+  cr_assert_eq(tk_vec_set_growth_factor(vec, 1, 1), TK_E_INVALID_ARG);
+  cr_assert_eq(tk_vec_set_growth_factor(vec, 3, 0), TK_E_INVALID_ARG);
+  cr_assert_eq(tk_vec_set_growth_factor(vec, 3, 2), TK_SUCCESS);
+
+  cr_assert_eq(tk_vec_reserve(vec, 100), TK_SUCCESS);
+  cr_assert_eq(tk_vec_capacity(vec), 100, "Reserve should be exact");
+  for (int i = 0; i < 101; ++i) {
+    tk_vec_push_back(vec, &i);
+  }
+  cr_assert_eq(tk_vec_capacity(vec), 150, "Growth should be 1.5x");
+}
+
+Test(vec_suite, auto_shrink_hysteresis) {
+  tk_vec_set_auto_shrink(vec, true);
+  for (int i = 0; i < 1024; ++i) {
+    tk_vec_push_back(vec, &i);
+  }
+  cr_assert_eq(tk_vec_capacity(vec), 1024);
+
+  // Nothing is given back until the size reaches a quarter of the capacity.
+  while (tk_vec_size(vec) > 257) {
+    tk_vec_pop_back(vec);
+  }
+  cr_assert_eq(tk_vec_capacity(vec), 1024);
+  tk_vec_pop_back(vec);
+  cr_assert_eq(tk_vec_capacity(vec), 512, "Shrink to twice the size");
+
+  // Hovering around the threshold must not reallocate back and forth.
+  for (int round = 0; round < 100; ++round) {
+    int value = round;
+    tk_vec_push_back(vec, &value);
+    tk_vec_pop_back(vec);
+    cr_assert_eq(tk_vec_capacity(vec), 512);
+  }
+  cr_assert_eq(*(int *)tk_vec_back(vec), 255);
+
+  tk_vec_clear(vec);
+  cr_assert_eq(tk_vec_capacity(vec), 4, "Clear keeps only the minimum");
+
+  // With auto-shrink off (the default), capacity is kept.
+  tk_vec_set_auto_shrink(vec, false);
+  tk_vec_resize(vec, 1000, NULL);
+  size_t capacity = tk_vec_capacity(vec);
+  tk_vec_resize(vec, 1, NULL);
+  cr_assert_eq(tk_vec_capacity(vec), capacity);
+}
+
 /**
  * @brief This test validates the entire iterator protocol implementation
  * for tk_vec_t.
@@ -178,6 +330,24 @@ Test(vec_suite, iterators) {
             "Iterator did not equal end() after the loop");
 }
 
+Test(vec_suite, random_access_iterator_ops) {
+  for (int i = 0; i < 10; ++i) {
+    tk_vec_push_back(vec, &i);
+  }
+  tk_iterator_t begin = tk_vec_begin(vec), end = tk_vec_end(vec);
+  cr_assert_eq(tk_iter_distance(&begin, &end), 10);
+  cr_assert_eq(tk_iter_distance(&end, &begin), -10);
+
+  tk_iterator_t it = begin;
+  tk_iter_advance_n(&it, 7);
+  cr_assert_eq(*(int *)tk_iter_get(&it), 7);
+  cr_assert_eq(*(int *)tk_iter_at(&it, -7), 0, "at() looks backward");
+  cr_assert_eq(*(int *)tk_iter_at(&it, 2), 9);
+  cr_assert_eq(*(int *)tk_iter_get(&it), 7, "at() must not move");
+  tk_iter_advance_n(&it, 3);
+  cr_assert(tk_iter_equal(&it, &end));
+}
+
 // --- Test helpers for tk_vec_destroy_full ---
 
 /**
@@ -279,3 +449,383 @@ Test(misc_tests, destroy_full) {
                "The destroyer function was not called the correct number of "
                "times.");
 }
+
+// --- Test helpers for custom allocators ---
+
+/**
+ * @brief Bookkeeping for a counting allocator that forwards to malloc.
+ */
+typedef struct {
+  int allocs;
+  int frees;
+  long long bytes_live;
+} counting_ctx_t;
+
+static void *counting_alloc(void *ctx, size_t size) {
+  counting_ctx_t *c = (counting_ctx_t *)ctx;
+  c->allocs++;
+  c->bytes_live += (long long)size;
+  return malloc(size);
+}
+
+static void *counting_realloc(void *ctx, void *ptr, size_t old_size,
+                              size_t new_size) {
+  counting_ctx_t *c = (counting_ctx_t *)ctx;
+  c->bytes_live += (long long)new_size - (long long)old_size;
+  return realloc(ptr, new_size);
+}
+
+static void counting_free(void *ctx, void *ptr, size_t size) {
+  counting_ctx_t *c = (counting_ctx_t *)ctx;
+  c->frees++;
+  c->bytes_live -= (long long)size;
+  free(ptr);
+}
+
+/**
+ * @brief Tests that every allocation of a vector, including the handle and
+ * its growth, is routed through a custom allocator and balanced on destroy.
+ */
+Test(misc_tests, custom_allocator) {
+  counting_ctx_t ctx = {0};
+  tk_allocator_t allocator = {.alloc = counting_alloc,
+                              .realloc = counting_realloc,
+                              .free = counting_free,
+                              .ctx = &ctx};
+
+  tk_vec_t *v = tk_vec_create_with_allocator(sizeof(int), &allocator);
+  cr_assert_not_null(v);
+  cr_assert_eq(ctx.allocs, 1, "The handle should come from the allocator");
+
+  for (int i = 0; i < 1000; ++i) {
+    cr_assert_eq(tk_vec_push_back(v, &i), TK_SUCCESS);
+  }
+  cr_assert_gt(ctx.allocs, 1, "Storage should come from the allocator");
+  cr_assert_geq(ctx.bytes_live, (long long)(1000 * sizeof(int)));
+  cr_assert_eq(*(int *)tk_vec_at(v, 999), 999);
+
+  tk_vec_destroy(v);
+  cr_assert_eq(ctx.allocs, ctx.frees, "Every allocation should be freed");
+  cr_assert_eq(ctx.bytes_live, 0, "Freed sizes should match allocated sizes");
+}
+
+/**
+ * @brief Tests that an inline vector stays in its handle until it outgrows
+ * the buffer, then spills to the heap and can move back.
+ */
+Test(misc_tests, inline_storage) {
+  counting_ctx_t ctx = {0};
+  tk_allocator_t allocator = {.alloc = counting_alloc,
+                              .realloc = counting_realloc,
+                              .free = counting_free,
+                              .ctx = &ctx};
+
+  // 34 bytes hold 8 whole ints; the remainder is dropped.
+  tk_vec_t *v =
+      tk_vec_create_inline_with_allocator(sizeof(int), 34, &allocator);
+  cr_assert_not_null(v);
+  cr_assert(tk_vec_is_inline(v));
+  cr_assert_eq(tk_vec_capacity(v), 8);
+  for (int i = 0; i < 8; ++i) {
+    cr_assert_eq(tk_vec_push_back(v, &i), TK_SUCCESS);
+  }
+  cr_assert_eq(ctx.allocs, 1, "Inline pushes must not allocate");
+  cr_assert_eq((size_t)tk_vec_data(v) % 16, 0, "Inline buffer is aligned");
+
+  int value = 8;
+  cr_assert_eq(tk_vec_push_back(v, &value), TK_SUCCESS);
+  cr_assert_not(tk_vec_is_inline(v));
+  cr_assert_eq(ctx.allocs, 2);
+  for (int i = 0; i < 9; ++i) {
+    cr_assert_eq(*(int *)tk_vec_at(v, i), i, "Spilling must keep elements");
+  }
+
+  tk_vec_erase_range(v, 0, 4);
+  cr_assert_eq(tk_vec_shrink_to_fit(v), TK_SUCCESS);
+  cr_assert(tk_vec_is_inline(v), "Should move back into the buffer");
+  cr_assert_eq(tk_vec_capacity(v), 8);
+  cr_assert_eq(*(int *)tk_vec_front(v), 4);
+  cr_assert_eq(*(int *)tk_vec_back(v), 8);
+
+  tk_vec_destroy(v);
+  cr_assert_eq(ctx.allocs, ctx.frees, "Every allocation should be freed");
+  cr_assert_eq(ctx.bytes_live, 0, "Freed sizes should match allocated sizes");
+
+  // Without room for one element, it is a regular vector.
+  v = tk_vec_create_inline(sizeof(double), 4);
+  cr_assert_not(tk_vec_is_inline(v));
+  cr_assert_eq(tk_vec_capacity(v), 0);
+  tk_vec_destroy(v);
+}
+
+/**
+ * @brief Tests adopting and detaching a buffer without copying it.
+ */
+Test(misc_tests, buffer_ownership_transfer) {
+  int *buffer = (int *)malloc(10 * sizeof(int));
+  for (int i = 0; i < 6; ++i) {
+    buffer[i] = i * 3;
+  }
+  tk_vec_t *v = tk_vec_from_buffer(sizeof(int), buffer, 6, 10);
+  cr_assert_not_null(v);
+  cr_assert_eq(tk_vec_data(v), buffer, "The buffer must be adopted as is");
+  cr_assert_eq(tk_vec_size(v), 6);
+  cr_assert_eq(tk_vec_capacity(v), 10);
+
+  int value = 18;
+  cr_assert_eq(tk_vec_push_back(v, &value), TK_SUCCESS);
+  cr_assert_eq(tk_vec_data(v), buffer, "No reallocation below capacity");
+
+  void *taken;
+  size_t size, capacity;
+  cr_assert_eq(tk_vec_take_buffer(v, &taken, &size, &capacity), TK_SUCCESS);
+  cr_assert_eq(taken, buffer);
+  cr_assert_eq(size, 7);
+  cr_assert_eq(capacity, 10);
+  cr_assert(tk_vec_is_empty(v));
+  cr_assert_null(tk_vec_data(v));
+
+  // The vector is still usable, and the buffer is ours to free.
+  cr_assert_eq(tk_vec_push_back(v, &value), TK_SUCCESS);
+  cr_assert_eq(((int *)taken)[6], 18);
+  free(taken);
+  tk_vec_destroy(v);
+
+  v = tk_vec_from_buffer(sizeof(int), NULL, 0, 0);
+  cr_assert_not_null(v);
+  cr_assert(tk_vec_is_empty(v));
+  tk_vec_destroy(v);
+
+  // Inline elements cannot leave the handle, so they are copied out.
+  v = tk_vec_create_inline(sizeof(int), 8 * sizeof(int));
+  tk_vec_push_back(v, &value);
+  tk_vec_push_back(v, &value);
+  cr_assert_eq(tk_vec_take_buffer(v, &taken, &size, NULL), TK_SUCCESS);
+  cr_assert_eq(size, 2);
+  cr_assert_eq(((int *)taken)[1], 18);
+  cr_assert(tk_vec_is_inline(v), "The handle keeps its inline buffer");
+  cr_assert_eq(tk_vec_capacity(v), 8);
+  free(taken);
+  tk_vec_destroy(v);
+}
+
+/**
+ * @brief Tests swap and move between heap and inline vectors, checking that
+ * every byte is still freed exactly once.
+ */
+Test(misc_tests, swap_and_move) {
+  counting_ctx_t ctx = {0};
+  tk_allocator_t allocator = {.alloc = counting_alloc,
+                              .realloc = counting_realloc,
+                              .free = counting_free,
+                              .ctx = &ctx};
+
+  tk_vec_t *big = tk_vec_create_with_allocator(sizeof(int), &allocator);
+  tk_vec_t *small =
+      tk_vec_create_inline_with_allocator(sizeof(int), 4 * sizeof(int),
+                                          &allocator);
+  for (int i = 0; i < 100; ++i) {
+    tk_vec_push_back(big, &i);
+  }
+  int seven = 7;
+  tk_vec_push_back(small, &seven);
+  void *big_data = tk_vec_data(big);
+
+  cr_assert_eq(tk_vec_swap(big, small), TK_SUCCESS);
+  cr_assert_eq(tk_vec_size(small), 100);
+  cr_assert_eq(tk_vec_data(small), big_data, "Heap storage is not copied");
+  cr_assert_eq(tk_vec_size(big), 1);
+  cr_assert_eq(*(int *)tk_vec_front(big), 7);
+
+  // Swapping back returns the single element to the inline buffer.
+  cr_assert_eq(tk_vec_swap(big, small), TK_SUCCESS);
+  cr_assert(tk_vec_is_inline(small));
+  cr_assert_eq(*(int *)tk_vec_front(small), 7);
+  cr_assert_eq(tk_vec_data(big), big_data);
+
+  tk_vec_t *dest = tk_vec_create_with_allocator(sizeof(int), &allocator);
+  tk_vec_push_back(dest, &seven);
+  cr_assert_eq(tk_vec_move(dest, big), TK_SUCCESS);
+  cr_assert_eq(tk_vec_data(dest), big_data);
+  cr_assert_eq(tk_vec_size(dest), 100);
+  cr_assert(tk_vec_is_empty(big));
+  cr_assert_eq(tk_vec_capacity(big), 0);
+
+  cr_assert_eq(tk_vec_move(big, small), TK_SUCCESS, "Inline elements copy");
+  cr_assert_eq(*(int *)tk_vec_front(big), 7);
+  cr_assert(tk_vec_is_empty(small));
+  cr_assert(tk_vec_is_inline(small));
+
+  tk_vec_t *doubles = tk_vec_create_with_allocator(sizeof(double), &allocator);
+  cr_assert_eq(tk_vec_swap(big, doubles), TK_E_INVALID_ARG);
+  cr_assert_eq(tk_vec_move(big, doubles), TK_E_INVALID_ARG);
+  tk_vec_t *other = tk_vec_create(sizeof(int));
+  cr_assert_eq(tk_vec_swap(big, other), TK_E_INVALID_ARG,
+               "Storage cannot cross allocators");
+  tk_vec_destroy(other);
+
+  tk_vec_destroy(doubles);
+  tk_vec_destroy(dest);
+  tk_vec_destroy(small);
+  tk_vec_destroy(big);
+  cr_assert_eq(ctx.allocs, ctx.frees, "Every allocation should be freed");
+  cr_assert_eq(ctx.bytes_live, 0, "Freed sizes should match allocated sizes");
+}
+
+/**
+ * @brief Tests that emplace_back hands out the slot at the end, growing the
+ * storage like a push.
+ */
+Test(misc_tests, emplace_back) {
+  typedef struct {
+    int id;
+    char payload[252];
+  } record_t;
+  tk_vec_t *v = tk_vec_create(sizeof(record_t));
+
+  for (int i = 0; i < 100; ++i) {
+    record_t *rec = (record_t *)tk_vec_emplace_back(v);
+    cr_assert_not_null(rec);
+    cr_assert_eq(rec, tk_vec_back(v), "The slot is the new last element");
+    rec->id = i;
+    rec->payload[0] = (char)i;
+  }
+  cr_assert_eq(tk_vec_size(v), 100);
+  cr_assert_eq(((record_t *)tk_vec_at(v, 42))->id, 42);
+  cr_assert_eq(((record_t *)tk_vec_at(v, 99))->payload[0], 99);
+  tk_vec_destroy(v);
+}
+
+// --- Test helpers for allocation failure ---
+
+/**
+ * @brief An allocator that serves a fixed budget of bytes and then fails.
+ */
+static void *budget_alloc(void *ctx, size_t size) {
+  size_t *budget = (size_t *)ctx;
+  if (size > *budget)
+    return NULL;
+  *budget -= size;
+  return malloc(size);
+}
+
+static void budget_free(void *ctx, void *ptr, size_t size) {
+  *(size_t *)ctx += size;
+  free(ptr);
+}
+
+/**
+ * @brief Tests that allocation failures surface as TK_E_NOMEM and leave the
+ * vector intact.
+ */
+Test(misc_tests, allocation_failure) {
+  size_t budget = 1024;
+  tk_allocator_t allocator = {
+      .alloc = budget_alloc, .free = budget_free, .ctx = &budget};
+
+  tk_vec_t *v = tk_vec_create_with_allocator(sizeof(int), &allocator);
+  cr_assert_not_null(v);
+
+  // From now on, only room for 16 elements is left.
+  budget = 16 * sizeof(int);
+  cr_assert_eq(tk_vec_reserve(v, 16), TK_SUCCESS);
+  cr_assert_eq(tk_vec_capacity(v), 16, "Reserve should allocate exactly");
+
+  for (int i = 0; i < 16; ++i) {
+    cr_assert_eq(tk_vec_push_back(v, &i), TK_SUCCESS);
+  }
+
+  int extra = 16;
+  cr_assert_eq(tk_vec_push_back(v, &extra), TK_E_NOMEM);
+  cr_assert_eq(tk_vec_resize(v, 100, NULL), TK_E_NOMEM);
+  cr_assert_eq(tk_vec_size(v), 16, "A failed push must not change the size");
+  cr_assert_eq(*(int *)tk_vec_back(v), 15);
+
+  tk_vec_destroy(v);
+}
+
+/**
+ * @brief Tests that aligned storage stays aligned, and keeps its elements,
+ * across growth and shrinking.
+ */
+Test(misc_tests, aligned_storage) {
+  const size_t alignments[] = {TK_VEC_CACHE_LINE, 4096};
+  for (size_t a = 0; a < 2; ++a) {
+    size_t alignment = alignments[a];
+    counting_ctx_t ctx = {0};
+    tk_allocator_t allocator = {.alloc = counting_alloc,
+                                .realloc = counting_realloc,
+                                .free = counting_free,
+                                .ctx = &ctx};
+    tk_vec_t *v = tk_vec_create_aligned_with_allocator(sizeof(int), alignment,
+                                                       0, &allocator);
+    cr_assert_not_null(v);
+    cr_assert_eq(tk_vec_stride(v), sizeof(int), "Unpadded slots are packed");
+
+    for (int i = 0; i < 5000; ++i) {
+      cr_assert_eq(tk_vec_push_back(v, &i), TK_SUCCESS);
+      cr_assert_eq((uintptr_t)tk_vec_data(v) % alignment, 0);
+    }
+    tk_vec_resize(v, 10, NULL);
+    cr_assert_eq(tk_vec_shrink_to_fit(v), TK_SUCCESS);
+    cr_assert_eq((uintptr_t)tk_vec_data(v) % alignment, 0);
+    for (int i = 0; i < 10; ++i)
+      cr_assert_eq(*(int *)tk_vec_at(v, i), i, "Elements survive realloc");
+
+    void *buffer;
+    cr_assert_eq(tk_vec_take_buffer(v, &buffer, NULL, NULL), TK_E_INVALID_ARG);
+    tk_vec_destroy(v);
+    cr_assert_eq(ctx.allocs, ctx.frees, "Every allocation should be freed");
+    cr_assert_eq(ctx.bytes_live, 0, "Freed sizes should match allocated sizes");
+  }
+}
+
+/**
+ * @brief Tests that padded vectors give each element its own cache line and
+ * still copy elements in and out at their own size.
+ */
+Test(misc_tests, padded_elements) {
+  tk_vec_t *v = tk_vec_create_aligned(sizeof(long), TK_VEC_CACHE_LINE,
+                                      TK_VEC_PAD_ELEMENTS);
+  cr_assert_not_null(v);
+  cr_assert_eq(tk_vec_stride(v), TK_VEC_CACHE_LINE);
+
+  long packed[] = {1, 2, 3};
+  long four = 4, seven = 7;
+  tk_vec_push_back_n(v, packed, 3);
+  tk_vec_push_back(v, &four);
+  tk_vec_resize(v, 6, &seven);
+  *(long *)tk_vec_emplace_back(v) = 8;
+  cr_assert_eq(tk_vec_size(v), 7);
+
+  const long expected[] = {1, 2, 3, 4, 7, 7, 8};
+  const char *data = (const char *)tk_vec_data(v);
+  for (size_t i = 0; i < 7; ++i) {
+    const char *slot = data + i * TK_VEC_CACHE_LINE;
+    cr_assert_eq((uintptr_t)slot % TK_VEC_CACHE_LINE, 0);
+    cr_assert_eq(tk_vec_at(v, i), slot);
+    cr_assert_eq(*(const long *)slot, expected[i]);
+    for (size_t b = sizeof(long); b < TK_VEC_CACHE_LINE; ++b)
+      cr_assert_eq(slot[b], 0, "Padding is kept zeroed");
+  }
+
+  // Iterators step by the stride.
+  tk_iterator_t it = tk_vec_begin(v), end = tk_vec_end(v);
+  cr_assert_eq(tk_iter_distance(&it, &end), 7);
+  size_t stride;
+  tk_iter_contiguous(&it, &stride);
+  cr_assert_eq(stride, TK_VEC_CACHE_LINE);
+
+  // Storage only moves between vectors of the same layout.
+  tk_vec_t *plain = tk_vec_create(sizeof(long));
+  tk_vec_t *other = tk_vec_create_aligned(sizeof(long), TK_VEC_CACHE_LINE,
+                                          TK_VEC_PAD_ELEMENTS);
+  cr_assert_eq(tk_vec_swap(v, plain), TK_E_INVALID_ARG);
+  cr_assert_eq(tk_vec_move(other, v), TK_SUCCESS);
+  cr_assert_eq(tk_vec_size(other), 7);
+  cr_assert_eq(*(long *)tk_vec_back(other), 8);
+  cr_assert(tk_vec_is_empty(v));
+  tk_vec_destroy(plain);
+  tk_vec_destroy(other);
+  tk_vec_destroy(v);
+}
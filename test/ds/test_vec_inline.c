@@ -0,0 +1,61 @@
+/**
+ * @file test_vec_inline.c
+ * @brief Unit tests for the opt-in TK_VEC_INLINE accessors of tk_vec_t.
+ *
+ * This file is compiled with TK_VEC_INLINE defined, so it sees the exposed
+ * struct layout and the static inline unchecked accessors.
+ */
+
+#define TK_VEC_INLINE
+
+#include <criterion/criterion.h>
+#include <criterion/new/assert.h>
+#include <tk/ds/vec.h>
+
+/**
+ * @brief Tests that the inline accessors agree with the checked API.
+ */
+Test(vec_inline_suite, accessors_match_checked_api) {
+  tk_vec_t *v = tk_vec_create(sizeof(float));
+  cr_assert_not_null(v);
+  cr_assert_eq(tk_vec_size_fast(v), 0);
+
+  for (int i = 0; i < 64; ++i) {
+    float f = (float)i * 0.5f;
+    tk_vec_push_back(v, &f);
+  }
+
+  cr_assert_eq(tk_vec_size_fast(v), tk_vec_size(v));
+  for (size_t i = 0; i < tk_vec_size_fast(v); ++i) {
+    cr_assert_eq(tk_vec_at_unchecked(v, i), tk_vec_at(v, i));
+  }
+
+  tk_vec_destroy(v);
+}
+
+/**
+ * @brief Tests a plain loop over tk_vec_data(), the shape of loop the inline
+ * mode is meant to let the compiler vectorize.
+ */
+Test(vec_inline_suite, contiguous_data_loop) {
+  tk_vec_t *v = tk_vec_create(sizeof(float));
+  cr_assert_not_null(v);
+  cr_assert_null(tk_vec_data(v), "No storage before the first push");
+
+  float ones[1000];
+  for (int i = 0; i < 1000; ++i) {
+    ones[i] = 1.0f;
+  }
+  tk_vec_push_back_n(v, ones, 1000);
+
+  const float *data = (const float *)tk_vec_data(v);
+  size_t n = tk_vec_size_fast(v);
+  float sum = 0.0f;
+  for (size_t i = 0; i < n; ++i) {
+    sum += data[i];
+  }
+  cr_assert_float_eq(sum, 1000.0f, 0.001f);
+  cr_assert_eq(data, tk_vec_front(v));
+
+  tk_vec_destroy(v);
+}